@@ -0,0 +1 @@
+../coregrind/m_gdbserver/valgrind-monitor.py
\ No newline at end of file
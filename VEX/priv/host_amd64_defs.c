@@ -39,6 +39,8 @@
 #include "host_generic_regs.h"
 #include "host_amd64_defs.h"
 
+Bool amd64_sse_vex = False;
+
 
 /* --------- Registers. --------- */
 
@@ -86,6 +88,13 @@ const RRegUniverse* getRRegUniverse_AMD64 ( void )
    ru->regs[ru->size++] = hregAMD64_XMM11();
    ru->regs[ru->size++] = hregAMD64_XMM12();
    ru->allocable_end[HRcVec128] = ru->size - 1;
+
+   ru->allocable_start[HRcVec256] = ru->size;
+   ru->regs[ru->size++] = hregAMD64_YMM2();
+   ru->regs[ru->size++] = hregAMD64_YMM13();
+   ru->regs[ru->size++] = hregAMD64_YMM14();
+   ru->regs[ru->size++] = hregAMD64_YMM15();
+   ru->allocable_end[HRcVec256] = ru->size - 1;
    ru->allocable = ru->size;
 
    /* And other regs, not available to the allocator. */
@@ -125,6 +134,10 @@ UInt ppHRegAMD64 ( HReg reg )
          r = hregEncoding(reg);
          vassert(r >= 0 && r < 16);
          return vex_printf("%%xmm%d", r);
+      case HRcVec256:
+         r = hregEncoding(reg);
+         vassert(r >= 0 && r < 16);
+         return vex_printf("%%ymm%d", r);
       default:
          vpanic("ppHRegAMD64");
    }
@@ -590,6 +603,17 @@ const HChar* showAMD64SseOp ( AMD64SseOp op ) {
       case Asse_PMADDUBSW: return "pmaddubsw";
       case Asse_F32toF16: return "vcvtps2ph(rm_field=$0x4).";
       case Asse_F16toF32: return "vcvtph2ps.";
+      case Asse_CMPEQ64:  return "pcmpeqq";
+      case Asse_CMPGT64S: return "pcmpgtq";
+      case Asse_MAX8S:    return "pmaxsb";
+      case Asse_MAX16U:   return "pmaxuw";
+      case Asse_MAX32S:   return "pmaxsd";
+      case Asse_MAX32U:   return "pmaxud";
+      case Asse_MIN8S:    return "pminsb";
+      case Asse_MIN16U:   return "pminuw";
+      case Asse_MIN32S:   return "pminsd";
+      case Asse_MIN32U:   return "pminud";
+      case Asse_MUL32:    return "pmulld";
       default: vpanic("showAMD64SseOp");
    }
 }
@@ -698,6 +722,7 @@ AMD64Instr* AMD64Instr_Call ( AMD64CondCode cond, Addr64 target, Int regparms,
    i->Ain.Call.target   = target;
    i->Ain.Call.regparms = regparms;
    i->Ain.Call.rloc     = rloc;
+   i->Ain.Call.zeroUpper = False;
    vassert(regparms >= 0 && regparms <= 6);
    vassert(is_sane_RetLoc(rloc));
    return i;
@@ -1039,23 +1064,63 @@ AMD64Instr* AMD64Instr_SseMOVQ ( HReg gpr, HReg xmm, Bool toXMM ) {
    vassert(hregClass(xmm) == HRcVec128);
    return i;
 }
-//uu AMD64Instr* AMD64Instr_AvxLdSt ( Bool isLoad,
-//uu                                  HReg reg, AMD64AMode* addr ) {
-//uu    AMD64Instr* i         = LibVEX_Alloc_inline(sizeof(AMD64Instr));
-//uu    i->tag                = Ain_AvxLdSt;
-//uu    i->Ain.AvxLdSt.isLoad = isLoad;
-//uu    i->Ain.AvxLdSt.reg    = reg;
-//uu    i->Ain.AvxLdSt.addr   = addr;
-//uu    return i;
-//uu }
-//uu AMD64Instr* AMD64Instr_AvxReRg ( AMD64SseOp op, HReg re, HReg rg ) {
-//uu    AMD64Instr* i      = LibVEX_Alloc_inline(sizeof(AMD64Instr));
-//uu    i->tag             = Ain_AvxReRg;
-//uu    i->Ain.AvxReRg.op  = op;
-//uu    i->Ain.AvxReRg.src = re;
-//uu    i->Ain.AvxReRg.dst = rg;
-//uu    return i;
-//uu }
+AMD64Instr* AMD64Instr_AvxLdSt ( Bool isLoad,
+                                 HReg reg, AMD64AMode* addr ) {
+   AMD64Instr* i         = LibVEX_Alloc_inline(sizeof(AMD64Instr));
+   i->tag                = Ain_AvxLdSt;
+   i->Ain.AvxLdSt.isLoad = isLoad;
+   i->Ain.AvxLdSt.reg    = reg;
+   i->Ain.AvxLdSt.addr   = addr;
+   vassert(hregClass(reg) == HRcVec256);
+   return i;
+}
+AMD64Instr* AMD64Instr_AvxReRg ( AMD64SseOp op,
+                                 HReg srcL, HReg srcR, HReg dst ) {
+   AMD64Instr* i       = LibVEX_Alloc_inline(sizeof(AMD64Instr));
+   i->tag              = Ain_AvxReRg;
+   i->Ain.AvxReRg.op   = op;
+   i->Ain.AvxReRg.srcL = srcL;
+   i->Ain.AvxReRg.srcR = srcR;
+   i->Ain.AvxReRg.dst  = dst;
+   if (op == Asse_MOV) vassert(sameHReg(srcL, srcR));
+   return i;
+}
+AMD64Instr* AMD64Instr_AvxShiftN ( AMD64SseOp op,
+                                   UInt shiftBits, HReg src, HReg dst ) {
+   AMD64Instr* i              = LibVEX_Alloc_inline(sizeof(AMD64Instr));
+   i->tag                     = Ain_AvxShiftN;
+   i->Ain.AvxShiftN.op        = op;
+   i->Ain.AvxShiftN.shiftBits = shiftBits;
+   i->Ain.AvxShiftN.src       = src;
+   i->Ain.AvxShiftN.dst       = dst;
+   return i;
+}
+AMD64Instr* AMD64Instr_AvxFromV128 ( HReg srcHi, HReg srcLo, HReg dst ) {
+   AMD64Instr* i             = LibVEX_Alloc_inline(sizeof(AMD64Instr));
+   i->tag                    = Ain_AvxFromV128;
+   i->Ain.AvxFromV128.srcHi  = srcHi;
+   i->Ain.AvxFromV128.srcLo  = srcLo;
+   i->Ain.AvxFromV128.dst    = dst;
+   vassert(hregClass(srcHi) == HRcVec128);
+   vassert(hregClass(srcLo) == HRcVec128);
+   vassert(hregClass(dst)   == HRcVec256);
+   return i;
+}
+AMD64Instr* AMD64Instr_AvxToV128 ( Bool hi, HReg src, HReg dst ) {
+   AMD64Instr* i         = LibVEX_Alloc_inline(sizeof(AMD64Instr));
+   i->tag                = Ain_AvxToV128;
+   i->Ain.AvxToV128.hi   = hi;
+   i->Ain.AvxToV128.src  = src;
+   i->Ain.AvxToV128.dst  = dst;
+   vassert(hregClass(src) == HRcVec256);
+   vassert(hregClass(dst) == HRcVec128);
+   return i;
+}
+AMD64Instr* AMD64Instr_AvxZeroUpper ( void ) {
+   AMD64Instr* i = LibVEX_Alloc_inline(sizeof(AMD64Instr));
+   i->tag        = Ain_AvxZeroUpper;
+   return i;
+}
 AMD64Instr* AMD64Instr_EvCheck ( AMD64AMode* amCounter,
                                  AMD64AMode* amFailAddr ) {
    AMD64Instr* i             = LibVEX_Alloc_inline(sizeof(AMD64Instr));
@@ -1146,7 +1211,9 @@ void ppAMD64Instr ( const AMD64Instr* i, Bool mode64 )
                        ? "" : showAMD64CondCode(i->Ain.Call.cond),
                     i->Ain.Call.regparms );
          ppRetLoc(i->Ain.Call.rloc);
-         vex_printf("] 0x%llx", i->Ain.Call.target);
+         vex_printf("] %s0x%llx",
+                    i->Ain.Call.zeroUpper ? "(vzeroupper) " : "",
+                    i->Ain.Call.target);
          break;
 
       case Ain_XDirect:
@@ -1416,24 +1483,58 @@ void ppAMD64Instr ( const AMD64Instr* i, Bool mode64 )
             ppHRegAMD64(i->Ain.SseMOVQ.gpr);
          };
          return;
-      //uu case Ain_AvxLdSt:
-      //uu    vex_printf("vmovups ");
-      //uu    if (i->Ain.AvxLdSt.isLoad) {
-      //uu       ppAMD64AMode(i->Ain.AvxLdSt.addr);
-      //uu       vex_printf(",");
-      //uu       ppHRegAMD64(i->Ain.AvxLdSt.reg);
-      //uu    } else {
-      //uu       ppHRegAMD64(i->Ain.AvxLdSt.reg);
-      //uu       vex_printf(",");
-      //uu       ppAMD64AMode(i->Ain.AvxLdSt.addr);
-      //uu    }
-      //uu    return;
-      //uu case Ain_AvxReRg:
-      //uu    vex_printf("v%s ", showAMD64SseOp(i->Ain.SseReRg.op));
-      //uu    ppHRegAMD64(i->Ain.AvxReRg.src);
-      //uu    vex_printf(",");
-      //uu    ppHRegAMD64(i->Ain.AvxReRg.dst);
-      //uu    return;
+      case Ain_AvxLdSt:
+         vex_printf("vmovdqu ");
+         if (i->Ain.AvxLdSt.isLoad) {
+            ppAMD64AMode(i->Ain.AvxLdSt.addr);
+            vex_printf(",");
+            ppHRegAMD64(i->Ain.AvxLdSt.reg);
+         } else {
+            ppHRegAMD64(i->Ain.AvxLdSt.reg);
+            vex_printf(",");
+            ppAMD64AMode(i->Ain.AvxLdSt.addr);
+         }
+         return;
+      case Ain_AvxReRg:
+         if (i->Ain.AvxReRg.op == Asse_MOV) {
+            vex_printf("vmovdqa ");
+         } else {
+            vex_printf("v%s ", showAMD64SseOp(i->Ain.AvxReRg.op));
+            ppHRegAMD64(i->Ain.AvxReRg.srcR);
+            vex_printf(",");
+         }
+         ppHRegAMD64(i->Ain.AvxReRg.srcL);
+         vex_printf(",");
+         ppHRegAMD64(i->Ain.AvxReRg.dst);
+         return;
+      case Ain_AvxShiftN:
+         vex_printf("v%s $%u, ", showAMD64SseOp(i->Ain.AvxShiftN.op),
+                                 i->Ain.AvxShiftN.shiftBits);
+         ppHRegAMD64(i->Ain.AvxShiftN.src);
+         vex_printf(",");
+         ppHRegAMD64(i->Ain.AvxShiftN.dst);
+         return;
+      case Ain_AvxFromV128:
+         vex_printf("vinserti128 $1,");
+         ppHRegAMD64(i->Ain.AvxFromV128.srcHi);
+         vex_printf(",");
+         ppHRegAMD64(i->Ain.AvxFromV128.srcLo);
+         vex_printf(",");
+         ppHRegAMD64(i->Ain.AvxFromV128.dst);
+         return;
+      case Ain_AvxToV128:
+         if (i->Ain.AvxToV128.hi) {
+            vex_printf("vextracti128 $1,");
+         } else {
+            vex_printf("vmovdqa(lo128) ");
+         }
+         ppHRegAMD64(i->Ain.AvxToV128.src);
+         vex_printf(",");
+         ppHRegAMD64(i->Ain.AvxToV128.dst);
+         return;
+      case Ain_AvxZeroUpper:
+         vex_printf("vzeroupper");
+         return;
       case Ain_EvCheck:
          vex_printf("(evCheck) decl ");
          ppAMD64AMode(i->Ain.EvCheck.amCounter);
@@ -1530,7 +1631,7 @@ void getRegUsage_AMD64Instr ( HRegUsage* u, const AMD64Instr* i, Bool mode64 )
          /* First off, claim it trashes all the caller-saved regs
             which fall within the register allocator's jurisdiction.
             These I believe to be: rax rcx rdx rdi rsi r8 r9 r10
-            and all the xmm registers. */
+            and all the xmm and ymm registers. */
          addHRegUse(u, HRmWrite, hregAMD64_RAX());
          addHRegUse(u, HRmWrite, hregAMD64_RCX());
          addHRegUse(u, HRmWrite, hregAMD64_RDX());
@@ -1551,6 +1652,10 @@ void getRegUsage_AMD64Instr ( HRegUsage* u, const AMD64Instr* i, Bool mode64 )
          addHRegUse(u, HRmWrite, hregAMD64_XMM10());
          addHRegUse(u, HRmWrite, hregAMD64_XMM11());
          addHRegUse(u, HRmWrite, hregAMD64_XMM12());
+         addHRegUse(u, HRmWrite, hregAMD64_YMM2());
+         addHRegUse(u, HRmWrite, hregAMD64_YMM13());
+         addHRegUse(u, HRmWrite, hregAMD64_YMM14());
+         addHRegUse(u, HRmWrite, hregAMD64_YMM15());
 
          /* Now we have to state any parameter-carrying registers
             which might be read.  This depends on the regparmness. */
@@ -1766,30 +1871,52 @@ void getRegUsage_AMD64Instr ( HRegUsage* u, const AMD64Instr* i, Bool mode64 )
          addHRegUse(u, i->Ain.SseMOVQ.toXMM ? HRmWrite : HRmRead,
                     i->Ain.SseMOVQ.xmm);
          return;
-      //uu case Ain_AvxLdSt:
-      //uu addRegUsage_AMD64AMode(u, i->Ain.AvxLdSt.addr);
-      //uu addHRegUse(u, i->Ain.AvxLdSt.isLoad ? HRmWrite : HRmRead,
-      //uu               i->Ain.AvxLdSt.reg);
-      //uu return;
-      //uu case Ain_AvxReRg:
-      //uu    if ( (i->Ain.AvxReRg.op == Asse_XOR
-      //uu          || i->Ain.AvxReRg.op == Asse_CMPEQ32)
-      //uu         && i->Ain.AvxReRg.src == i->Ain.AvxReRg.dst) {
-      //uu       /* See comments on the case for Ain_SseReRg. */
-      //uu       addHRegUse(u, HRmWrite, i->Ain.AvxReRg.dst);
-      //uu    } else {
-      //uu       addHRegUse(u, HRmRead, i->Ain.AvxReRg.src);
-      //uu       addHRegUse(u, i->Ain.AvxReRg.op == Asse_MOV 
-      //uu                        ? HRmWrite : HRmModify, 
-      //uu                     i->Ain.AvxReRg.dst);
-      //uu
-      //uu       if (i->Ain.AvxReRg.op == Asse_MOV) {
-      //uu          u->isRegRegMove = True;
-      //uu          u->regMoveSrc   = i->Ain.AvxReRg.src;
-      //uu          u->regMoveDst   = i->Ain.AvxReRg.dst;
-      //uu       }
-      //uu    }
-      //uu    return;
+      case Ain_AvxLdSt:
+         addRegUsage_AMD64AMode(u, i->Ain.AvxLdSt.addr);
+         addHRegUse(u, i->Ain.AvxLdSt.isLoad ? HRmWrite : HRmRead,
+                       i->Ain.AvxLdSt.reg);
+         return;
+      case Ain_AvxReRg:
+         if ( (i->Ain.AvxReRg.op == Asse_XOR
+               || i->Ain.AvxReRg.op == Asse_CMPEQ32)
+              && sameHReg(i->Ain.AvxReRg.srcL, i->Ain.AvxReRg.srcR)
+              && sameHReg(i->Ain.AvxReRg.srcR, i->Ain.AvxReRg.dst)) {
+            /* See comments on the case for Ain_SseReRg. */
+            addHRegUse(u, HRmWrite, i->Ain.AvxReRg.dst);
+         } else {
+            addHRegUse(u, HRmRead, i->Ain.AvxReRg.srcL);
+            addHRegUse(u, HRmRead, i->Ain.AvxReRg.srcR);
+            addHRegUse(u, HRmWrite, i->Ain.AvxReRg.dst);
+            if (i->Ain.AvxReRg.op == Asse_MOV) {
+               u->isRegRegMove = True;
+               u->regMoveSrc   = i->Ain.AvxReRg.srcR;
+               u->regMoveDst   = i->Ain.AvxReRg.dst;
+            }
+         }
+         return;
+      case Ain_AvxShiftN:
+         addHRegUse(u, HRmRead,  i->Ain.AvxShiftN.src);
+         addHRegUse(u, HRmWrite, i->Ain.AvxShiftN.dst);
+         return;
+      case Ain_AvxFromV128:
+         addHRegUse(u, HRmRead,  i->Ain.AvxFromV128.srcHi);
+         addHRegUse(u, HRmRead,  i->Ain.AvxFromV128.srcLo);
+         addHRegUse(u, HRmWrite, i->Ain.AvxFromV128.dst);
+         return;
+      case Ain_AvxToV128:
+         addHRegUse(u, HRmRead,  i->Ain.AvxToV128.src);
+         addHRegUse(u, HRmWrite, i->Ain.AvxToV128.dst);
+         return;
+      case Ain_AvxZeroUpper:
+         /* vzeroupper destroys the upper halves of all the %ymm
+            registers, so claim it trashes all of them.  That forces
+            the allocator to spill any live Vec256 values before it
+            and to reload them afterwards. */
+         addHRegUse(u, HRmWrite, hregAMD64_YMM2());
+         addHRegUse(u, HRmWrite, hregAMD64_YMM13());
+         addHRegUse(u, HRmWrite, hregAMD64_YMM14());
+         addHRegUse(u, HRmWrite, hregAMD64_YMM15());
+         return;
       case Ain_EvCheck:
          /* We expect both amodes only to mention %rbp, so this is in
             fact pointless, since %rbp isn't allocatable, but anyway.. */
@@ -1991,14 +2118,30 @@ void mapRegs_AMD64Instr ( HRegRemap* m, AMD64Instr* i, Bool mode64 )
          mapReg(m, &i->Ain.SseMOVQ.gpr);
          mapReg(m, &i->Ain.SseMOVQ.xmm);
          return;
-      //uu case Ain_AvxLdSt:
-      //uu    mapReg(m, &i->Ain.AvxLdSt.reg);
-      //uu    mapRegs_AMD64AMode(m, i->Ain.AvxLdSt.addr);
-      //uu    break;
-      //uu case Ain_AvxReRg:
-      //uu    mapReg(m, &i->Ain.AvxReRg.src);
-      //uu    mapReg(m, &i->Ain.AvxReRg.dst);
-      //uu    return;
+      case Ain_AvxLdSt:
+         mapReg(m, &i->Ain.AvxLdSt.reg);
+         mapRegs_AMD64AMode(m, i->Ain.AvxLdSt.addr);
+         return;
+      case Ain_AvxReRg:
+         mapReg(m, &i->Ain.AvxReRg.srcL);
+         mapReg(m, &i->Ain.AvxReRg.srcR);
+         mapReg(m, &i->Ain.AvxReRg.dst);
+         return;
+      case Ain_AvxShiftN:
+         mapReg(m, &i->Ain.AvxShiftN.src);
+         mapReg(m, &i->Ain.AvxShiftN.dst);
+         return;
+      case Ain_AvxFromV128:
+         mapReg(m, &i->Ain.AvxFromV128.srcHi);
+         mapReg(m, &i->Ain.AvxFromV128.srcLo);
+         mapReg(m, &i->Ain.AvxFromV128.dst);
+         return;
+      case Ain_AvxToV128:
+         mapReg(m, &i->Ain.AvxToV128.src);
+         mapReg(m, &i->Ain.AvxToV128.dst);
+         return;
+      case Ain_AvxZeroUpper:
+         return;
       case Ain_EvCheck:
          /* We expect both amodes only to mention %rbp, so this is in
             fact pointless, since %rbp isn't allocatable, but anyway.. */
@@ -2034,6 +2177,9 @@ void genSpill_AMD64 ( /*OUT*/HInstr** i1, /*OUT*/HInstr** i2,
       case HRcVec128:
          *i1 = AMD64Instr_SseLdSt ( False/*store*/, 16, rreg, am );
          return;
+      case HRcVec256:
+         *i1 = AMD64Instr_AvxLdSt ( False/*store*/, rreg, am );
+         return;
       default: 
          ppHRegClass(hregClass(rreg));
          vpanic("genSpill_AMD64: unimplemented regclass");
@@ -2056,6 +2202,9 @@ void genReload_AMD64 ( /*OUT*/HInstr** i1, /*OUT*/HInstr** i2,
       case HRcVec128:
          *i1 = AMD64Instr_SseLdSt ( True/*load*/, 16, rreg, am );
          return;
+      case HRcVec256:
+         *i1 = AMD64Instr_AvxLdSt ( True/*load*/, rreg, am );
+         return;
       default: 
          ppHRegClass(hregClass(rreg));
          vpanic("genReload_AMD64: unimplemented regclass");
@@ -2069,6 +2218,8 @@ AMD64Instr* genMove_AMD64(HReg from, HReg to, Bool mode64)
       return AMD64Instr_Alu64R(Aalu_MOV, AMD64RMI_Reg(from), to);
    case HRcVec128:
       return AMD64Instr_SseReRg(Asse_MOV, from, to);
+   case HRcVec256:
+      return AMD64Instr_AvxReRg(Asse_MOV, from, from, to);
    default:
       ppHRegClass(hregClass(from));
       vpanic("genMove_AMD64: unimplemented regclass");
@@ -2159,6 +2310,17 @@ inline static UInt vregEnc3210 ( HReg r )
    return n;
 }
 
+/* Ditto, for a 256-bit vector register. */
+inline static UInt yregEnc3210 ( HReg r )
+{
+   UInt n;
+   vassert(hregClass(r) == HRcVec256);
+   vassert(!hregIsVirtual(r));
+   n = hregEncoding(r);
+   vassert(n <= 15);
+   return n;
+}
+
 inline static UChar mkModRegRM ( UInt mod, UInt reg, UInt regmem )
 {
    vassert(mod < 4);
@@ -2433,85 +2595,91 @@ static UChar rexAMode_R_enc_enc ( UInt gregEnc3210, UInt eregEnc3210 )
 }
 
 
-//uu /* May 2012: this VEX prefix stuff is currently unused, but has
-//uu    verified correct (I reckon).  Certainly it has been known to
-//uu    produce correct VEX prefixes during testing. */
-//uu 
-//uu /* Assemble a 2 or 3 byte VEX prefix from parts.  rexR, rexX, rexB and
-//uu    notVvvvv need to be not-ed before packing.  mmmmm, rexW, L and pp go
-//uu    in verbatim.  There's no range checking on the bits. */
-//uu static UInt packVexPrefix ( UInt rexR, UInt rexX, UInt rexB,
-//uu                             UInt mmmmm, UInt rexW, UInt notVvvv,
-//uu                             UInt L, UInt pp )
-//uu {
-//uu    UChar byte0 = 0;
-//uu    UChar byte1 = 0;
-//uu    UChar byte2 = 0;
-//uu    if (rexX == 0 && rexB == 0 && mmmmm == 1 && rexW == 0) {
-//uu       /* 2 byte encoding is possible. */
-//uu       byte0 = 0xC5;
-//uu       byte1 = ((rexR ^ 1) << 7) | ((notVvvv ^ 0xF) << 3) 
-//uu               | (L << 2) | pp;
-//uu    } else {
-//uu       /* 3 byte encoding is needed. */
-//uu       byte0 = 0xC4;
-//uu       byte1 = ((rexR ^ 1) << 7) | ((rexX ^ 1) << 6)
-//uu               | ((rexB ^ 1) << 5) | mmmmm;
-//uu       byte2 = (rexW << 7) | ((notVvvv ^ 0xF) << 3) | (L << 2) | pp;
-//uu    }
-//uu    return (((UInt)byte2) << 16) | (((UInt)byte1) << 8) | ((UInt)byte0);
-//uu }
-//uu 
-//uu /* Make up a VEX prefix for a (greg,amode) pair.  First byte in bits
-//uu    7:0 of result, second in 15:8, third (for a 3 byte prefix) in
-//uu    23:16.  Has m-mmmm set to indicate a prefix of 0F, pp set to
-//uu    indicate no SIMD prefix, W=0 (ignore), L=1 (size=256), and
-//uu    vvvv=1111 (unused 3rd reg). */
-//uu static UInt vexAMode_M ( HReg greg, AMD64AMode* am )
-//uu {
-//uu    UChar L       = 1; /* size = 256 */
-//uu    UChar pp      = 0; /* no SIMD prefix */
-//uu    UChar mmmmm   = 1; /* 0F */
-//uu    UChar notVvvv = 0; /* unused */
-//uu    UChar rexW    = 0;
-//uu    UChar rexR    = 0;
-//uu    UChar rexX    = 0;
-//uu    UChar rexB    = 0;
-//uu    /* Same logic as in rexAMode_M. */
-//uu    if (am->tag == Aam_IR) {
-//uu       rexR = iregEnc3(greg);
-//uu       rexX = 0; /* not relevant */
-//uu       rexB = iregEnc3(am->Aam.IR.reg);
-//uu    }
-//uu    else if (am->tag == Aam_IRRS) {
-//uu       rexR = iregEnc3(greg);
-//uu       rexX = iregEnc3(am->Aam.IRRS.index);
-//uu       rexB = iregEnc3(am->Aam.IRRS.base);
-//uu    } else {
-//uu       vassert(0);
-//uu    }
-//uu    return packVexPrefix( rexR, rexX, rexB, mmmmm, rexW, notVvvv, L, pp );
-//uu }
-//uu 
-//uu static UChar* emitVexPrefix ( UChar* p, UInt vex )
-//uu {
-//uu    switch (vex & 0xFF) {
-//uu       case 0xC5:
-//uu          *p++ = 0xC5;
-//uu          *p++ = (vex >> 8) & 0xFF;
-//uu          vassert(0 == (vex >> 16));
-//uu          break;
-//uu       case 0xC4:
-//uu          *p++ = 0xC4;
-//uu          *p++ = (vex >> 8) & 0xFF;
-//uu          *p++ = (vex >> 16) & 0xFF;
-//uu          vassert(0 == (vex >> 24));
-//uu          break;
-//uu       default:
-//uu          vassert(0);
-//uu    }
-//uu    return p;
-//uu }
+/* Assemble a 2 or 3 byte VEX prefix from parts, and emit it.  rexR,
+   rexX and rexB are the high bits of the register numbers, exactly as
+   they would appear in a REX prefix; they are inverted here.  vvvv is
+   the number of the extra (non-destructive) source register, or zero
+   if there isn't one; it too is inverted here.  mmmmm selects the
+   opcode map (1 = 0F, 2 = 0F38, 3 = 0F3A), L the vector length (0 =
+   128 bits, 1 = 256 bits) and pp the implied SIMD prefix (0 = none,
+   1 = 66, 2 = F3, 3 = F2).  There's no range checking on the bits. */
+static UChar* emitVexPrefix ( UChar* p, UInt rexR, UInt rexX, UInt rexB,
+                              UInt mmmmm, UInt rexW, UInt vvvv,
+                              UInt L, UInt pp )
+{
+   if (rexX == 0 && rexB == 0 && mmmmm == 1 && rexW == 0) {
+      /* 2 byte encoding is possible. */
+      *p++ = 0xC5;
+      *p++ = toUChar( ((rexR ^ 1) << 7) | ((vvvv ^ 0xF) << 3)
+                      | (L << 2) | pp );
+   } else {
+      /* 3 byte encoding is needed. */
+      *p++ = 0xC4;
+      *p++ = toUChar( ((rexR ^ 1) << 7) | ((rexX ^ 1) << 6)
+                      | ((rexB ^ 1) << 5) | mmmmm );
+      *p++ = toUChar( (rexW << 7) | ((vvvv ^ 0xF) << 3) | (L << 2) | pp );
+   }
+   return p;
+}
+
+/* Make up and emit a VEX prefix for a (greg,amode) pair, with W=0 and
+   no extra source register.  Same logic as in rexAMode_M. */
+static UChar* emitVexPrefix_AMode ( UChar* p, UInt gregEnc3210,
+                                    AMD64AMode* am,
+                                    UInt mmmmm, UInt L, UInt pp )
+{
+   UInt rexR = (gregEnc3210 >> 3) & 1;
+   UInt rexX = 0;
+   UInt rexB = 0;
+   if (am->tag == Aam_IR) {
+      rexB = iregEnc3(am->Aam.IR.reg);
+   }
+   else if (am->tag == Aam_IRRS) {
+      rexX = iregEnc3(am->Aam.IRRS.index);
+      rexB = iregEnc3(am->Aam.IRRS.base);
+   } else {
+      vassert(0);
+   }
+   return emitVexPrefix(p, rexR, rexX, rexB, mmmmm, 0/*W*/, 0/*vvvv*/, L, pp);
+}
+
+/* Make up and emit a VEX prefix for a register-register form, with
+   W=0. */
+static UChar* emitVexPrefix_RR ( UChar* p, UInt gregEnc3210, UInt vvvv,
+                                 UInt eregEnc3210,
+                                 UInt mmmmm, UInt L, UInt pp )
+{
+   vassert((gregEnc3210 | vvvv | eregEnc3210) < 16);
+   return emitVexPrefix(p, (gregEnc3210 >> 3) & 1, 0, (eregEnc3210 >> 3) & 1,
+                        mmmmm, 0/*W*/, vvvv, L, pp);
+}
+
+/* Emit the mandatory prefix, REX byte and opcode escape of an SSE
+   instruction, pp and mmmmm being as for emitVexPrefix.  If
+   amd64_sse_vex is set, emit the equivalent VEX.128 prefix instead,
+   with R, X, B and W taken from rex.  vvvv is then the extra source
+   register: the destination for the destructive two-operand forms,
+   whose upper bits the VEX forms take from it, and zero when there
+   is no such operand. */
+static UChar* emitSsePrefix ( UChar* p, UInt pp, UChar rex,
+                              UInt mmmmm, UInt vvvv )
+{
+   vassert(pp < 4 && mmmmm >= 1 && mmmmm <= 3 && vvvv < 16);
+   if (amd64_sse_vex)
+      return emitVexPrefix(p, (rex >> 2) & 1, (rex >> 1) & 1, rex & 1,
+                           mmmmm, (rex >> 3) & 1, vvvv, 0/*128*/, pp);
+   switch (pp) {
+      case 1: *p++ = 0x66; break;
+      case 2: *p++ = 0xF3; break;
+      case 3: *p++ = 0xF2; break;
+      default: break;
+   }
+   *p++ = rex;
+   *p++ = 0x0F;
+   if (mmmmm == 2) *p++ = 0x38;
+   if (mmmmm == 3) *p++ = 0x3A;
+   return p;
+}
 
 
 /* Emit ffree %st(N) */
@@ -2991,8 +3159,15 @@ Int emit_AMD64Instr ( /*MB_MOD*/Bool* is_profInc,
          Bool shortImm = fitsIn32Bits(i->Ain.Call.target);
          if (i->Ain.Call.cond != Acc_ALWAYS) {
             *p++ = toUChar(0x70 + (0xF & (i->Ain.Call.cond ^ 1)));
-            *p++ = shortImm ? 10 : 13;
-            /* 10 or 13 bytes in the next two insns */
+            *p++ = (shortImm ? 10 : 13) + (i->Ain.Call.zeroUpper ? 3 : 0);
+            /* 10 or 13 bytes in the next two insns, plus 3 for the
+               vzeroupper */
+         }
+         if (i->Ain.Call.zeroUpper) {
+            /* 3 bytes: vzeroupper */
+            *p++ = 0xC5;
+            *p++ = 0xF8;
+            *p++ = 0x77;
          }
          if (shortImm) {
             /* 7 bytes: movl sign-extend(imm32), %r11 */
@@ -3015,6 +3190,7 @@ Int emit_AMD64Instr ( /*MB_MOD*/Bool* is_profInc,
          /* Complex case.  We have to generate an if-then-else diamond. */
          // before:
          //   j{!cond} else:
+         //   vzeroupper                         // possibly
          //   movabsq $target, %r11
          //   call* %r11
          // preElse:
@@ -3031,6 +3207,13 @@ Int emit_AMD64Instr ( /*MB_MOD*/Bool* is_profInc,
          *p++ = toUChar(0x70 + (0xF & (i->Ain.Call.cond ^ 1)));
          *p++ = 0; /* # of bytes to jump over; don't know how many yet. */
 
+         //   vzeroupper                         // possibly
+         if (i->Ain.Call.zeroUpper) {
+            *p++ = 0xC5;
+            *p++ = 0xF8;
+            *p++ = 0x77;
+         }
+
          //   movabsq $target, %r11
          *p++ = 0x49;
          *p++ = 0xBB;
@@ -3590,8 +3773,8 @@ Int emit_AMD64Instr ( /*MB_MOD*/Bool* is_profInc,
       break;
 
    case Ain_LdMXCSR:
-      *p++ = clearWBit(rexAMode_M_enc(0, i->Ain.LdMXCSR.addr));
-      *p++ = 0x0F;
+      p = emitSsePrefix(p, 0, clearWBit(rexAMode_M_enc(0, i->Ain.LdMXCSR.addr)),
+                        1/*0F*/, 0);
       *p++ = 0xAE;
       p = doAMode_M_enc(p, 2/*subopcode*/, i->Ain.LdMXCSR.addr);
       goto done;
@@ -3599,16 +3782,14 @@ Int emit_AMD64Instr ( /*MB_MOD*/Bool* is_profInc,
    case Ain_SseUComIS:
       /* ucomi[sd] %srcL, %srcR ;  pushfq ; popq %dst */
       /* ucomi[sd] %srcL, %srcR */
-      if (i->Ain.SseUComIS.sz == 8) {
-         *p++ = 0x66;
-      } else {
+      if (i->Ain.SseUComIS.sz != 8) {
          goto bad;
          vassert(i->Ain.SseUComIS.sz == 4);
       }
-      *p++ = clearWBit (
+      p = emitSsePrefix(p, 1/*66*/, clearWBit (
              rexAMode_R_enc_enc( vregEnc3210(i->Ain.SseUComIS.srcL),
-                                 vregEnc3210(i->Ain.SseUComIS.srcR) ));
-      *p++ = 0x0F;
+                                 vregEnc3210(i->Ain.SseUComIS.srcR) )),
+             1/*0F*/, 0);
       *p++ = 0x2E;
       p = doAMode_R_enc_enc(p, vregEnc3210(i->Ain.SseUComIS.srcL),
                                vregEnc3210(i->Ain.SseUComIS.srcR) );
@@ -3623,9 +3804,9 @@ Int emit_AMD64Instr ( /*MB_MOD*/Bool* is_profInc,
       /* cvssi2s[sd] %src, %dst */
       rex = rexAMode_R_enc_reg( vregEnc3210(i->Ain.SseSI2SF.dst),
                                 i->Ain.SseSI2SF.src );
-      *p++ = toUChar(i->Ain.SseSI2SF.szD==4 ? 0xF3 : 0xF2);
-      *p++ = toUChar(i->Ain.SseSI2SF.szS==4 ? clearWBit(rex) : rex);
-      *p++ = 0x0F;
+      p = emitSsePrefix(p, i->Ain.SseSI2SF.szD==4 ? 2/*F3*/ : 3/*F2*/,
+                        i->Ain.SseSI2SF.szS==4 ? clearWBit(rex) : rex,
+                        1/*0F*/, vregEnc3210(i->Ain.SseSI2SF.dst));
       *p++ = 0x2A;
       p = doAMode_R_enc_reg( p, vregEnc3210(i->Ain.SseSI2SF.dst),
                                 i->Ain.SseSI2SF.src );
@@ -3635,9 +3816,9 @@ Int emit_AMD64Instr ( /*MB_MOD*/Bool* is_profInc,
       /* cvss[sd]2si %src, %dst */
       rex = rexAMode_R_reg_enc( i->Ain.SseSF2SI.dst,
                                 vregEnc3210(i->Ain.SseSF2SI.src) );
-      *p++ = toUChar(i->Ain.SseSF2SI.szS==4 ? 0xF3 : 0xF2);
-      *p++ = toUChar(i->Ain.SseSF2SI.szD==4 ? clearWBit(rex) : rex);
-      *p++ = 0x0F;
+      p = emitSsePrefix(p, i->Ain.SseSF2SI.szS==4 ? 2/*F3*/ : 3/*F2*/,
+                        i->Ain.SseSF2SI.szD==4 ? clearWBit(rex) : rex,
+                        1/*0F*/, 0);
       *p++ = 0x2D;
       p = doAMode_R_reg_enc( p, i->Ain.SseSF2SI.dst,
                                 vregEnc3210(i->Ain.SseSF2SI.src) );
@@ -3645,11 +3826,11 @@ Int emit_AMD64Instr ( /*MB_MOD*/Bool* is_profInc,
 
    case Ain_SseSDSS:
       /* cvtsd2ss/cvtss2sd %src, %dst */
-      *p++ = toUChar(i->Ain.SseSDSS.from64 ? 0xF2 : 0xF3);
-      *p++ = clearWBit(
+      p = emitSsePrefix(p, i->Ain.SseSDSS.from64 ? 3/*F2*/ : 2/*F3*/,
+              clearWBit(
               rexAMode_R_enc_enc( vregEnc3210(i->Ain.SseSDSS.dst),
-                                  vregEnc3210(i->Ain.SseSDSS.src) ));
-      *p++ = 0x0F;
+                                  vregEnc3210(i->Ain.SseSDSS.src) )),
+              1/*0F*/, vregEnc3210(i->Ain.SseSDSS.dst));
       *p++ = 0x5A;
       p = doAMode_R_enc_enc( p, vregEnc3210(i->Ain.SseSDSS.dst),
                                 vregEnc3210(i->Ain.SseSDSS.src) );
@@ -3657,18 +3838,20 @@ Int emit_AMD64Instr ( /*MB_MOD*/Bool* is_profInc,
 
    case Ain_SseLdSt:
       if (i->Ain.SseLdSt.sz == 8) {
-         *p++ = 0xF2;
+         subopc = 3; /* F2 */
       } else
       if (i->Ain.SseLdSt.sz == 4) {
-         *p++ = 0xF3;
+         subopc = 2; /* F3 */
       } else
-      if (i->Ain.SseLdSt.sz != 16) {
+      if (i->Ain.SseLdSt.sz == 16) {
+         subopc = 0;
+      } else {
          vassert(0);
       }
-      *p++ = clearWBit(
+      p = emitSsePrefix(p, subopc, clearWBit(
              rexAMode_M_enc(vregEnc3210(i->Ain.SseLdSt.reg),
-                            i->Ain.SseLdSt.addr));
-      *p++ = 0x0F; 
+                            i->Ain.SseLdSt.addr)),
+             1/*0F*/, 0);
       *p++ = toUChar(i->Ain.SseLdSt.isLoad ? 0x10 : 0x11);
       p = doAMode_M_enc(p, vregEnc3210(i->Ain.SseLdSt.reg),
                            i->Ain.SseLdSt.addr);
@@ -3686,10 +3869,10 @@ Int emit_AMD64Instr ( /*MB_MOD*/Bool* is_profInc,
       *p++ = 0; /* # of bytes to jump over; don't know how many yet. */
 
       /* Now the store. */
-      *p++ = clearWBit(
+      p = emitSsePrefix(p, 0, clearWBit(
              rexAMode_M_enc(vregEnc3210(i->Ain.SseCStore.src),
-                            i->Ain.SseCStore.addr));
-      *p++ = 0x0F; 
+                            i->Ain.SseCStore.addr)),
+             1/*0F*/, 0);
       *p++ = toUChar(0x11);
       p = doAMode_M_enc(p, vregEnc3210(i->Ain.SseCStore.src),
                            i->Ain.SseCStore.addr);
@@ -3713,10 +3896,10 @@ Int emit_AMD64Instr ( /*MB_MOD*/Bool* is_profInc,
       *p++ = 0; /* # of bytes to jump over; don't know how many yet. */
 
       /* Now the load. */
-      *p++ = clearWBit(
+      p = emitSsePrefix(p, 0, clearWBit(
              rexAMode_M_enc(vregEnc3210(i->Ain.SseCLoad.dst),
-                            i->Ain.SseCLoad.addr));
-      *p++ = 0x0F; 
+                            i->Ain.SseCLoad.addr)),
+             1/*0F*/, 0);
       *p++ = toUChar(0x10);
       p = doAMode_M_enc(p, vregEnc3210(i->Ain.SseCLoad.dst),
                            i->Ain.SseCLoad.addr);
@@ -3731,11 +3914,11 @@ Int emit_AMD64Instr ( /*MB_MOD*/Bool* is_profInc,
    case Ain_SseLdzLO:
       vassert(i->Ain.SseLdzLO.sz == 4 || i->Ain.SseLdzLO.sz == 8);
       /* movs[sd] amode, %xmm-dst */
-      *p++ = toUChar(i->Ain.SseLdzLO.sz==4 ? 0xF3 : 0xF2);
-      *p++ = clearWBit(
+      p = emitSsePrefix(p, i->Ain.SseLdzLO.sz==4 ? 2/*F3*/ : 3/*F2*/,
+             clearWBit(
              rexAMode_M_enc(vregEnc3210(i->Ain.SseLdzLO.reg), 
-                            i->Ain.SseLdzLO.addr));
-      *p++ = 0x0F; 
+                            i->Ain.SseLdzLO.addr)),
+             1/*0F*/, 0);
       *p++ = 0x10; 
       p = doAMode_M_enc(p, vregEnc3210(i->Ain.SseLdzLO.reg), 
                            i->Ain.SseLdzLO.addr);
@@ -3780,14 +3963,22 @@ Int emit_AMD64Instr ( /*MB_MOD*/Bool* is_profInc,
          }
          default: break;
       }
-      // After this point, REX encoded cases only
+      // After this point, REX encoded cases only, or VEX.128 encoded
+      // ones if amd64_sse_vex.  The unary ones have no vvvv operand.
       xtra = 0;
       switch (i->Ain.Sse32Fx4.op) {
-         case Asse_F2I: *p++ = 0x66; break;
-         default: break;
+         case Asse_RCPF: case Asse_RSQRTF: case Asse_SQRTF:
+         case Asse_I2F: case Asse_F2I:
+            p = emitSsePrefix(p, i->Ain.Sse32Fx4.op == Asse_F2I ? 1/*66*/ : 0,
+                              clearWBit(rexAMode_R_enc_enc(dstRegNo, srcRegNo)),
+                              1/*0F*/, 0);
+            break;
+         default:
+            p = emitSsePrefix(p, 0,
+                              clearWBit(rexAMode_R_enc_enc(dstRegNo, srcRegNo)),
+                              1/*0F*/, dstRegNo);
+            break;
       }
-      *p++ = clearWBit(rexAMode_R_enc_enc(dstRegNo, srcRegNo));
-      *p++ = 0x0F;
       switch (i->Ain.Sse32Fx4.op) {
          case Asse_ADDF:   *p++ = 0x58; break;
          case Asse_DIVF:   *p++ = 0x5E; break;
@@ -3814,11 +4005,11 @@ Int emit_AMD64Instr ( /*MB_MOD*/Bool* is_profInc,
 
    case Ain_Sse64Fx2:
       xtra = 0;
-      *p++ = 0x66;
-      *p++ = clearWBit(
+      p = emitSsePrefix(p, 1/*66*/, clearWBit(
              rexAMode_R_enc_enc( vregEnc3210(i->Ain.Sse64Fx2.dst),
-                                 vregEnc3210(i->Ain.Sse64Fx2.src) ));
-      *p++ = 0x0F;
+                                 vregEnc3210(i->Ain.Sse64Fx2.src) )),
+             1/*0F*/, i->Ain.Sse64Fx2.op == Asse_SQRTF
+                         ? 0 : vregEnc3210(i->Ain.Sse64Fx2.dst));
       switch (i->Ain.Sse64Fx2.op) {
          case Asse_ADDF:   *p++ = 0x58; break;
          case Asse_DIVF:   *p++ = 0x5E; break;
@@ -3841,11 +4032,10 @@ Int emit_AMD64Instr ( /*MB_MOD*/Bool* is_profInc,
 
    case Ain_Sse32FLo:
       xtra = 0;
-      *p++ = 0xF3;
-      *p++ = clearWBit(
+      p = emitSsePrefix(p, 2/*F3*/, clearWBit(
              rexAMode_R_enc_enc( vregEnc3210(i->Ain.Sse32FLo.dst),
-                                 vregEnc3210(i->Ain.Sse32FLo.src) ));
-      *p++ = 0x0F;
+                                 vregEnc3210(i->Ain.Sse32FLo.src) )),
+             1/*0F*/, vregEnc3210(i->Ain.Sse32FLo.dst));
       switch (i->Ain.Sse32FLo.op) {
          case Asse_ADDF:   *p++ = 0x58; break;
          case Asse_DIVF:   *p++ = 0x5E; break;
@@ -3870,11 +4060,10 @@ Int emit_AMD64Instr ( /*MB_MOD*/Bool* is_profInc,
 
    case Ain_Sse64FLo:
       xtra = 0;
-      *p++ = 0xF2;
-      *p++ = clearWBit(
+      p = emitSsePrefix(p, 3/*F2*/, clearWBit(
              rexAMode_R_enc_enc( vregEnc3210(i->Ain.Sse64FLo.dst),
-                                 vregEnc3210(i->Ain.Sse64FLo.src) ));
-      *p++ = 0x0F;
+                                 vregEnc3210(i->Ain.Sse64FLo.src) )),
+             1/*0F*/, vregEnc3210(i->Ain.Sse64FLo.dst));
       switch (i->Ain.Sse64FLo.op) {
          case Asse_ADDF:   *p++ = 0x58; break;
          case Asse_DIVF:   *p++ = 0x5E; break;
@@ -3895,79 +4084,81 @@ Int emit_AMD64Instr ( /*MB_MOD*/Bool* is_profInc,
          *p++ = toUChar(xtra & 0xFF);
       goto done;
 
-   case Ain_SseReRg:
-#     define XX(_n) *p++ = (_n)
+   case Ain_SseReRg: {
+      /* pp and mmmmm as for emitSsePrefix */
+      UInt pp = 0, mmmmm = 1, dst = vregEnc3210(i->Ain.SseReRg.dst);
 
       rex = clearWBit(
-            rexAMode_R_enc_enc( vregEnc3210(i->Ain.SseReRg.dst),
-                                vregEnc3210(i->Ain.SseReRg.src) ));
+            rexAMode_R_enc_enc( dst, vregEnc3210(i->Ain.SseReRg.src) ));
 
       switch (i->Ain.SseReRg.op) {
-         case Asse_MOV:     /*movups*/ XX(rex); XX(0x0F); XX(0x10); break;
-         case Asse_OR:                 XX(rex); XX(0x0F); XX(0x56); break;
-         case Asse_XOR:                XX(rex); XX(0x0F); XX(0x57); break;
-         case Asse_AND:                XX(rex); XX(0x0F); XX(0x54); break;
-         case Asse_ANDN:               XX(rex); XX(0x0F); XX(0x55); break;
-         case Asse_PACKSSD:  XX(0x66); XX(rex); XX(0x0F); XX(0x6B); break;
-         case Asse_PACKSSW:  XX(0x66); XX(rex); XX(0x0F); XX(0x63); break;
-         case Asse_PACKUSW:  XX(0x66); XX(rex); XX(0x0F); XX(0x67); break;
-         case Asse_ADD8:     XX(0x66); XX(rex); XX(0x0F); XX(0xFC); break;
-         case Asse_ADD16:    XX(0x66); XX(rex); XX(0x0F); XX(0xFD); break;
-         case Asse_ADD32:    XX(0x66); XX(rex); XX(0x0F); XX(0xFE); break;
-         case Asse_ADD64:    XX(0x66); XX(rex); XX(0x0F); XX(0xD4); break;
-         case Asse_QADD8S:   XX(0x66); XX(rex); XX(0x0F); XX(0xEC); break;
-         case Asse_QADD16S:  XX(0x66); XX(rex); XX(0x0F); XX(0xED); break;
-         case Asse_QADD8U:   XX(0x66); XX(rex); XX(0x0F); XX(0xDC); break;
-         case Asse_QADD16U:  XX(0x66); XX(rex); XX(0x0F); XX(0xDD); break;
-         case Asse_AVG8U:    XX(0x66); XX(rex); XX(0x0F); XX(0xE0); break;
-         case Asse_AVG16U:   XX(0x66); XX(rex); XX(0x0F); XX(0xE3); break;
-         case Asse_CMPEQ8:   XX(0x66); XX(rex); XX(0x0F); XX(0x74); break;
-         case Asse_CMPEQ16:  XX(0x66); XX(rex); XX(0x0F); XX(0x75); break;
-         case Asse_CMPEQ32:  XX(0x66); XX(rex); XX(0x0F); XX(0x76); break;
-         case Asse_CMPGT8S:  XX(0x66); XX(rex); XX(0x0F); XX(0x64); break;
-         case Asse_CMPGT16S: XX(0x66); XX(rex); XX(0x0F); XX(0x65); break;
-         case Asse_CMPGT32S: XX(0x66); XX(rex); XX(0x0F); XX(0x66); break;
-         case Asse_MAX16S:   XX(0x66); XX(rex); XX(0x0F); XX(0xEE); break;
-         case Asse_MAX8U:    XX(0x66); XX(rex); XX(0x0F); XX(0xDE); break;
-         case Asse_MIN16S:   XX(0x66); XX(rex); XX(0x0F); XX(0xEA); break;
-         case Asse_MIN8U:    XX(0x66); XX(rex); XX(0x0F); XX(0xDA); break;
-         case Asse_MULHI16U: XX(0x66); XX(rex); XX(0x0F); XX(0xE4); break;
-         case Asse_MULHI16S: XX(0x66); XX(rex); XX(0x0F); XX(0xE5); break;
-         case Asse_MUL16:    XX(0x66); XX(rex); XX(0x0F); XX(0xD5); break;
-         case Asse_SHL16:    XX(0x66); XX(rex); XX(0x0F); XX(0xF1); break;
-         case Asse_SHL32:    XX(0x66); XX(rex); XX(0x0F); XX(0xF2); break;
-         case Asse_SHL64:    XX(0x66); XX(rex); XX(0x0F); XX(0xF3); break;
-         case Asse_SAR16:    XX(0x66); XX(rex); XX(0x0F); XX(0xE1); break;
-         case Asse_SAR32:    XX(0x66); XX(rex); XX(0x0F); XX(0xE2); break;
-         case Asse_SHR16:    XX(0x66); XX(rex); XX(0x0F); XX(0xD1); break;
-         case Asse_SHR32:    XX(0x66); XX(rex); XX(0x0F); XX(0xD2); break;
-         case Asse_SHR64:    XX(0x66); XX(rex); XX(0x0F); XX(0xD3); break;
-         case Asse_SUB8:     XX(0x66); XX(rex); XX(0x0F); XX(0xF8); break;
-         case Asse_SUB16:    XX(0x66); XX(rex); XX(0x0F); XX(0xF9); break;
-         case Asse_SUB32:    XX(0x66); XX(rex); XX(0x0F); XX(0xFA); break;
-         case Asse_SUB64:    XX(0x66); XX(rex); XX(0x0F); XX(0xFB); break;
-         case Asse_QSUB8S:   XX(0x66); XX(rex); XX(0x0F); XX(0xE8); break;
-         case Asse_QSUB16S:  XX(0x66); XX(rex); XX(0x0F); XX(0xE9); break;
-         case Asse_QSUB8U:   XX(0x66); XX(rex); XX(0x0F); XX(0xD8); break;
-         case Asse_QSUB16U:  XX(0x66); XX(rex); XX(0x0F); XX(0xD9); break;
-         case Asse_UNPCKHB:  XX(0x66); XX(rex); XX(0x0F); XX(0x68); break;
-         case Asse_UNPCKHW:  XX(0x66); XX(rex); XX(0x0F); XX(0x69); break;
-         case Asse_UNPCKHD:  XX(0x66); XX(rex); XX(0x0F); XX(0x6A); break;
-         case Asse_UNPCKHQ:  XX(0x66); XX(rex); XX(0x0F); XX(0x6D); break;
-         case Asse_UNPCKLB:  XX(0x66); XX(rex); XX(0x0F); XX(0x60); break;
-         case Asse_UNPCKLW:  XX(0x66); XX(rex); XX(0x0F); XX(0x61); break;
-         case Asse_UNPCKLD:  XX(0x66); XX(rex); XX(0x0F); XX(0x62); break;
-         case Asse_UNPCKLQ:  XX(0x66); XX(rex); XX(0x0F); XX(0x6C); break;
-         case Asse_PSHUFB:   XX(0x66); XX(rex);
-                             XX(0x0F); XX(0x38); XX(0x00); break;
-         case Asse_PMADDUBSW:XX(0x66); XX(rex);
-                             XX(0x0F); XX(0x38); XX(0x04); break;
+         case Asse_MOV:      pp = 0; opc = 0x10; break; /*movups*/
+         case Asse_OR:       pp = 0; opc = 0x56; break;
+         case Asse_XOR:      pp = 0; opc = 0x57; break;
+         case Asse_AND:      pp = 0; opc = 0x54; break;
+         case Asse_ANDN:     pp = 0; opc = 0x55; break;
+         case Asse_PACKSSD:  pp = 1; opc = 0x6B; break;
+         case Asse_PACKSSW:  pp = 1; opc = 0x63; break;
+         case Asse_PACKUSW:  pp = 1; opc = 0x67; break;
+         case Asse_ADD8:     pp = 1; opc = 0xFC; break;
+         case Asse_ADD16:    pp = 1; opc = 0xFD; break;
+         case Asse_ADD32:    pp = 1; opc = 0xFE; break;
+         case Asse_ADD64:    pp = 1; opc = 0xD4; break;
+         case Asse_QADD8S:   pp = 1; opc = 0xEC; break;
+         case Asse_QADD16S:  pp = 1; opc = 0xED; break;
+         case Asse_QADD8U:   pp = 1; opc = 0xDC; break;
+         case Asse_QADD16U:  pp = 1; opc = 0xDD; break;
+         case Asse_AVG8U:    pp = 1; opc = 0xE0; break;
+         case Asse_AVG16U:   pp = 1; opc = 0xE3; break;
+         case Asse_CMPEQ8:   pp = 1; opc = 0x74; break;
+         case Asse_CMPEQ16:  pp = 1; opc = 0x75; break;
+         case Asse_CMPEQ32:  pp = 1; opc = 0x76; break;
+         case Asse_CMPGT8S:  pp = 1; opc = 0x64; break;
+         case Asse_CMPGT16S: pp = 1; opc = 0x65; break;
+         case Asse_CMPGT32S: pp = 1; opc = 0x66; break;
+         case Asse_MAX16S:   pp = 1; opc = 0xEE; break;
+         case Asse_MAX8U:    pp = 1; opc = 0xDE; break;
+         case Asse_MIN16S:   pp = 1; opc = 0xEA; break;
+         case Asse_MIN8U:    pp = 1; opc = 0xDA; break;
+         case Asse_MULHI16U: pp = 1; opc = 0xE4; break;
+         case Asse_MULHI16S: pp = 1; opc = 0xE5; break;
+         case Asse_MUL16:    pp = 1; opc = 0xD5; break;
+         case Asse_SHL16:    pp = 1; opc = 0xF1; break;
+         case Asse_SHL32:    pp = 1; opc = 0xF2; break;
+         case Asse_SHL64:    pp = 1; opc = 0xF3; break;
+         case Asse_SAR16:    pp = 1; opc = 0xE1; break;
+         case Asse_SAR32:    pp = 1; opc = 0xE2; break;
+         case Asse_SHR16:    pp = 1; opc = 0xD1; break;
+         case Asse_SHR32:    pp = 1; opc = 0xD2; break;
+         case Asse_SHR64:    pp = 1; opc = 0xD3; break;
+         case Asse_SUB8:     pp = 1; opc = 0xF8; break;
+         case Asse_SUB16:    pp = 1; opc = 0xF9; break;
+         case Asse_SUB32:    pp = 1; opc = 0xFA; break;
+         case Asse_SUB64:    pp = 1; opc = 0xFB; break;
+         case Asse_QSUB8S:   pp = 1; opc = 0xE8; break;
+         case Asse_QSUB16S:  pp = 1; opc = 0xE9; break;
+         case Asse_QSUB8U:   pp = 1; opc = 0xD8; break;
+         case Asse_QSUB16U:  pp = 1; opc = 0xD9; break;
+         case Asse_UNPCKHB:  pp = 1; opc = 0x68; break;
+         case Asse_UNPCKHW:  pp = 1; opc = 0x69; break;
+         case Asse_UNPCKHD:  pp = 1; opc = 0x6A; break;
+         case Asse_UNPCKHQ:  pp = 1; opc = 0x6D; break;
+         case Asse_UNPCKLB:  pp = 1; opc = 0x60; break;
+         case Asse_UNPCKLW:  pp = 1; opc = 0x61; break;
+         case Asse_UNPCKLD:  pp = 1; opc = 0x62; break;
+         case Asse_UNPCKLQ:  pp = 1; opc = 0x6C; break;
+         case Asse_PSHUFB:   pp = 1; mmmmm = 2; opc = 0x00; break;
+         case Asse_PMADDUBSW:pp = 1; mmmmm = 2; opc = 0x04; break;
          default: goto bad;
       }
-      p = doAMode_R_enc_enc(p, vregEnc3210(i->Ain.SseReRg.dst),
-                               vregEnc3210(i->Ain.SseReRg.src) );
-#     undef XX
+      /* movups has no vvvv operand; all the others are destructive
+         two-operand forms. */
+      p = emitSsePrefix(p, pp, rex, mmmmm,
+                        i->Ain.SseReRg.op == Asse_MOV ? 0 : dst);
+      *p++ = toUChar(opc);
+      p = doAMode_R_enc_enc(p, dst, vregEnc3210(i->Ain.SseReRg.src) );
       goto done;
+   }
 
    case Ain_SseCMov:
       /* jmp fwds if !condition */
@@ -3976,10 +4167,10 @@ Int emit_AMD64Instr ( /*MB_MOD*/Bool* is_profInc,
       ptmp = p;
 
       /* movaps %src, %dst */
-      *p++ = clearWBit(
+      p = emitSsePrefix(p, 0, clearWBit(
              rexAMode_R_enc_enc( vregEnc3210(i->Ain.SseCMov.dst),
-                                 vregEnc3210(i->Ain.SseCMov.src) ));
-      *p++ = 0x0F; 
+                                 vregEnc3210(i->Ain.SseCMov.src) )),
+             1/*0F*/, 0);
       *p++ = 0x28; 
       p = doAMode_R_enc_enc(p, vregEnc3210(i->Ain.SseCMov.dst),
                                vregEnc3210(i->Ain.SseCMov.src) );
@@ -3989,11 +4180,10 @@ Int emit_AMD64Instr ( /*MB_MOD*/Bool* is_profInc,
       goto done;
 
    case Ain_SseShuf:
-      *p++ = 0x66; 
-      *p++ = clearWBit(
+      p = emitSsePrefix(p, 1/*66*/, clearWBit(
              rexAMode_R_enc_enc( vregEnc3210(i->Ain.SseShuf.dst),
-                                 vregEnc3210(i->Ain.SseShuf.src) ));
-      *p++ = 0x0F; 
+                                 vregEnc3210(i->Ain.SseShuf.src) )),
+             1/*0F*/, 0);
       *p++ = 0x70; 
       p = doAMode_R_enc_enc(p, vregEnc3210(i->Ain.SseShuf.dst),
                                vregEnc3210(i->Ain.SseShuf.src) );
@@ -4029,11 +4219,10 @@ Int emit_AMD64Instr ( /*MB_MOD*/Bool* is_profInc,
       }
       vassert(limit > 0 && opc > 0 && subopc_imm > 0);
       if (shiftImm > limit) goto bad;
-      *p++ = 0x66;
-      *p++ = clearWBit(
+      p = emitSsePrefix(p, 1/*66*/, clearWBit(
              rexAMode_R_enc_enc( subopc_imm,
-                                 vregEnc3210(i->Ain.SseShiftN.dst) ));
-      *p++ = 0x0F;
+                                 vregEnc3210(i->Ain.SseShiftN.dst) )),
+             1/*0F*/, vregEnc3210(i->Ain.SseShiftN.dst));
       *p++ = opc;
       p = doAMode_R_enc_enc(p, subopc_imm, vregEnc3210(i->Ain.SseShiftN.dst));
       *p++ = shiftImm;
@@ -4044,22 +4233,152 @@ Int emit_AMD64Instr ( /*MB_MOD*/Bool* is_profInc,
       Bool toXMM = i->Ain.SseMOVQ.toXMM;
       HReg gpr = i->Ain.SseMOVQ.gpr;
       HReg xmm = i->Ain.SseMOVQ.xmm;
-      *p++ = 0x66;
-      *p++ = setWBit( rexAMode_R_enc_enc( vregEnc3210(xmm), iregEnc3210(gpr)) );
-      *p++ = 0x0F;
+      p = emitSsePrefix(p, 1/*66*/,
+             setWBit( rexAMode_R_enc_enc( vregEnc3210(xmm), iregEnc3210(gpr)) ),
+             1/*0F*/, 0);
       *p++ = toXMM ? 0x6E : 0x7E;
       p = doAMode_R_enc_enc( p, vregEnc3210(xmm), iregEnc3210(gpr) );
       goto done;
    }
 
-   //uu case Ain_AvxLdSt: {
-   //uu    UInt vex = vexAMode_M( dvreg2ireg(i->Ain.AvxLdSt.reg),
-   //uu                           i->Ain.AvxLdSt.addr );
-   //uu    p = emitVexPrefix(p, vex);
-   //uu    *p++ = toUChar(i->Ain.AvxLdSt.isLoad ? 0x10 : 0x11);
-   //uu    p = doAMode_M(p, dvreg2ireg(i->Ain.AvxLdSt.reg), i->Ain.AvxLdSt.addr);
-   //uu      goto done;
-   //uu }
+   case Ain_AvxLdSt: {
+      /* vmovdqu m256, %ymm  or  vmovdqu %ymm, m256 */
+      UInt yreg = yregEnc3210(i->Ain.AvxLdSt.reg);
+      p = emitVexPrefix_AMode(p, yreg, i->Ain.AvxLdSt.addr,
+                              1/*0F*/, 1/*256*/, 2/*F3*/);
+      *p++ = toUChar(i->Ain.AvxLdSt.isLoad ? 0x6F : 0x7F);
+      p = doAMode_M_enc(p, yreg, i->Ain.AvxLdSt.addr);
+      goto done;
+   }
+
+   case Ain_AvxReRg: {
+      UInt dst  = yregEnc3210(i->Ain.AvxReRg.dst);
+      UInt srcL = yregEnc3210(i->Ain.AvxReRg.srcL);
+      UInt srcR = yregEnc3210(i->Ain.AvxReRg.srcR);
+      UInt mmmmm = 1; /* 0F */
+      switch (i->Ain.AvxReRg.op) {
+         case Asse_MOV:
+            /* vmovdqa %ymmSrc, %ymmDst */
+            p = emitVexPrefix_RR(p, dst, 0, srcR, 1/*0F*/, 1/*256*/, 1/*66*/);
+            *p++ = 0x6F;
+            p = doAMode_R_enc_enc(p, dst, srcR);
+            goto done;
+         case Asse_AND:      opc = 0xDB; break;
+         case Asse_OR:       opc = 0xEB; break;
+         case Asse_XOR:      opc = 0xEF; break;
+         case Asse_ANDN:     opc = 0xDF; break;
+         case Asse_ADD8:     opc = 0xFC; break;
+         case Asse_ADD16:    opc = 0xFD; break;
+         case Asse_ADD32:    opc = 0xFE; break;
+         case Asse_ADD64:    opc = 0xD4; break;
+         case Asse_QADD8S:   opc = 0xEC; break;
+         case Asse_QADD16S:  opc = 0xED; break;
+         case Asse_QADD8U:   opc = 0xDC; break;
+         case Asse_QADD16U:  opc = 0xDD; break;
+         case Asse_AVG8U:    opc = 0xE0; break;
+         case Asse_AVG16U:   opc = 0xE3; break;
+         case Asse_CMPEQ8:   opc = 0x74; break;
+         case Asse_CMPEQ16:  opc = 0x75; break;
+         case Asse_CMPEQ32:  opc = 0x76; break;
+         case Asse_CMPGT8S:  opc = 0x64; break;
+         case Asse_CMPGT16S: opc = 0x65; break;
+         case Asse_CMPGT32S: opc = 0x66; break;
+         case Asse_MAX16S:   opc = 0xEE; break;
+         case Asse_MAX8U:    opc = 0xDE; break;
+         case Asse_MIN16S:   opc = 0xEA; break;
+         case Asse_MIN8U:    opc = 0xDA; break;
+         case Asse_MULHI16U: opc = 0xE4; break;
+         case Asse_MULHI16S: opc = 0xE5; break;
+         case Asse_MUL16:    opc = 0xD5; break;
+         case Asse_SUB8:     opc = 0xF8; break;
+         case Asse_SUB16:    opc = 0xF9; break;
+         case Asse_SUB32:    opc = 0xFA; break;
+         case Asse_SUB64:    opc = 0xFB; break;
+         case Asse_QSUB8S:   opc = 0xE8; break;
+         case Asse_QSUB16S:  opc = 0xE9; break;
+         case Asse_QSUB8U:   opc = 0xD8; break;
+         case Asse_QSUB16U:  opc = 0xD9; break;
+         case Asse_CMPEQ64:  opc = 0x29; mmmmm = 2; break;
+         case Asse_CMPGT64S: opc = 0x37; mmmmm = 2; break;
+         case Asse_MIN8S:    opc = 0x38; mmmmm = 2; break;
+         case Asse_MIN32S:   opc = 0x39; mmmmm = 2; break;
+         case Asse_MIN16U:   opc = 0x3A; mmmmm = 2; break;
+         case Asse_MIN32U:   opc = 0x3B; mmmmm = 2; break;
+         case Asse_MAX8S:    opc = 0x3C; mmmmm = 2; break;
+         case Asse_MAX32S:   opc = 0x3D; mmmmm = 2; break;
+         case Asse_MAX16U:   opc = 0x3E; mmmmm = 2; break;
+         case Asse_MAX32U:   opc = 0x3F; mmmmm = 2; break;
+         case Asse_MUL32:    opc = 0x40; mmmmm = 2; break;
+         default: goto bad;
+      }
+      /* vOP %ymmSrcR, %ymmSrcL, %ymmDst */
+      p = emitVexPrefix_RR(p, dst, srcL, srcR, mmmmm, 1/*256*/, 1/*66*/);
+      *p++ = toUChar(opc);
+      p = doAMode_R_enc_enc(p, dst, srcR);
+      goto done;
+   }
+
+   case Ain_AvxShiftN: {
+      UInt limit = 0;
+      switch (i->Ain.AvxShiftN.op) {
+         case Asse_SHL16: limit = 15; opc = 0x71; subopc_imm = 6; break;
+         case Asse_SHL32: limit = 31; opc = 0x72; subopc_imm = 6; break;
+         case Asse_SHL64: limit = 63; opc = 0x73; subopc_imm = 6; break;
+         case Asse_SAR16: limit = 15; opc = 0x71; subopc_imm = 4; break;
+         case Asse_SAR32: limit = 31; opc = 0x72; subopc_imm = 4; break;
+         case Asse_SHR16: limit = 15; opc = 0x71; subopc_imm = 2; break;
+         case Asse_SHR32: limit = 31; opc = 0x72; subopc_imm = 2; break;
+         case Asse_SHR64: limit = 63; opc = 0x73; subopc_imm = 2; break;
+         default: goto bad;
+      }
+      if (i->Ain.AvxShiftN.shiftBits > limit) goto bad;
+      /* vpsXX $imm, %ymmSrc, %ymmDst -- the destination is in vvvv */
+      UInt src = yregEnc3210(i->Ain.AvxShiftN.src);
+      p = emitVexPrefix_RR(p, subopc_imm, yregEnc3210(i->Ain.AvxShiftN.dst),
+                           src, 1/*0F*/, 1/*256*/, 1/*66*/);
+      *p++ = toUChar(opc);
+      p = doAMode_R_enc_enc(p, subopc_imm, src);
+      *p++ = toUChar(i->Ain.AvxShiftN.shiftBits);
+      goto done;
+   }
+
+   case Ain_AvxFromV128: {
+      /* vinserti128 $1, %xmmHi, %ymmLo, %ymmDst */
+      UInt dst = yregEnc3210(i->Ain.AvxFromV128.dst);
+      UInt hi  = vregEnc3210(i->Ain.AvxFromV128.srcHi);
+      UInt lo  = vregEnc3210(i->Ain.AvxFromV128.srcLo);
+      p = emitVexPrefix_RR(p, dst, lo, hi, 3/*0F3A*/, 1/*256*/, 1/*66*/);
+      *p++ = 0x38;
+      p = doAMode_R_enc_enc(p, dst, hi);
+      *p++ = 0x01;
+      goto done;
+   }
+
+   case Ain_AvxToV128: {
+      UInt src = yregEnc3210(i->Ain.AvxToV128.src);
+      UInt dst = vregEnc3210(i->Ain.AvxToV128.dst);
+      if (i->Ain.AvxToV128.hi) {
+         /* vextracti128 $1, %ymmSrc, %xmmDst */
+         p = emitVexPrefix_RR(p, src, 0, dst, 3/*0F3A*/, 1/*256*/, 1/*66*/);
+         *p++ = 0x39;
+         p = doAMode_R_enc_enc(p, src, dst);
+         *p++ = 0x01;
+      } else {
+         /* vmovdqa %xmmSrc, %xmmDst.  The VEX.128 encoding zeroes
+            bits 255:128 of the destination, which is harmless. */
+         p = emitVexPrefix_RR(p, dst, 0, src, 1/*0F*/, 0/*128*/, 1/*66*/);
+         *p++ = 0x6F;
+         p = doAMode_R_enc_enc(p, dst, src);
+      }
+      goto done;
+   }
+
+   case Ain_AvxZeroUpper:
+      /* vzeroupper */
+      *p++ = 0xC5;
+      *p++ = 0xF8;
+      *p++ = 0x77;
+      goto done;
 
    case Ain_EvCheck: {
       /* We generate:
@@ -38,10 +38,21 @@
 #include "libvex.h"                      // VexArch
 #include "host_generic_regs.h"           // HReg
 
+/* Set by the instruction selector.  If True, the SSE instructions are
+   emitted in their VEX.128 encodings, so that they don't pay the
+   SSE/AVX transition penalty in blocks that also use %ymm registers.
+   This is only done on hosts with AVX2. */
+extern Bool amd64_sse_vex;
+
+
 /* --------- Registers. --------- */
 
 /* The usual HReg abstraction.  There are 16 real int regs, 6 real
-   float regs, and 16 real vector regs.
+   float regs, and 16 real vector regs.  The vector regs are split
+   between two classes: %xmm3 .. %xmm12 are allocated as 128-bit
+   (Vec128) registers, and %ymm2 and %ymm13 .. %ymm15 are allocated
+   as 256-bit (Vec256) registers.  The latter are only used on hosts
+   with AVX2; see host_amd64_isel.c.
 */
 
 #define ST_IN static inline
@@ -67,15 +78,20 @@ ST_IN HReg hregAMD64_XMM10 ( void ) { return mkHReg(False, HRcVec128, 10, 17); }
 ST_IN HReg hregAMD64_XMM11 ( void ) { return mkHReg(False, HRcVec128, 11, 18); }
 ST_IN HReg hregAMD64_XMM12 ( void ) { return mkHReg(False, HRcVec128, 12, 19); }
 
-ST_IN HReg hregAMD64_RAX   ( void ) { return mkHReg(False, HRcInt64,   0, 20); }
-ST_IN HReg hregAMD64_RCX   ( void ) { return mkHReg(False, HRcInt64,   1, 21); }
-ST_IN HReg hregAMD64_RDX   ( void ) { return mkHReg(False, HRcInt64,   2, 22); }
-ST_IN HReg hregAMD64_RSP   ( void ) { return mkHReg(False, HRcInt64,   4, 23); }
-ST_IN HReg hregAMD64_RBP   ( void ) { return mkHReg(False, HRcInt64,   5, 24); }
-ST_IN HReg hregAMD64_R11   ( void ) { return mkHReg(False, HRcInt64,  11, 25); }
+ST_IN HReg hregAMD64_YMM2  ( void ) { return mkHReg(False, HRcVec256,  2, 20); }
+ST_IN HReg hregAMD64_YMM13 ( void ) { return mkHReg(False, HRcVec256, 13, 21); }
+ST_IN HReg hregAMD64_YMM14 ( void ) { return mkHReg(False, HRcVec256, 14, 22); }
+ST_IN HReg hregAMD64_YMM15 ( void ) { return mkHReg(False, HRcVec256, 15, 23); }
+
+ST_IN HReg hregAMD64_RAX   ( void ) { return mkHReg(False, HRcInt64,   0, 24); }
+ST_IN HReg hregAMD64_RCX   ( void ) { return mkHReg(False, HRcInt64,   1, 25); }
+ST_IN HReg hregAMD64_RDX   ( void ) { return mkHReg(False, HRcInt64,   2, 26); }
+ST_IN HReg hregAMD64_RSP   ( void ) { return mkHReg(False, HRcInt64,   4, 27); }
+ST_IN HReg hregAMD64_RBP   ( void ) { return mkHReg(False, HRcInt64,   5, 28); }
+ST_IN HReg hregAMD64_R11   ( void ) { return mkHReg(False, HRcInt64,  11, 29); }
 
-ST_IN HReg hregAMD64_XMM0  ( void ) { return mkHReg(False, HRcVec128,  0, 26); }
-ST_IN HReg hregAMD64_XMM1  ( void ) { return mkHReg(False, HRcVec128,  1, 27); }
+ST_IN HReg hregAMD64_XMM0  ( void ) { return mkHReg(False, HRcVec128,  0, 30); }
+ST_IN HReg hregAMD64_XMM1  ( void ) { return mkHReg(False, HRcVec128,  1, 31); }
 #undef ST_IN
 
 extern UInt ppHRegAMD64 ( HReg );
@@ -347,6 +363,11 @@ typedef
       // Only for F16C capable hosts:
       Asse_F32toF16, // F32 to F16 conversion, aka vcvtps2ph
       Asse_F16toF32, // F16 to F32 conversion, aka vcvtph2ps
+      // Only for AVX2 capable hosts, and only in Ain_AvxReRg:
+      Asse_CMPEQ64, Asse_CMPGT64S,
+      Asse_MAX8S, Asse_MAX16U, Asse_MAX32S, Asse_MAX32U,
+      Asse_MIN8S, Asse_MIN16U, Asse_MIN32S, Asse_MIN32U,
+      Asse_MUL32,
    }
    AMD64SseOp;
 
@@ -409,9 +430,13 @@ typedef
       Ain_SseShuf,     /* SSE2 shuffle (pshufd) */
       Ain_SseShiftN,   /* SSE2 shift by immediate */
       Ain_SseMOVQ,     /* SSE2 moves of xmm[63:0] to/from GPR */
-      //uu Ain_AvxLdSt,     /* AVX load/store 256 bits,
-      //uu                     no alignment constraints */
-      //uu Ain_AvxReRg,     /* AVX binary general reg-reg, Re, Rg */
+      Ain_AvxLdSt,     /* AVX load/store 256 bits,
+                          no alignment constraints */
+      Ain_AvxReRg,     /* AVX2 binary general reg-reg, 3-operand */
+      Ain_AvxShiftN,   /* AVX2 shift by immediate, 3-operand */
+      Ain_AvxFromV128, /* AVX2 concatenate two 128-bit regs */
+      Ain_AvxToV128,   /* AVX2 extract upper or lower 128 bits */
+      Ain_AvxZeroUpper,/* vzeroupper */
       Ain_EvCheck,     /* Event check */
       Ain_ProfInc      /* 64-bit profile counter increment */
    }
@@ -484,12 +509,15 @@ typedef
             AMD64RMI* src;
          } Push;
          /* Pseudo-insn.  Call target (an absolute address), on given
-            condition (which could be Xcc_ALWAYS). */
+            condition (which could be Xcc_ALWAYS).  If zeroUpper is
+            set, a vzeroupper is done first, but only if the call is
+            actually made. */
          struct {
             AMD64CondCode cond;
             Addr64        target;
             Int           regparms; /* 0 .. 6 */
             RetLoc        rloc;     /* where the return value will be */
+            Bool          zeroUpper;
          } Call;
          /* Update the guest RIP value, then exit requesting to chain
             to it.  May be conditional. */
@@ -719,16 +747,42 @@ typedef
             HReg xmm;
             Bool toXMM; // when moving to xmm, xmm[127:64] is zeroed out
          } SseMOVQ;
-         //uu struct {
-         //uu    Bool        isLoad;
-         //uu    HReg        reg;
-         //uu    AMD64AMode* addr;
-         //uu } AvxLdSt;
-         //uu struct {
-         //uu    AMD64SseOp op;
-         //uu    HReg       src;
-         //uu    HReg       dst;
-         //uu } AvxReRg;
+         struct {
+            Bool        isLoad;
+            HReg        reg;
+            AMD64AMode* addr;
+         } AvxLdSt;
+         /* dst = srcL `op` srcR.  For Asse_MOV, srcL is ignored and
+            must be the same as srcR. */
+         struct {
+            AMD64SseOp op;
+            HReg       srcL;
+            HReg       srcR;
+            HReg       dst;
+         } AvxReRg;
+         struct {
+            AMD64SseOp op;
+            UInt       shiftBits;
+            HReg       src;
+            HReg       dst;
+         } AvxShiftN;
+         /* dst[255:128] = srcHi, dst[127:0] = srcLo */
+         struct {
+            HReg srcHi; /* Vec128 */
+            HReg srcLo; /* Vec128 */
+            HReg dst;   /* Vec256 */
+         } AvxFromV128;
+         /* dst = hi ? src[255:128] : src[127:0] */
+         struct {
+            Bool hi;
+            HReg src;   /* Vec256 */
+            HReg dst;   /* Vec128 */
+         } AvxToV128;
+         struct {
+            /* No fields.  Zeroes the upper halves of all %ymm
+               registers, so as to avoid SSE/AVX transition penalties
+               in code we call or jump to. */
+         } AvxZeroUpper;
          struct {
             AMD64AMode* amCounter;
             AMD64AMode* amFailAddr;
@@ -801,8 +855,14 @@ extern AMD64Instr* AMD64Instr_SseShuf    ( Int order, HReg src, HReg dst );
 extern AMD64Instr* AMD64Instr_SseShiftN  ( AMD64SseOp,
                                            UInt shiftBits, HReg dst );
 extern AMD64Instr* AMD64Instr_SseMOVQ    ( HReg gpr, HReg xmm, Bool toXMM );
-//uu extern AMD64Instr* AMD64Instr_AvxLdSt    ( Bool isLoad, HReg, AMD64AMode* );
-//uu extern AMD64Instr* AMD64Instr_AvxReRg    ( AMD64SseOp, HReg, HReg );
+extern AMD64Instr* AMD64Instr_AvxLdSt    ( Bool isLoad, HReg, AMD64AMode* );
+extern AMD64Instr* AMD64Instr_AvxReRg    ( AMD64SseOp, HReg srcL, HReg srcR,
+                                           HReg dst );
+extern AMD64Instr* AMD64Instr_AvxShiftN  ( AMD64SseOp, UInt shiftBits,
+                                           HReg src, HReg dst );
+extern AMD64Instr* AMD64Instr_AvxFromV128 ( HReg srcHi, HReg srcLo, HReg dst );
+extern AMD64Instr* AMD64Instr_AvxToV128  ( Bool hi, HReg src, HReg dst );
+extern AMD64Instr* AMD64Instr_AvxZeroUpper ( void );
 extern AMD64Instr* AMD64Instr_EvCheck    ( AMD64AMode* amCounter,
                                            AMD64AMode* amFailAddr );
 extern AMD64Instr* AMD64Instr_ProfInc    ( void );
@@ -115,9 +115,10 @@ static Bool isZeroU8 ( const IRExpr* e )
 
         - vregmap   holds the primary register for the IRTemp.
         - vregmapHI is only used for 128-bit integer-typed
-             IRTemps.  It holds the identity of a second
-             64-bit virtual HReg, which holds the high half
-             of the value.
+             IRTemps, and for 256-bit vector-typed IRTemps on
+             hosts without AVX2.  It holds the identity of a
+             second 64-bit (resp. 128-bit) virtual HReg, which
+             holds the high half of the value.
 
    - The host subarchitecture we are selecting insns for.  
      This is set at the start and does not change.
@@ -130,6 +131,20 @@ static Bool isZeroU8 ( const IRExpr* e )
      instructions for control flow transfers, or whether we must use
      XAssisted.
 
+   - A Bool indicating whether 256-bit vector values live in single
+     Vec256 (%ymm) registers, which is the case on AVX2 capable
+     hosts, or in pairs of Vec128 registers.
+
+   - A Bool indicating whether an instruction using a %ymm register
+     may have been generated since the last vzeroupper.  If so, we
+     must emit another vzeroupper before calling out or leaving the
+     block, since helpers and the dispatcher are legacy SSE code and
+     would otherwise pay the SSE/AVX transition penalty.  On some
+     hosts, virtualised ones in particular, each transition costs over
+     a hundred nanoseconds.  SSE instructions inside the block do not
+     need one, since they are VEX encoded on such hosts (see
+     amd64_sse_vex).
+
    - The maximum guest address of any guest insn in this block.
      Actually, the address of the highest-addressed byte from any insn
      in this block.  Is set at the start and does not change.  This is
@@ -156,9 +171,12 @@ typedef
       Bool         chainingAllowed;
       Addr64       max_ga;
 
+      Bool         vec256;
+
       /* These are modified as we go along. */
       HInstrArray* code;
       Int          vreg_ctr;
+      Bool         ymmDirty;
    }
    ISelEnv;
 
@@ -182,6 +200,34 @@ static void lookupIRTempPair ( HReg* vrHI, HReg* vrLO,
 
 static void addInstr ( ISelEnv* env, AMD64Instr* instr )
 {
+   switch (instr->tag) {
+      case Ain_Call:
+         /* A call trashes all the %ymm registers anyway, so the
+            vzeroupper costs no extra spills here.  Conditional calls,
+            mostly error reporting ones that are hardly ever made, do
+            it on the taken path only, so as not to clear the upper
+            halves on every pass through the block for nothing.  The
+            state stays dirty for the following code. */
+         if (env->ymmDirty && instr->Ain.Call.cond != Acc_ALWAYS) {
+            instr->Ain.Call.zeroUpper = True;
+            break;
+         }
+         /* fallthrough */
+      case Ain_XDirect: case Ain_XIndir: case Ain_XAssisted:
+         if (env->ymmDirty) {
+            env->ymmDirty = False;
+            addInstr(env, AMD64Instr_AvxZeroUpper());
+         }
+         break;
+      /* Instructions that only read a Vec256 still count: after a
+         vzeroupper their operand has been reloaded by the allocator. */
+      case Ain_AvxLdSt: case Ain_AvxReRg: case Ain_AvxShiftN:
+      case Ain_AvxFromV128: case Ain_AvxToV128:
+         env->ymmDirty = True;
+         break;
+      default:
+         break;
+   }
    addHInstr(env->code, instr);
    if (vex_traceflags & VEX_TRACE_VCODE) {
       ppAMD64Instr(instr, True);
@@ -203,6 +249,14 @@ static HReg newVRegV ( ISelEnv* env )
    return reg;
 }
 
+static HReg newVRegY ( ISelEnv* env )
+{
+   vassert(env->vec256);
+   HReg reg = mkHReg(True/*virtual reg*/, HRcVec256, 0/*enc*/, env->vreg_ctr);
+   env->vreg_ctr++;
+   return reg;
+}
+
 
 /*---------------------------------------------------------*/
 /*--- ISEL: Forward declarations                        ---*/
@@ -254,6 +308,9 @@ static void          iselDVecExpr_wrk ( /*OUT*/HReg* rHi, HReg* rLo,
 static void          iselDVecExpr     ( /*OUT*/HReg* rHi, HReg* rLo, 
                                         ISelEnv* env, const IRExpr* e );
 
+static HReg          iselV256Expr_wrk ( ISelEnv* env, const IRExpr* e );
+static HReg          iselV256Expr     ( ISelEnv* env, const IRExpr* e );
+
 
 /*---------------------------------------------------------*/
 /*--- ISEL: Misc helpers                                ---*/
@@ -336,6 +393,15 @@ static AMD64Instr* mk_vMOVsd_RR ( HReg src, HReg dst )
    return AMD64Instr_SseReRg(Asse_MOV, src, dst);
 }
 
+/* Make a vector (256 bit) reg-reg move. */
+
+static AMD64Instr* mk_yMOVsd_RR ( HReg src, HReg dst )
+{
+   vassert(hregClass(src) == HRcVec256);
+   vassert(hregClass(dst) == HRcVec256);
+   return AMD64Instr_AvxReRg(Asse_MOV, src, src, dst);
+}
+
 /* Advance/retreat %rsp by n. */
 
 static void add_to_rsp ( ISelEnv* env, Int n )
@@ -1718,18 +1784,27 @@ static HReg iselIntExpr_R_wrk ( ISelEnv* env, const IRExpr* e )
          case Iop_V256to64_0: case Iop_V256to64_1:
          case Iop_V256to64_2: case Iop_V256to64_3: {
             HReg vHi, vLo, vec;
-            iselDVecExpr(&vHi, &vLo, env, e->Iex.Unop.arg);
             /* Do the first part of the selection by deciding which of
                the 128 bit registers to look at, and second part using
                the same scheme as for V128{HI}to64 above. */
             Bool low64of128 = True;
+            Bool hi128      = False;
             switch (e->Iex.Unop.op) {
-               case Iop_V256to64_0: vec = vLo; low64of128 = True;  break;
-               case Iop_V256to64_1: vec = vLo; low64of128 = False; break;
-               case Iop_V256to64_2: vec = vHi; low64of128 = True;  break;
-               case Iop_V256to64_3: vec = vHi; low64of128 = False; break;
+               case Iop_V256to64_0: hi128 = False; low64of128 = True;  break;
+               case Iop_V256to64_1: hi128 = False; low64of128 = False; break;
+               case Iop_V256to64_2: hi128 = True;  low64of128 = True;  break;
+               case Iop_V256to64_3: hi128 = True;  low64of128 = False; break;
                default: vassert(0);
             }
+            if (env->vec256) {
+               /* Only extract the half we need. */
+               HReg src = iselV256Expr(env, e->Iex.Unop.arg);
+               vec = newVRegV(env);
+               addInstr(env, AMD64Instr_AvxToV128(hi128, src, vec));
+            } else {
+               iselDVecExpr(&vHi, &vLo, env, e->Iex.Unop.arg);
+               vec = hi128 ? vHi : vLo;
+            }
             HReg dst = newVRegI(env);
             if (low64of128) {
                addInstr(env, AMD64Instr_SseMOVQ(dst, vec, False/*!toXMM*/));
@@ -3475,9 +3550,17 @@ static HReg iselVecExpr_wrk ( ISelEnv* env, const IRExpr* e )
 
       case Iop_V256toV128_0:
       case Iop_V256toV128_1: {
+         Bool hi = e->Iex.Unop.op == Iop_V256toV128_1;
+         if (env->vec256) {
+            /* Only extract the half we need. */
+            HReg src = iselV256Expr(env, e->Iex.Unop.arg);
+            HReg dst = newVRegV(env);
+            addInstr(env, AMD64Instr_AvxToV128(hi, src, dst));
+            return dst;
+         }
          HReg vHi, vLo;
          iselDVecExpr(&vHi, &vLo, env, e->Iex.Unop.arg);
-         return (e->Iex.Unop.op == Iop_V256toV128_1) ? vHi : vLo;
+         return hi ? vHi : vLo;
       }
 
       case Iop_F16toF32x4: {
@@ -4020,6 +4103,17 @@ static void iselDVecExpr_wrk ( /*OUT*/HReg* rHi, /*OUT*/HReg* rLo,
 
    /* read 256-bit IRTemp */
    if (e->tag == Iex_RdTmp) {
+      if (env->vec256) {
+         /* The value lives in a single Vec256 register.  Split it. */
+         HReg src = lookupIRTemp(env, e->Iex.RdTmp.tmp);
+         HReg vHi = newVRegV(env);
+         HReg vLo = newVRegV(env);
+         addInstr(env, AMD64Instr_AvxToV128(True/*hi*/,  src, vHi));
+         addInstr(env, AMD64Instr_AvxToV128(False/*lo*/, src, vLo));
+         *rHi = vHi;
+         *rLo = vLo;
+         return;
+      }
       lookupIRTempPair( rHi, rLo, env, e->Iex.RdTmp.tmp);
       return;
    }
@@ -4631,6 +4725,220 @@ static void iselDVecExpr_wrk ( /*OUT*/HReg* rHi, /*OUT*/HReg* rLo,
 }
 
 
+/*---------------------------------------------------------*/
+/*--- ISEL: SIMD (V256) expressions, into 1 YMM reg.     --*/
+/*---------------------------------------------------------*/
+
+/* This is only used on AVX2 capable hosts (env->vec256).  Operations
+   that have a direct AVX2 equivalent are done with a single 256-bit
+   instruction.  Everything else is done by iselDVecExpr on the two
+   128-bit halves, and the results are glued back together. */
+
+static HReg iselV256Expr ( ISelEnv* env, const IRExpr* e )
+{
+   HReg r = iselV256Expr_wrk( env, e );
+#  if 0
+   vex_printf("\n"); ppIRExpr(e); vex_printf("\n");
+#  endif
+   vassert(hregClass(r) == HRcVec256);
+   vassert(hregIsVirtual(r));
+   return r;
+}
+
+static HReg generate_zeroes_V256 ( ISelEnv* env )
+{
+   HReg dst = newVRegY(env);
+   addInstr(env, AMD64Instr_AvxReRg(Asse_XOR, dst, dst, dst));
+   return dst;
+}
+
+static HReg generate_ones_V256 ( ISelEnv* env )
+{
+   HReg dst = newVRegY(env);
+   addInstr(env, AMD64Instr_AvxReRg(Asse_CMPEQ32, dst, dst, dst));
+   return dst;
+}
+
+
+/* DO NOT CALL THIS DIRECTLY */
+static HReg iselV256Expr_wrk ( ISelEnv* env, const IRExpr* e )
+{
+   vassert(e);
+   vassert(env->vec256);
+   IRType ty = typeOfIRExpr(env->type_env, e);
+   vassert(ty == Ity_V256);
+   UInt laneBits = 0;
+
+   AMD64SseOp op = Asse_INVALID;
+
+   /* read 256-bit IRTemp */
+   if (e->tag == Iex_RdTmp) {
+      return lookupIRTemp(env, e->Iex.RdTmp.tmp);
+   }
+
+   if (e->tag == Iex_Get) {
+      HReg dst = newVRegY(env);
+      AMD64AMode* am = AMD64AMode_IR(e->Iex.Get.offset, hregAMD64_RBP());
+      addInstr(env, AMD64Instr_AvxLdSt(True/*load*/, dst, am));
+      return dst;
+   }
+
+   if (e->tag == Iex_Load && e->Iex.Load.end == Iend_LE) {
+      HReg dst = newVRegY(env);
+      AMD64AMode* am = iselIntExpr_AMode(env, e->Iex.Load.addr);
+      addInstr(env, AMD64Instr_AvxLdSt(True/*load*/, dst, am));
+      return dst;
+   }
+
+   if (e->tag == Iex_Const) {
+      vassert(e->Iex.Const.con->tag == Ico_V256);
+      switch (e->Iex.Const.con->Ico.V256) {
+         case 0x00000000:
+            return generate_zeroes_V256(env);
+         case 0xFFFFFFFF:
+            return generate_ones_V256(env);
+         default:
+            break; /* handled, or not, by iselDVecExpr */
+      }
+   }
+
+   if (e->tag == Iex_Unop) {
+   switch (e->Iex.Unop.op) {
+
+      case Iop_NotV256: {
+         HReg arg  = iselV256Expr(env, e->Iex.Unop.arg);
+         HReg ones = generate_ones_V256(env);
+         HReg dst  = newVRegY(env);
+         addInstr(env, AMD64Instr_AvxReRg(Asse_XOR, arg, ones, dst));
+         return dst;
+      }
+
+      case Iop_CmpNEZ64x4:  op = Asse_CMPEQ64; goto do_CmpNEZ_vector;
+      case Iop_CmpNEZ32x8:  op = Asse_CMPEQ32; goto do_CmpNEZ_vector;
+      case Iop_CmpNEZ16x16: op = Asse_CMPEQ16; goto do_CmpNEZ_vector;
+      case Iop_CmpNEZ8x32:  op = Asse_CMPEQ8;  goto do_CmpNEZ_vector;
+      do_CmpNEZ_vector:
+      {
+         HReg arg  = iselV256Expr(env, e->Iex.Unop.arg);
+         HReg zero = generate_zeroes_V256(env);
+         HReg tmp  = newVRegY(env);
+         addInstr(env, AMD64Instr_AvxReRg(op, arg, zero, tmp));
+         HReg ones = generate_ones_V256(env);
+         HReg dst  = newVRegY(env);
+         addInstr(env, AMD64Instr_AvxReRg(Asse_XOR, tmp, ones, dst));
+         return dst;
+      }
+
+      default:
+         break;
+   } /* switch (e->Iex.Unop.op) */
+   } /* if (e->tag == Iex_Unop) */
+
+   if (e->tag == Iex_Binop) {
+   switch (e->Iex.Binop.op) {
+
+      case Iop_AndV256:     op = Asse_AND;      goto do_AvxReRg;
+      case Iop_OrV256:      op = Asse_OR;       goto do_AvxReRg;
+      case Iop_XorV256:     op = Asse_XOR;      goto do_AvxReRg;
+      case Iop_Add8x32:     op = Asse_ADD8;     goto do_AvxReRg;
+      case Iop_Add16x16:    op = Asse_ADD16;    goto do_AvxReRg;
+      case Iop_Add32x8:     op = Asse_ADD32;    goto do_AvxReRg;
+      case Iop_Add64x4:     op = Asse_ADD64;    goto do_AvxReRg;
+      case Iop_QAdd8Sx32:   op = Asse_QADD8S;   goto do_AvxReRg;
+      case Iop_QAdd16Sx16:  op = Asse_QADD16S;  goto do_AvxReRg;
+      case Iop_QAdd8Ux32:   op = Asse_QADD8U;   goto do_AvxReRg;
+      case Iop_QAdd16Ux16:  op = Asse_QADD16U;  goto do_AvxReRg;
+      case Iop_Avg8Ux32:    op = Asse_AVG8U;    goto do_AvxReRg;
+      case Iop_Avg16Ux16:   op = Asse_AVG16U;   goto do_AvxReRg;
+      case Iop_CmpEQ8x32:   op = Asse_CMPEQ8;   goto do_AvxReRg;
+      case Iop_CmpEQ16x16:  op = Asse_CMPEQ16;  goto do_AvxReRg;
+      case Iop_CmpEQ32x8:   op = Asse_CMPEQ32;  goto do_AvxReRg;
+      case Iop_CmpEQ64x4:   op = Asse_CMPEQ64;  goto do_AvxReRg;
+      case Iop_CmpGT8Sx32:  op = Asse_CMPGT8S;  goto do_AvxReRg;
+      case Iop_CmpGT16Sx16: op = Asse_CMPGT16S; goto do_AvxReRg;
+      case Iop_CmpGT32Sx8:  op = Asse_CMPGT32S; goto do_AvxReRg;
+      case Iop_CmpGT64Sx4:  op = Asse_CMPGT64S; goto do_AvxReRg;
+      case Iop_Max8Sx32:    op = Asse_MAX8S;    goto do_AvxReRg;
+      case Iop_Max16Sx16:   op = Asse_MAX16S;   goto do_AvxReRg;
+      case Iop_Max32Sx8:    op = Asse_MAX32S;   goto do_AvxReRg;
+      case Iop_Max8Ux32:    op = Asse_MAX8U;    goto do_AvxReRg;
+      case Iop_Max16Ux16:   op = Asse_MAX16U;   goto do_AvxReRg;
+      case Iop_Max32Ux8:    op = Asse_MAX32U;   goto do_AvxReRg;
+      case Iop_Min8Sx32:    op = Asse_MIN8S;    goto do_AvxReRg;
+      case Iop_Min16Sx16:   op = Asse_MIN16S;   goto do_AvxReRg;
+      case Iop_Min32Sx8:    op = Asse_MIN32S;   goto do_AvxReRg;
+      case Iop_Min8Ux32:    op = Asse_MIN8U;    goto do_AvxReRg;
+      case Iop_Min16Ux16:   op = Asse_MIN16U;   goto do_AvxReRg;
+      case Iop_Min32Ux8:    op = Asse_MIN32U;   goto do_AvxReRg;
+      case Iop_MulHi16Ux16: op = Asse_MULHI16U; goto do_AvxReRg;
+      case Iop_MulHi16Sx16: op = Asse_MULHI16S; goto do_AvxReRg;
+      case Iop_Mul16x16:    op = Asse_MUL16;    goto do_AvxReRg;
+      case Iop_Mul32x8:     op = Asse_MUL32;    goto do_AvxReRg;
+      case Iop_Sub8x32:     op = Asse_SUB8;     goto do_AvxReRg;
+      case Iop_Sub16x16:    op = Asse_SUB16;    goto do_AvxReRg;
+      case Iop_Sub32x8:     op = Asse_SUB32;    goto do_AvxReRg;
+      case Iop_Sub64x4:     op = Asse_SUB64;    goto do_AvxReRg;
+      case Iop_QSub8Sx32:   op = Asse_QSUB8S;   goto do_AvxReRg;
+      case Iop_QSub16Sx16:  op = Asse_QSUB16S;  goto do_AvxReRg;
+      case Iop_QSub8Ux32:   op = Asse_QSUB8U;   goto do_AvxReRg;
+      case Iop_QSub16Ux16:  op = Asse_QSUB16U;  goto do_AvxReRg;
+      do_AvxReRg:
+      {
+         HReg argL = iselV256Expr(env, e->Iex.Binop.arg1);
+         HReg argR = iselV256Expr(env, e->Iex.Binop.arg2);
+         HReg dst  = newVRegY(env);
+         addInstr(env, AMD64Instr_AvxReRg(op, argL, argR, dst));
+         return dst;
+      }
+
+      case Iop_ShlN16x16: laneBits = 16; op = Asse_SHL16; goto do_AvxShift;
+      case Iop_ShlN32x8:  laneBits = 32; op = Asse_SHL32; goto do_AvxShift;
+      case Iop_ShlN64x4:  laneBits = 64; op = Asse_SHL64; goto do_AvxShift;
+      case Iop_SarN16x16: laneBits = 16; op = Asse_SAR16; goto do_AvxShift;
+      case Iop_SarN32x8:  laneBits = 32; op = Asse_SAR32; goto do_AvxShift;
+      case Iop_ShrN16x16: laneBits = 16; op = Asse_SHR16; goto do_AvxShift;
+      case Iop_ShrN32x8:  laneBits = 32; op = Asse_SHR32; goto do_AvxShift;
+      case Iop_ShrN64x4:  laneBits = 64; op = Asse_SHR64; goto do_AvxShift;
+      do_AvxShift: {
+         /* Only shifts by an in-range immediate are done directly.
+            Anything else is left to iselDVecExpr. */
+         if (e->Iex.Binop.arg2->tag == Iex_Const) {
+            IRConst* c = e->Iex.Binop.arg2->Iex.Const.con;
+            vassert(c->tag == Ico_U8);
+            UInt shift = c->Ico.U8;
+            if (shift < laneBits) {
+               HReg src = iselV256Expr(env, e->Iex.Binop.arg1);
+               HReg dst = newVRegY(env);
+               addInstr(env, AMD64Instr_AvxShiftN(op, shift, src, dst));
+               return dst;
+            }
+         }
+         break;
+      }
+
+      case Iop_V128HLtoV256: {
+         HReg vHi = iselVecExpr(env, e->Iex.Binop.arg1);
+         HReg vLo = iselVecExpr(env, e->Iex.Binop.arg2);
+         HReg dst = newVRegY(env);
+         addInstr(env, AMD64Instr_AvxFromV128(vHi, vLo, dst));
+         return dst;
+      }
+
+      default:
+         break;
+   } /* switch (e->Iex.Binop.op) */
+   } /* if (e->tag == Iex_Binop) */
+
+   /* Fallback: compute the two halves separately, then glue them
+      together. */
+   HReg vHi, vLo;
+   iselDVecExpr(&vHi, &vLo, env, e);
+   HReg dst = newVRegY(env);
+   addInstr(env, AMD64Instr_AvxFromV128(vHi, vLo, dst));
+   return dst;
+}
+
+
 /*---------------------------------------------------------*/
 /*--- ISEL: Statements                                  ---*/
 /*---------------------------------------------------------*/
@@ -4757,6 +5065,12 @@ static void iselStmt ( ISelEnv* env, IRStmt* stmt )
          addInstr(env, AMD64Instr_SseLdSt(False/*store*/, 16, r, am));
          return;
       }
+      if (tyd == Ity_V256 && env->vec256) {
+         AMD64AMode* am = iselIntExpr_AMode(env, stmt->Ist.Store.addr);
+         HReg r = iselV256Expr(env, stmt->Ist.Store.data);
+         addInstr(env, AMD64Instr_AvxLdSt(False/*store*/, r, am));
+         return;
+      }
       if (tyd == Ity_V256) {
          HReg        rA   = iselIntExpr_R(env, stmt->Ist.Store.addr);
          AMD64AMode* am0  = AMD64AMode_IR(0,  rA);
@@ -4816,6 +5130,13 @@ static void iselStmt ( ISelEnv* env, IRStmt* stmt )
          addInstr(env, AMD64Instr_SseLdSt(False/*store*/, 16, vec, am));
          return;
       }
+      if (ty == Ity_V256 && env->vec256) {
+         HReg        vec = iselV256Expr(env, stmt->Ist.Put.data);
+         AMD64AMode* am  = AMD64AMode_IR(stmt->Ist.Put.offset, 
+                                         hregAMD64_RBP());
+         addInstr(env, AMD64Instr_AvxLdSt(False/*store*/, vec, am));
+         return;
+      }
       if (ty == Ity_V256) {
          HReg vHi, vLo;
          iselDVecExpr(&vHi, &vLo, env, stmt->Ist.Put.data);
@@ -4924,6 +5245,12 @@ static void iselStmt ( ISelEnv* env, IRStmt* stmt )
          addInstr(env, mk_vMOVsd_RR(src, dst));
          return;
       }
+      if (ty == Ity_V256 && env->vec256) {
+         HReg dst = lookupIRTemp(env, tmp);
+         HReg src = iselV256Expr(env, stmt->Ist.WrTmp.data);
+         addInstr(env, mk_yMOVsd_RR(src, dst));
+         return;
+      }
       if (ty == Ity_V256) {
          HReg rHi, rLo, dstHi, dstLo;
          iselDVecExpr(&rHi,&rLo, env, stmt->Ist.WrTmp.data);
@@ -5000,6 +5327,13 @@ static void iselStmt ( ISelEnv* env, IRStmt* stmt )
             /* See comments for Ity_V128. */
             vassert(rloc.pri == RLPri_V256SpRel);
             vassert(addToSp >= 32);
+            if (env->vec256) {
+               HReg        dst = lookupIRTemp(env, d->tmp);
+               AMD64AMode* am  = AMD64AMode_IR(rloc.spOff, hregAMD64_RSP());
+               addInstr(env, AMD64Instr_AvxLdSt( True/*load*/, dst, am ));
+               add_to_rsp(env, addToSp);
+               return;
+            }
             HReg        dstLo, dstHi;
             lookupIRTempPair(&dstHi, &dstLo, env, d->tmp);
             AMD64AMode* amLo  = AMD64AMode_IR(rloc.spOff, hregAMD64_RSP());
@@ -5331,6 +5665,14 @@ HInstrArray* iselSB_AMD64 ( const IRSB* bb,
    env->chainingAllowed = chainingAllowed;
    env->hwcaps          = hwcaps_host;
    env->max_ga          = max_ga;
+   env->vec256          = (hwcaps_host & VEX_HWCAPS_AMD64_AVX2) != 0;
+   env->ymmDirty        = False;
+
+   /* On such hosts the SSE instructions are VEX encoded too, so that
+      the ones working on Vec128 values, and on the halves of the
+      Vec256 values not handled natively, cost nothing extra while
+      the upper state is dirty. */
+   amd64_sse_vex = env->vec256;
 
    /* For each IR temporary, allocate a suitably-kinded virtual
       register. */
@@ -5352,8 +5694,12 @@ HInstrArray* iselSB_AMD64 ( const IRSB* bb,
             hreg = mkHReg(True, HRcVec128, 0, j++);
             break;
          case Ity_V256:
-            hreg   = mkHReg(True, HRcVec128, 0, j++);
-            hregHI = mkHReg(True, HRcVec128, 0, j++);
+            if (env->vec256) {
+               hreg = mkHReg(True, HRcVec256, 0, j++);
+            } else {
+               hreg   = mkHReg(True, HRcVec128, 0, j++);
+               hregHI = mkHReg(True, HRcVec128, 0, j++);
+            }
             break;
          default:
             ppIRType(bb->tyenv->types[i]);
@@ -193,7 +193,7 @@ inline
 static void sanity_check_spill_offset ( VRegLR* vreg )
 {
    switch (vreg->reg_class) {
-      case HRcVec128: case HRcFlt64:
+      case HRcVec128: case HRcFlt64: case HRcVec256:
          vassert(0 == ((UShort)vreg->spill_offset % 16)); break;
       default:
          vassert(0 == ((UShort)vreg->spill_offset % 8)); break;
@@ -426,6 +426,7 @@ HInstrArray* doRegisterAllocation_v2 (
    /* --------- and allocate/initialise running state. --------- */
 
    instrs_out = newHInstrArray();
+   regAllocStats.n_vinstrs += instrs_in->arr_used;
 
    /* ... and initialise running state. */
    /* n_rregs is no more than a short name for n_available_real_regs. */
@@ -848,6 +849,25 @@ HInstrArray* doRegisterAllocation_v2 (
             ss_busy_until_before[ss_no+1] = vreg_lrs[j].dead_before;
             break;
 
+         case HRcVec256:
+            /* As above, but four adjacent free slots, starting at a
+               slot number which is zero mod 4. */
+            for (ss_no = 0; ss_no < N_SPILL64S-3; ss_no += 4)
+               if (ss_busy_until_before[ss_no+0] <= vreg_lrs[j].live_after
+                   && ss_busy_until_before[ss_no+1] <= vreg_lrs[j].live_after
+                   && ss_busy_until_before[ss_no+2] <= vreg_lrs[j].live_after
+                   && ss_busy_until_before[ss_no+3] <= vreg_lrs[j].live_after)
+                  break;
+            if (ss_no >= N_SPILL64S-3) {
+               vpanic("LibVEX_N_SPILL_BYTES is too low.  " 
+                      "Increase and recompile.");
+            }
+            ss_busy_until_before[ss_no+0] = vreg_lrs[j].dead_before;
+            ss_busy_until_before[ss_no+1] = vreg_lrs[j].dead_before;
+            ss_busy_until_before[ss_no+2] = vreg_lrs[j].dead_before;
+            ss_busy_until_before[ss_no+3] = vreg_lrs[j].dead_before;
+            break;
+
          default:
             /* The ordinary case -- just find a single spill slot. */
             /* Find the lowest-numbered spill slot which is available
@@ -1156,6 +1176,7 @@ HInstrArray* doRegisterAllocation_v2 (
                      EMIT_INSTR(spill1);
                   if (spill2)
                      EMIT_INSTR(spill2);
+                  regAllocStats.n_spills++;
                }
                rreg_state[k].eq_spill_slot = True;
             }
@@ -1239,6 +1260,7 @@ HInstrArray* doRegisterAllocation_v2 (
             if (reloaded) {
                /* Update info about the insn, so it looks as if it had
                   been in this form all along. */
+               regAllocStats.n_direct_reloads++;
                instrs_in->arr[ii] = reloaded;
                con->getRegUsage(&reg_usage_arr[ii], instrs_in->arr[ii],
                                 con->mode64);
@@ -1332,6 +1354,7 @@ HInstrArray* doRegisterAllocation_v2 (
                   EMIT_INSTR(reload1);
                if (reload2)
                   EMIT_INSTR(reload2);
+               regAllocStats.n_reloads++;
                /* This rreg is read or modified by the instruction.
                   If it's merely read we can claim it now equals the
                   spill slot, but not so if it is modified. */
@@ -1417,6 +1440,7 @@ HInstrArray* doRegisterAllocation_v2 (
                EMIT_INSTR(spill1);
             if (spill2)
                EMIT_INSTR(spill2);
+            regAllocStats.n_spills++;
          }
 
          /* Update the rreg_state to reflect the new assignment for this
@@ -1443,6 +1467,7 @@ HInstrArray* doRegisterAllocation_v2 (
                EMIT_INSTR(reload1);
             if (reload2)
                EMIT_INSTR(reload2);
+            regAllocStats.n_reloads++;
             /* This rreg is read or modified by the instruction.
                If it's merely read we can claim it now equals the
                spill slot, but not so if it is modified. */
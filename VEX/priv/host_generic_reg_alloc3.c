@@ -344,14 +344,35 @@ static inline UInt spill_vreg(
    if (spill2 != NULL) {
       emit_instr(spill2, instrs_out, con, "spill2");
    }
+   regAllocStats.n_spills++;
 
    mark_vreg_spilled(v_idx, vreg_state, n_vregs, rreg_state, n_rregs);
    return r_idx;
 }
 
+/* Is |vreg| mentioned in |reg_usage|? If so, also returns the mode in which
+   it is mentioned. */
+static inline Bool vreg_mode_in(const HRegUsage* reg_usage, HReg vreg,
+                                /*OUT*/HRegMode* mode)
+{
+   for (UInt j = 0; j < reg_usage->n_vRegs; j++) {
+      if (sameHReg(reg_usage->vRegs[j], vreg)) {
+         *mode = reg_usage->vMode[j];
+         return True;
+      }
+   }
+   return False;
+}
+
 /* Chooses a vreg to be spilled based on various criteria.
    The vreg must not be from the instruction being processed, that is, it must
-   not be listed in reg_usage->vRegs. */
+   not be listed in reg_usage->vRegs.
+
+   Spilling a vreg costs a store, unless its rreg is known to be equal to
+   its spill slot, and a reload at its next use, unless that use merely
+   writes it. The vreg chosen is the one whose next use is furthest away,
+   relative to that cost. Ties are broken in favour of the vreg which is
+   used less frequently in the scanned window. */
 static inline HReg find_vreg_to_spill(
    VRegState* vreg_state, UInt n_vregs,
    RRegState* rreg_state, UInt n_rregs,
@@ -372,25 +393,56 @@ static inline HReg find_vreg_to_spill(
 
    HReg vreg_found = INVALID_HREG;
    UInt distance_so_far = 0;
+   UInt cost_so_far = 0;
+   UInt uses_so_far = 0;
 
    for (UInt r_idx = con->univ->allocable_start[target_hregclass];
         r_idx <= con->univ->allocable_end[target_hregclass]; r_idx++) {
       if (rreg_state[r_idx].disp == Bound) {
          HReg vreg = rreg_state[r_idx].vreg;
          if (! HRegUsage__contains(instr_regusage, vreg)) {
-            UInt ii = scan_forward_from;
-            for ( ; ii <= scan_forward_end; ii++) {
-               if (HRegUsage__contains(&reg_usage[ii], vreg)) {
-                  break;
+            UInt next_use    = scan_forward_end + 1;
+            Bool next_reads  = False;
+            UInt n_uses      = 0;
+            for (UInt ii = scan_forward_from; ii <= scan_forward_end; ii++) {
+               HRegMode mode;
+               if (vreg_mode_in(&reg_usage[ii], vreg, &mode)) {
+                  if (n_uses == 0) {
+                     next_use   = ii;
+                     next_reads = mode != HRmWrite;
+                  }
+                  n_uses++;
                }
             }
 
-            if (ii >= distance_so_far) {
-               distance_so_far = ii;
-               vreg_found = vreg;
-               if (distance_so_far == scan_forward_end) {
-                  break; /* We are at the end. Nothing could be better. */
-               }
+            /* A vreg which is not used again in the window may well not be
+               used again at all, so don't count a reload for it. */
+            UInt distance = next_use - scan_forward_from + 1;
+            UInt cost = (rreg_state[r_idx].eq_spill_slot ? 0 : 1)
+                        + (next_reads ? 1 : 0);
+
+            /* Is distance/cost better than distance_so_far/cost_so_far?
+               Zero cost counts as infinitely good. */
+            Bool better;
+            if (hregIsInvalid(vreg_found)) {
+               better = True;
+            } else if (cost == 0 || cost_so_far == 0) {
+               better = (cost == 0 && cost_so_far != 0)
+                        || (cost == cost_so_far
+                            && (distance > distance_so_far
+                                || (distance == distance_so_far
+                                    && n_uses < uses_so_far)));
+            } else {
+               UInt lhs = distance * cost_so_far;
+               UInt rhs = distance_so_far * cost;
+               better = lhs > rhs || (lhs == rhs && n_uses < uses_so_far);
+            }
+
+            if (better) {
+               vreg_found      = vreg;
+               distance_so_far = distance;
+               cost_so_far     = cost;
+               uses_so_far     = n_uses;
             }
          }
       }
@@ -406,6 +458,24 @@ static inline HReg find_vreg_to_spill(
    return vreg_found;
 }
 
+/* Is this rreg free of hard live ranges from instruction ii up to the end
+   of the vreg's (effective) live range? */
+static inline Bool rreg_free_for_vreg(const RRegLRState* rreg_lrs,
+                                      const VRegState* vreg, UInt ii)
+{
+   if (rreg_lrs->lrs_used == 0) {
+      return True;
+   }
+   const RRegLR* lr = rreg_lrs->lr_current;
+   if ((Short) ii >= lr->dead_before) {
+      /* The last hard live range is over; see the post-instruction
+         actions. */
+      return True;
+   }
+   return lr->live_after > (Short) ii
+          && vreg->effective_dead_before <= lr->live_after;
+}
+
 /* Find a free rreg of the correct class.
    Tries to find an rreg whose hard live range (if any) starts after the vreg's
    live range ends. If that is not possible, then at least whose live range
@@ -523,6 +593,8 @@ HInstrArray* doRegisterAllocation_v3(
    /* The output array of instructions. */
    HInstrArray* instrs_out = newHInstrArray();
 
+   regAllocStats.n_vinstrs += instrs_in->arr_used;
+
 
 #  define OFFENDING_VREG(_v_idx, _instr, _mode)                        \
    do {                                                                \
@@ -871,6 +943,24 @@ HInstrArray* doRegisterAllocation_v3(
             ss_busy_until_before[ss_no + 1]
                = vreg_state[v_idx].effective_dead_before;
             break;
+         case HRcVec256:
+            /* Find four adjacent free slots which provide up to 256 bits to
+               spill the vreg, starting at a slot number which is zero
+               mod 4. */
+            for (ss_no = 0; ss_no < N_SPILL64S - 3; ss_no += 4)
+               if (ss_busy_until_before[ss_no + 0] <= vreg_state[v_idx].live_after
+                 && ss_busy_until_before[ss_no + 1] <= vreg_state[v_idx].live_after
+                 && ss_busy_until_before[ss_no + 2] <= vreg_state[v_idx].live_after
+                 && ss_busy_until_before[ss_no + 3] <= vreg_state[v_idx].live_after)
+                  break;
+            if (ss_no >= N_SPILL64S - 3) {
+               vpanic("N_SPILL64S is too low in VEX. Increase and recompile.");
+            }
+            for (UInt k = 0; k < 4; k++) {
+               ss_busy_until_before[ss_no + k]
+                  = vreg_state[v_idx].effective_dead_before;
+            }
+            break;
          default:
             /* The ordinary case -- just find a single lowest-numbered spill
                slot which is available at the start point of this interval,
@@ -895,7 +985,7 @@ HInstrArray* doRegisterAllocation_v3(
 
       /* Independent check that we've made a sane choice of the slot. */
       switch (vreg_state[v_idx].reg_class) {
-      case HRcVec128: case HRcFlt64:
+      case HRcVec128: case HRcFlt64: case HRcVec256:
          vassert((vreg_state[v_idx].spill_offset % 16) == 0);
          break;
       default:
@@ -1129,7 +1219,32 @@ HInstrArray* doRegisterAllocation_v3(
                   UInt v_idx = hregIndex(vreg);
 
                   if (! HRegUsage__contains(&reg_usage[ii], vreg)) {
-                     if (rreg->eq_spill_slot) {
+                     /* The vreg is not used by this instruction. If there is
+                        a free rreg which stays free for the rest of the vreg's
+                        live range, split the live range by moving the vreg
+                        there, rather than spilling it. This keeps values out
+                        of memory across helper calls, which reserve all the
+                        caller-saved rregs at once. */
+                     Int r_free_idx = find_free_rreg(
+                                     vreg_state, n_vregs, rreg_state, n_rregs,
+                                     rreg_lr_state, v_idx, ii,
+                                     vreg_state[v_idx].reg_class, True, con);
+                     if (r_free_idx != INVALID_INDEX
+                         && rreg_free_for_vreg(&rreg_lr_state[r_free_idx],
+                                               &vreg_state[v_idx], ii)) {
+                        HInstr* move = con->genMove(con->univ->regs[r_idx],
+                                     con->univ->regs[r_free_idx], con->mode64);
+                        vassert(move != NULL);
+                        emit_instr(move, instrs_out, con, "split");
+                        regAllocStats.n_moves++;
+
+                        vreg_state[v_idx].rreg = con->univ->regs[r_free_idx];
+                        rreg_state[r_free_idx].disp          = Bound;
+                        rreg_state[r_free_idx].vreg          = vreg;
+                        rreg_state[r_free_idx].eq_spill_slot
+                           = rreg->eq_spill_slot;
+                        FREE_RREG(rreg);
+                     } else if (rreg->eq_spill_slot) {
                         mark_vreg_spilled(v_idx, vreg_state, n_vregs,
                                           rreg_state, n_rregs);
                      } else {
@@ -1147,6 +1262,7 @@ HInstrArray* doRegisterAllocation_v3(
                                       con->univ->regs[r_free_idx], con->mode64);
                      vassert(move != NULL);
                      emit_instr(move, instrs_out, con, "move");
+                     regAllocStats.n_moves++;
 
                      /* Update the register allocator state. */
                      vassert(vreg_state[v_idx].disp == Assigned);
@@ -1229,6 +1345,7 @@ HInstrArray* doRegisterAllocation_v3(
             if (reloaded != NULL) {
                /* Update info about the instruction, so it looks as if it had
                   been in this form all along. */
+               regAllocStats.n_direct_reloads++;
                instr = reloaded;
                instrs_in->arr[ii] = reloaded;
                con->getRegUsage(&reg_usage[ii], instr, con->mode64);
@@ -1298,8 +1415,7 @@ HInstrArray* doRegisterAllocation_v3(
                if (reload2 != NULL) {
                   emit_instr(reload2, instrs_out, con, "reload2");
                }
-
-
+               regAllocStats.n_reloads++;
             }
 
             rreg_state[r_idx].disp          = Bound;
@@ -51,6 +51,7 @@ void ppHRegClass ( HRegClass hrc )
       case HRcFlt64:   vex_printf("HRcFlt64"); break;
       case HRcVec64:   vex_printf("HRcVec64"); break;
       case HRcVec128:  vex_printf("HRcVec128"); break;
+      case HRcVec256:  vex_printf("HRcVec256"); break;
       default: vpanic("ppHRegClass");
    }
 }
@@ -74,6 +75,7 @@ UInt ppHReg ( HReg r )
       case HRcFlt64:   return vex_printf("%%%sD%u", maybe_v, regNN);
       case HRcVec64:   return vex_printf("%%%sv%u", maybe_v, regNN);
       case HRcVec128:  return vex_printf("%%%sV%u", maybe_v, regNN);
+      case HRcVec256:  return vex_printf("%%%sY%u", maybe_v, regNN);
       default: vpanic("ppHReg");
    }
 }
@@ -364,6 +366,13 @@ void ppRetLoc ( RetLoc ska )
 }
 
 
+/*---------------------------------------------------------*/
+/*--- Register allocator statistics                     ---*/
+/*---------------------------------------------------------*/
+
+RegAllocStats regAllocStats;
+
+
 /*---------------------------------------------------------------*/
 /*--- end                                 host_generic_regs.c ---*/
 /*---------------------------------------------------------------*/
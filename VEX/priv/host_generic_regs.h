@@ -102,6 +102,7 @@ typedef  struct { UInt u32; }  HReg;
                              so won't fit in a 64-bit slot)
       HRcVec64     64 bits
       HRcVec128    128 bits
+      HRcVec256    256 bits
 
    If you add another regclass, you must remember to update
    host_generic_reg_alloc*.c and RRegUniverse accordingly.
@@ -117,7 +118,8 @@ typedef
       HRcFlt64=6,     /* 64-bit float */
       HRcVec64=7,     /* 64-bit SIMD */
       HRcVec128=8,    /* 128-bit SIMD */
-      HrcLAST=HRcVec128
+      HRcVec256=9,    /* 256-bit SIMD */
+      HrcLAST=HRcVec256
    }
    HRegClass;
 
@@ -504,6 +506,21 @@ typedef
    }
    RegAllocControl;
 
+/* Statistics about the work done by the register allocators, accumulated
+   over all translations.  Shown by LibVEX_ShowStats. */
+typedef
+   struct {
+      ULong n_guest_insns;    /* guest insns in the translations */
+      ULong n_vinstrs;        /* instructions presented for allocation */
+      ULong n_spills;         /* spill sequences generated */
+      ULong n_reloads;        /* reload sequences generated */
+      ULong n_direct_reloads; /* reloads folded into the using instruction */
+      ULong n_moves;          /* rreg-to-rreg moves generated */
+   }
+   RegAllocStats;
+
+extern RegAllocStats regAllocStats;
+
 extern HInstrArray* doRegisterAllocation_v2(
    HInstrArray* instrs_in,
    const RegAllocControl* con
@@ -609,7 +609,34 @@ static void invalidateOverlaps ( HashHW* h, UInt k_lo, UInt k_hi )
 }
 
 
-static void redundant_get_removal_BB ( IRSB* bb )
+/* Invalidate all env entries overlapping any part of the guest state
+   which the dirty helper |d| declares that it reads (if |reads|) or
+   writes (if !|reads|).  Ifx_Modify counts as both. */
+
+static void invalidateDirtyFx ( HashHW* env, const IRDirty* d, Bool reads )
+{
+   Int j, r;
+   for (j = 0; j < d->nFxState; j++) {
+      IREffect fx = d->fxState[j].fx;
+      if (fx == Ifx_None)
+         continue;
+      if (fx != Ifx_Modify && (fx == Ifx_Read) != reads)
+         continue;
+      for (r = 0; r <= d->fxState[j].nRepeats; r++) {
+         UInt k_lo = d->fxState[j].offset + r * d->fxState[j].repeatLen;
+         UInt k_hi = k_lo + d->fxState[j].size - 1;
+         invalidateOverlaps(env, k_lo, k_hi);
+      }
+   }
+}
+
+
+/* If |useDirtyFx| is set, a dirty helper only invalidates the env
+   entries overlapping the guest state it declares it writes.
+   Otherwise, any helper which writes guest state invalidates the
+   entire env. */
+
+static void redundant_get_removal_BB ( IRSB* bb, Bool useDirtyFx )
 {
    HashHW* env = newHHW();
    UInt    key = 0; /* keep gcc -O happy */
@@ -673,6 +700,14 @@ static void redundant_get_removal_BB ( IRSB* bb )
          invalidateOverlaps(env, k_lo, k_hi);
       }
       else
+      if (st->tag == Ist_Dirty && useDirtyFx) {
+         /* Deal with dirty helpers which write or modify guest state.
+            Invalidate only the env entries overlapping what the
+            helper declares it writes.  A helper is not allowed to
+            write guest state it hasn't declared, so this is safe. */
+         invalidateDirtyFx(env, st->Ist.Dirty.details, False/*writes*/);
+      }
+      else
       if (st->tag == Ist_Dirty) {
          /* Deal with dirty helpers which write or modify guest state.
             Invalidate the entire env.  We could do a lot better
@@ -715,7 +750,8 @@ static void handle_gets_Stmt (
                HashHW* env, 
                IRStmt* st,
                Bool (*preciseMemExnsFn)(Int,Int,VexRegisterUpdates),
-               VexRegisterUpdates pxControl
+               VexRegisterUpdates pxControl,
+               Bool useDirtyFx
             )
 {
    Int     j;
@@ -760,7 +796,24 @@ static void handle_gets_Stmt (
          access guest memory, in which case all parts of the guest
          state requiring precise exceptions needs to be flushed.  The
          crude solution is just to flush everything; we could easily
-         enough do a lot better if needed. */
+         enough do a lot better if needed.
+
+         If |useDirtyFx| is set, do a bit better: flush only what the
+         helper declares it reads, plus everything required for
+         precise exceptions.  The latter is needed even if the helper
+         declares no memory effects, since tool helpers routinely take
+         stack traces, and so read the unwind registers without
+         saying so. */
+      case Ist_Dirty:
+         if (useDirtyFx) {
+            invalidateDirtyFx(env, st->Ist.Dirty.details, True/*reads*/);
+            memRW = True;
+            break;
+         }
+         for (j = 0; j < env->used; j++)
+            env->inuse[j] = False;
+         break;
+
       /* Probably also overly-conservative, but also dump everything
          if we hit a memory bus event (fence, lock, unlock).  Ditto
          AbiHints, CASs, LLs and SCs. */
@@ -769,7 +822,6 @@ static void handle_gets_Stmt (
          vassert(isIRAtom(st->Ist.AbiHint.nia));
          /* fall through */
       case Ist_MBE:
-      case Ist_Dirty:
       case Ist_CAS:
       case Ist_LLSC:
          for (j = 0; j < env->used; j++)
@@ -877,13 +929,14 @@ static void handle_gets_Stmt (
    On seeing 'Get (minoff,maxoff)', remove any part of the set
    overlapping (minoff,maxoff).  The same has to happen for any events
    which implicitly read parts of the guest state: dirty helper calls
-   and loads/stores.
+   and loads/stores.  |useDirtyFx| is passed on to handle_gets_Stmt.
 */
 
 static void redundant_put_removal_BB ( 
                IRSB* bb,
                Bool (*preciseMemExnsFn)(Int,Int,VexRegisterUpdates),
-               VexRegisterUpdates pxControl
+               VexRegisterUpdates pxControl,
+               Bool useDirtyFx
             )
 {
    Int     i, j;
@@ -983,7 +1036,7 @@ static void redundant_put_removal_BB (
          of the guest state is no longer a write, but a read.  Also
          deals with implicit reads of guest state needed to maintain
          precise exceptions. */
-      handle_gets_Stmt( env, st, preciseMemExnsFn, pxControl );
+      handle_gets_Stmt( env, st, preciseMemExnsFn, pxControl, useDirtyFx );
    }
 }
 
@@ -6515,14 +6568,15 @@ IRSB* cheap_transformations (
          VexRegisterUpdates pxControl
       )
 {
-   redundant_get_removal_BB ( bb );
+   redundant_get_removal_BB ( bb, False/*!useDirtyFx*/ );
    if (iropt_verbose) {
       vex_printf("\n========= REDUNDANT GET\n\n" );
       ppIRSB(bb);
    }
 
    if (pxControl < VexRegUpdAllregsAtEachInsn) {
-      redundant_put_removal_BB ( bb, preciseMemExnsFn, pxControl );
+      redundant_put_removal_BB ( bb, preciseMemExnsFn, pxControl,
+                                 False/*!useDirtyFx*/ );
    }
    if (iropt_verbose) {
       vex_printf("\n========= REDUNDANT PUT\n\n" );
@@ -6735,7 +6789,8 @@ IRSB* do_iropt_BB(
       bb = cprop_BB(bb);
       bb = spec_helpers_BB ( bb, specHelper );
       if (pxControl < VexRegUpdAllregsAtEachInsn) {
-         redundant_put_removal_BB ( bb, preciseMemExnsFn, pxControl );
+         redundant_put_removal_BB ( bb, preciseMemExnsFn, pxControl,
+                                 False/*!useDirtyFx*/ );
       }
       do_cse_BB( bb, False/*!allowLoadsToBeCSEd*/ );
       do_deadcode_BB( bb );
@@ -6803,6 +6858,29 @@ IRSB* do_iropt_BB(
    return bb;
 }
 
+/* Post-instrumentation cleanup of guest state accesses.  Tools add
+   many Gets and Puts, mostly of the shadow guest state, after the
+   main optimisation round has run, and the usual post-instrumentation
+   cprop/deadcode passes can't remove those.  Here, forward Put and
+   Get values to later Gets of the same state, and remove Puts which
+   are overwritten before being read.  Dirty helpers are treated
+   according to their declared guest state effects, rather than
+   conservatively, since tools call them very frequently.  bb is
+   destructively modified. */
+void do_post_instr_GetPut_removal_BB (
+        IRSB* bb,
+        Bool (*preciseMemExnsFn)(Int,Int,VexRegisterUpdates),
+        VexRegisterUpdates pxControl
+     )
+{
+   vassert(isFlatIRSB(bb));
+   redundant_get_removal_BB( bb, True/*useDirtyFx*/ );
+   if (pxControl < VexRegUpdAllregsAtEachInsn) {
+      redundant_put_removal_BB( bb, preciseMemExnsFn, pxControl,
+                                True/*useDirtyFx*/ );
+   }
+}
+
 IRSB* do_minimal_initial_iropt_BB(IRSB* bb0) {
    /* First flatten the block out, since all other phases assume flat code. */
    IRSB* bb = flatten_BB ( bb0 );
@@ -6813,7 +6891,7 @@ IRSB* do_minimal_initial_iropt_BB(IRSB* bb0) {
    }
 
    // Remove redundant GETs
-   redundant_get_removal_BB ( bb );
+   redundant_get_removal_BB ( bb, False/*!useDirtyFx*/ );
 
    // Do minimal constant prop: copy prop and constant prop only.  No folding.
    // JRS FIXME 2019Nov25: this is too weak to be effective on arm32.  For that,
@@ -59,6 +59,16 @@ IRSB* cprop_BB ( IRSB* );
 extern
 void do_deadcode_BB ( IRSB* bb );
 
+/* Remove redundant Gets and Puts from instrumented IR, making use of
+   the declared guest state effects of dirty helpers.  bb must be flat,
+   and is destructively modified. */
+extern
+void do_post_instr_GetPut_removal_BB (
+        IRSB* bb,
+        Bool (*preciseMemExnsFn)(Int,Int,VexRegisterUpdates),
+        VexRegisterUpdates pxControl
+     );
+
 /* The tree-builder.  Make (approximately) maximal safe trees.  bb is
    destructively modified.  Returns (unrelatedly, but useful later on)
    the guest address of the highest addressed byte from any insn in
@@ -193,6 +193,7 @@ void LibVEX_default_VexControl ( /*OUT*/ VexControl* vcon )
    vcon->guest_max_insns                = 60;
    vcon->guest_chase                    = True;
    vcon->regalloc_version               = 3;
+   vcon->iropt_post_instr               = True;
 }
 
 
@@ -705,6 +706,11 @@ IRSB* LibVEX_FrontEnd ( /*MOD*/ VexTranslateArgs* vta,
    if (vta->instrument1 || vta->instrument2) {
       do_deadcode_BB( irsb );
       irsb = cprop_BB( irsb );
+      if (vex_control.iropt_level > 0 && vex_control.iropt_post_instr) {
+         do_post_instr_GetPut_removal_BB( irsb, preciseMemExnsFn,
+                                          *pxControl );
+         irsb = cprop_BB( irsb );
+      }
       do_deadcode_BB( irsb );
       sanityCheckIRSB( irsb, "after post-instrumentation cleanup",
                        True/*must be flat*/, guest_word_type );
@@ -1135,6 +1141,7 @@ static void libvex_BackEnd ( const VexTranslateArgs *vta,
    default:
       vassert(0);
    }
+   regAllocStats.n_guest_insns += res->n_guest_instrs;
 
    vexAllocSanityCheck();
 
@@ -1438,6 +1445,31 @@ VexInvalRange LibVEX_PatchProfInc ( VexArch    arch_host,
 }
 
 
+/* --------- Accumulated statistics. --------- */
+
+/* Show a count as a ratio of two others, to two decimal places.  No
+   floating point, since this gets called from contexts (eg,
+   Valgrind's core) which don't want to touch the FPU. */
+static void show_per ( const HChar* what, ULong n, ULong per )
+{
+   ULong x100 = per == 0 ? 0 : (100 * n) / per;
+   vex_printf("   %-16s %12llu  (%llu.%02llu per guest insn)\n",
+              what, n, x100 / 100, x100 % 100);
+}
+
+void LibVEX_ShowStats ( void )
+{
+   const RegAllocStats* st = &regAllocStats;
+   vex_printf("vex regalloc: v%u, %llu guest insns, %llu vinstrs\n",
+              vex_control.regalloc_version,
+              st->n_guest_insns, st->n_vinstrs);
+   show_per("spills:",         st->n_spills,         st->n_guest_insns);
+   show_per("reloads:",        st->n_reloads,        st->n_guest_insns);
+   show_per("direct reloads:", st->n_direct_reloads, st->n_guest_insns);
+   show_per("reg-reg moves:",  st->n_moves,          st->n_guest_insns);
+}
+
+
 /* --------- Emulation warnings. --------- */
 
 const HChar* LibVEX_EmNote_string ( VexEmNote ew )
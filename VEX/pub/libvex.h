@@ -551,6 +551,10 @@ typedef
          - '3': current, faster implementation; perhaps producing slightly worse
                 spilling decisions. */
       UInt regalloc_version;
+      /* Should iropt remove redundant Gets and Puts, as far as
+         helper-declared guest state effects allow, from IR after
+         it has been instrumented?  Default=True. */
+      Bool iropt_post_instr;
    }
    VexControl;
 
@@ -2750,6 +2750,50 @@ void* VG_(am_shadow_alloc)(SizeT size)
    return sr_isError(sres) ? NULL : (void*)(Addr)sr_Res(sres);
 }
 
+Bool VG_(am_advise_hugepages)(Addr start, SizeT len)
+{
+#  if defined(VGO_linux)
+   Addr   first = VG_ROUNDUP(start, VG_HUGEPAGE_SZB);
+   Addr   last  = VG_ROUNDDN(start + len, VG_HUGEPAGE_SZB);
+   SysRes sres;
+
+   if (first >= last)
+      return False;
+   sres = VG_(do_syscall3)(__NR_madvise, first, last - first,
+                           VKI_MADV_HUGEPAGE);
+   return !sr_isError(sres);
+#  else
+   return False;
+#  endif
+}
+
+/* Map one huge page more than asked for, and unmap what is around the
+   aligned part. */
+
+void* VG_(am_shadow_alloc_huge)(SizeT size)
+{
+   SysRes sres;
+   Addr   start, aligned, end;
+
+   aspacem_assert(size > 0 && size % VG_HUGEPAGE_SZB == 0);
+   sres = VG_(am_mmap_anon_float_valgrind)( size + VG_HUGEPAGE_SZB );
+   if (sr_isError(sres))
+      return NULL;
+   start   = sr_Res(sres);
+   end     = start + size + VG_HUGEPAGE_SZB;
+   aligned = VG_ROUNDUP(start, VG_HUGEPAGE_SZB);
+   if (aligned > start) {
+      sres = VG_(am_munmap_valgrind)( start, aligned - start );
+      aspacem_assert(!sr_isError(sres));
+   }
+   if (end > aligned + size) {
+      sres = VG_(am_munmap_valgrind)( aligned + size, end - aligned - size );
+      aspacem_assert(!sr_isError(sres));
+   }
+   (void)VG_(am_advise_hugepages)( aligned, size );
+   return (void*)aligned;
+}
+
 /* Map a file at an unconstrained address for V, and update the
    segment array accordingly. Use the provided flags */
 
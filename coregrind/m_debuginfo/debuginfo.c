@@ -107,6 +107,7 @@
 /*------------------------------------------------------------*/
 
 static void caches__invalidate (void);
+static void load_deferred_DebugInfo ( DebugInfo* di );
 
 
 /*------------------------------------------------------------*/
@@ -335,6 +336,9 @@ static void free_DebugInfo ( DebugInfo* di )
    GExpr* gexpr;
 
    vg_assert(di != NULL);
+#  if defined(VGO_linux) || defined(VGO_solaris) || defined(VGO_freebsd)
+   if (di->deferred)     ML_(discard_elf_deferred_debug_info)(di);
+#  endif
    if (di->fsm.maps)     VG_(deleteXA)(di->fsm.maps);
    if (di->fsm.filename) ML_(dinfo_free)(di->fsm.filename);
    if (di->fsm.dbgname)  ML_(dinfo_free)(di->fsm.dbgname);
@@ -471,6 +475,11 @@ static void discard_or_archive_DebugInfo ( DebugInfo* di )
             VG_(redir_notify_delete_DebugInfo)( curr );
          }
          if (archive) {
+            /* The object's files may well be gone by the time the
+               archived info is queried, so read what is still missing
+               now. */
+            if (di->deferred)
+               load_deferred_DebugInfo(di);
             /* Adjust the epoch markers appropriately. */
             di->last_epoch = VG_(current_DiEpoch)();
             VG_(archive_ExeContext_in_range) (di->last_epoch,
@@ -1023,6 +1032,30 @@ static ULong di_notify_ACHIEVE_ACCEPT_STATE ( struct _DebugInfo* di )
 }
 
 
+/* Read the debug info of |di| whose reading was deferred when it
+   became active, because it is now needed.  This is the second half of
+   di_notify_ACHIEVE_ACCEPT_STATE, done lazily. */
+static void load_deferred_DebugInfo ( DebugInfo* di )
+{
+   vg_assert(di->deferred);
+   vg_assert(di->have_dinfo);
+
+#  if defined(VGO_linux) || defined(VGO_solaris) || defined(VGO_freebsd)
+   (void) ML_(read_elf_deferred_debug_info)( di );
+#  else
+   vg_assert(0);
+#  endif
+   vg_assert(!di->deferred);
+
+   /* Whatever was cached about addresses in di, and in particular
+      that there is no CFI for them, may be wrong now. */
+   caches__invalidate();
+   ML_(canonicaliseDeferredTables)( di );
+   check_CFSI_related_invariants(di);
+   ML_(finish_CFSI_arrays)(di);
+}
+
+
 /* Notify the debuginfo system about a new mapping.  This is the way
    new debug information gets loaded.
 
@@ -2107,6 +2140,8 @@ static void search_all_loctabs ( DiEpoch ep, Addr ptr,
           && di->text_size > 0
           && di->text_avma <= ptr 
           && ptr < di->text_avma + di->text_size) {
+         if (di->deferred)
+            load_deferred_DebugInfo(di);
          lno = ML_(search_one_loctab) ( di, ptr );
          if (lno == -1) goto not_found;
          *locno = lno;
@@ -3064,6 +3099,12 @@ static void find_DiCfSI ( /*OUT*/DebugInfo** diP,
       if (!is_DI_valid_for_epoch(di, curr_epoch))
          continue;
 
+      /* If the CFI of the object covering ip has not been read yet,
+         it is needed now. */
+      if (UNLIKELY(di->deferred)
+          && ML_(find_rx_mapping)(di, ip, ip) != NULL)
+         load_deferred_DebugInfo(di);
+
       /* Use the per-DebugInfo summary address ranges to skip
          inapplicable DebugInfos quickly. */
       if (di->cfsi_used == 0)
@@ -3181,8 +3222,9 @@ static inline CFSI_m_CacheEnt* cfsi_m_cache__find ( Addr ip )
 #     ifdef N_Q_M_STATS
       n_m++;
 #     endif
-      ce->ip = ip;
+      /* Set ce->ip last: find_DiCfSI may invalidate the cache. */
       find_DiCfSI( &ce->di, &ce->cfsi_m, ip );
+      ce->ip = ip;
    }
 
    if (UNLIKELY(ce->di == (DebugInfo*)1)) {
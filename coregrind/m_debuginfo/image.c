@@ -1069,13 +1069,66 @@ void ML_(img_free)(DiImage* img)
    ML_(dinfo_free)(img);
 }
 
+/* Release the cache entries of |img|, leaving it with none. */
+static void free_all_CEnts ( DiImage* img )
+{
+   UInt i;
+   vg_assert(img->ces_used <= CACHE_N_ENTRIES);
+   for (i = 0; i < img->ces_used; i++) {
+      ML_(dinfo_free)(img->ces[i]);
+      img->ces[i] = NULL;
+   }
+   img->ces_used = 0;
+}
+
+void ML_(img_detach)(DiImage* img)
+{
+   vg_assert(img != NULL);
+   vg_assert(img->source.is_local);
+   vg_assert(img->source.fd >= 0);
+   VG_(close)(img->source.fd);
+   img->source.fd = -1;
+   free_all_CEnts(img);
+}
+
+Bool ML_(img_reattach)(DiImage* img)
+{
+   SysRes         fd;
+   struct vg_stat stat_buf;
+
+   vg_assert(img != NULL);
+   vg_assert(img->source.is_local);
+   vg_assert(img->source.fd == -1);
+   vg_assert(img->ces_used == 0);
+
+   fd = VG_(open)(img->source.name, VKI_O_RDONLY, 0);
+   if (sr_isError(fd))
+      return False;
+
+   /* This is no proof that the file is the one we detached from, but
+      it catches the common case of it having been replaced by a
+      different version. */
+   if (VG_(fstat)(sr_Res(fd), &stat_buf) != 0
+       || stat_buf.size != (DiOffT)img->real_size) {
+      VG_(close)(sr_Res(fd));
+      return False;
+   }
+
+   img->source.fd = sr_Res(fd);
+   UInt entNo = alloc_CEnt(img, CACHE_ENTRY_SIZE, False/*!fromC*/);
+   vg_assert(entNo == 0);
+   set_CEnt(img, 0, 0);
+   return True;
+}
+
 void ML_(img_done)(DiImage* img)
 {
    vg_assert(img != NULL);
    if (img->source.is_local) {
-      /* Close the file; nothing else to do. */
+      /* Close the file, unless detached; nothing else to do. */
       vg_assert(img->source.session_id == 0);
-      VG_(close)(img->source.fd);
+      if (img->source.fd >= 0)
+         VG_(close)(img->source.fd);
    } else {
       /* Close the socket.  The server can detect this and will scrub
          the connection when it happens, so there's no need to tell it
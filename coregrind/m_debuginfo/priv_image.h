@@ -77,6 +77,19 @@ void ML_(img_free)(DiImage*);
 /* Destroy an existing image. */
 void ML_(img_done)(DiImage*);
 
+/* Disconnect an image from its file, releasing the file descriptor
+   and the cache, but keeping what is needed to reconnect it later with
+   ML_(img_reattach).  Offsets into the image, including those of
+   compressed parts marked in it, remain valid across the two.  While
+   detached, the image may only be reattached or destroyed.  Only
+   images of local files can be detached. */
+void ML_(img_detach)(DiImage*);
+
+/* Reconnect an image detached by ML_(img_detach).  Returns False if
+   the file can no longer be opened, or has changed size meanwhile; the
+   image then stays detached. */
+Bool ML_(img_reattach)(DiImage*);
+
 /* Virtual size of the image. */
 DiOffT ML_(img_size)(const DiImage* img);
 
@@ -52,6 +52,16 @@ extern Bool ML_(is_elf_object_file)( const void* image, SizeT n_image,
 */
 extern Bool ML_(read_elf_debug_info) ( DebugInfo* di );
 
+/* Read the CFI and DWARF line number and inlined call info whose reading
+   ML_(read_elf_debug_info) deferred (di->deferred != NULL), into the
+   (still uncanonicalised) tables of |di|.  Returns False, leaving the
+   tables empty, if the object's files cannot be accessed any more.  In
+   both cases di->deferred is NULL afterwards. */
+extern Bool ML_(read_elf_deferred_debug_info) ( DebugInfo* di );
+
+/* Drop the record of deferred reading for |di|, without reading. */
+extern void ML_(discard_elf_deferred_debug_info) ( DebugInfo* di );
+
 extern Bool ML_(check_elf_and_get_rw_loads) ( Int fd, const HChar* filename, Int * rw_load_count );
 
 
@@ -678,6 +678,13 @@ struct _DebugInfo {
       invalid and should not be consulted. */
    Bool  have_dinfo; /* initially False */
 
+   /* If not NULL, reading the CFI and the DWARF line number and inlined
+      call info has been deferred until they are first needed
+      (--lazy-debuginfo=yes).  Until then the tables holding them are
+      empty, and this records where to find them in the object's files.
+      See ML_(read_elf_deferred_debug_info). */
+   struct _ElfDebugSects* deferred;
+
    /* All the rest of the fields in this structure are filled in once
       we have committed to reading the symbols and debug info (that
       is, at the point where .have_dinfo is set to True). */
@@ -1142,6 +1149,12 @@ extern void ML_(addVar)( struct _DebugInfo* di,
    this after finishing adding entries to these tables. */
 extern void ML_(canonicaliseTables) ( struct _DebugInfo* di );
 
+/* Canonicalise all tables but the symbol table, and freeze the pools.
+   Done by ML_(canonicaliseTables), except when the reading of these
+   tables has been deferred (di->deferred), in which case it must be
+   called after the deferred reading. */
+extern void ML_(canonicaliseDeferredTables) ( struct _DebugInfo* di );
+
 /* Canonicalise the call-frame-info table held by 'di', in preparation
    for use. This is called by ML_(canonicaliseTables) but can also be
    called on it's own to sort just this table. */
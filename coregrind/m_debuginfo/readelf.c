@@ -1836,6 +1836,217 @@ static HChar* readlink_path (const HChar *path)
   return buf;
 }
 
+/* The sections holding the call frame info and the DWARF debug info of
+   an ELF object, along with the images (main, debug and alt debug file)
+   they were found in.  See ML_(read_elf_debug_info) for what each is. */
+struct _ElfDebugSects {
+   DiImage* mimg;
+   DiImage* dimg;
+   DiImage* aimg;
+   DiSlice  ehframe_escn[N_EHFRAME_SECTS];
+   DiSlice  debug_frame_escn;
+   DiSlice  debug_info_escn;
+   DiSlice  debug_types_escn;
+   DiSlice  debug_abbv_escn;
+   DiSlice  debug_line_escn;
+   DiSlice  debug_str_escn;
+   DiSlice  debug_line_str_escn;
+   DiSlice  debug_ranges_escn;
+   DiSlice  debug_rnglists_escn;
+   DiSlice  debug_loclists_escn;
+   DiSlice  debug_loc_escn;
+   DiSlice  debug_addr_escn;
+   DiSlice  debug_str_offsets_escn;
+   DiSlice  debug_info_alt_escn;
+   DiSlice  debug_abbv_alt_escn;
+   DiSlice  debug_line_alt_escn;
+   DiSlice  debug_str_alt_escn;
+};
+typedef  struct _ElfDebugSects  ElfDebugSects;
+
+/* Read the call frame info, and the line number, inlined call and
+   variable info, from the sections in |s|, whose images must be
+   attached. */
+static void read_elf_debug_sects ( struct _DebugInfo* di,
+                                   const ElfDebugSects* s )
+{
+   Word i;
+
+   /* Read .eh_frame and .debug_frame (call-frame-info) if any.  Do
+      the .eh_frame section(s) first. */
+   vg_assert(di->n_ehframe >= 0 && di->n_ehframe <= N_EHFRAME_SECTS);
+   for (i = 0; i < di->n_ehframe; i++) {
+      /* see Comment_on_EH_FRAME_MULTIPLE_INSTANCES in
+         ML_(read_elf_debug_info) for why this next assertion should
+         hold. */
+      vg_assert(ML_(sli_is_valid)(s->ehframe_escn[i]));
+      vg_assert(s->ehframe_escn[i].szB == di->ehframe_size[i]);
+      ML_(read_callframe_info_dwarf3)( di,
+                                       s->ehframe_escn[i],
+                                       di->ehframe_avma[i],
+                                       True/*is_ehframe*/ );
+   }
+   if (ML_(sli_is_valid)(s->debug_frame_escn)) {
+      ML_(read_callframe_info_dwarf3)( di,
+                                       s->debug_frame_escn,
+                                       0/*assume zero avma*/,
+                                       False/*!is_ehframe*/ );
+   }
+
+   /* jrs 2006-01-01: icc-8.1 has been observed to generate
+      binaries without debug_str sections.  Don't preclude
+      debuginfo reading for that reason, but, in
+      read_unitinfo_dwarf2, do check that debugstr is non-NULL
+      before using it. */
+   if (ML_(sli_is_valid)(s->debug_info_escn) 
+       && ML_(sli_is_valid)(s->debug_abbv_escn)
+       && ML_(sli_is_valid)(s->debug_line_escn)) {
+      /* The old reader: line numbers and unwind info only */
+      ML_(read_debuginfo_dwarf3) ( di,
+                                   s->debug_info_escn,
+                                   s->debug_types_escn,
+                                   s->debug_abbv_escn,
+                                   s->debug_line_escn,
+                                   s->debug_str_escn,
+                                   s->debug_str_alt_escn,
+                                   s->debug_line_str_escn);
+      /* The new reader: read the DIEs in .debug_info to acquire
+         information on variable types and locations or inline info.
+         But only if the tool asks for it, or the user requests it on
+         the command line. */
+      if (VG_(clo_read_var_info) /* the user or tool asked for it */
+          || VG_(clo_read_inline_info)) {
+         ML_(new_dwarf3_reader)(
+            di, s->debug_info_escn,     s->debug_types_escn,
+                s->debug_abbv_escn,     s->debug_line_escn,
+                s->debug_str_escn,      s->debug_ranges_escn,
+                s->debug_rnglists_escn, s->debug_loclists_escn,
+                s->debug_loc_escn,      s->debug_info_alt_escn,
+                s->debug_abbv_alt_escn, s->debug_line_alt_escn,
+                s->debug_str_alt_escn,  s->debug_line_str_escn,
+                s->debug_addr_escn,     s->debug_str_offsets_escn
+         );
+      }
+   }
+
+   // JRS 31 July 2014: dwarf-1 reading is currently broken and
+   // therefore deactivated.
+   //if (dwarf1d_img && dwarf1l_img) {
+   //   ML_(read_debuginfo_dwarf1) ( di, dwarf1d_img, dwarf1d_sz, 
+   //                                    dwarf1l_img, dwarf1l_sz );
+   //}
+
+#  if defined(VGA_arm)
+   /* ARM32 only: read .exidx/.extab if present.  Note we are
+      reading these directly out of the mapped in (running) image.
+      Also, read these only if no CFI based unwind info was
+      acquired for this file.
+
+      An .exidx section is always required, but the .extab section
+      can be optionally omitted, provided that .exidx does not
+      refer to it.  If the .exidx is erroneous and does refer to
+      .extab even though .extab is missing, the range checks done
+      by GET_EX_U32 in ExtabEntryExtract in readexidx.c should
+      prevent any invalid memory accesses, and cause the .extab to
+      be rejected as invalid.
+
+      FIXME:
+      * check with m_aspacemgr that the entire [exidx_avma, +exidx_size)
+        and [extab_avma, +extab_size) areas are readable, since we're
+        reading this stuff out of the running image (not from a file/socket)
+        and we don't want to segfault.
+      * DebugInfo::exidx_bias and use text_bias instead.
+        I think it's always the same.
+      * remove DebugInfo::{extab_bias, exidx_svma, extab_svma} since
+        they are never used.
+   */
+   if (di->exidx_present
+       && di->cfsi_used == 0
+       && di->text_present && di->text_size > 0) {
+      Addr text_last_svma = di->text_svma + di->text_size - 1;
+      ML_(read_exidx)( di, (UChar*)di->exidx_avma, di->exidx_size,
+                           (UChar*)di->extab_avma, di->extab_size,
+                           text_last_svma,
+                           di->exidx_bias );
+   }
+#  endif /* defined(VGA_arm) */
+}
+
+/* Decide whether the reading of the sections in |s| can be deferred
+   until their contents are first needed.  If so, detach their images
+   and hand them, along with a copy of |s|, over to |di|. */
+static Bool defer_elf_debug_sects ( struct _DebugInfo* di,
+                                    const ElfDebugSects* s )
+{
+   if (!VG_(clo_lazy_debuginfo))
+      return False;
+   /* Variable info is looked up by data address, and global variables
+      can be anywhere, so there is no way to tell when it is needed. */
+   if (VG_(clo_read_var_info))
+      return False;
+   /* Reading transcripts are expected to show up at load time. */
+   if (di->trace_symtab || di->trace_cfi || di->ddump_line || di->ddump_frames)
+      return False;
+   /* Images from the debuginfo server cannot be detached. */
+   if (VG_(clo_debuginfo_server) != NULL)
+      return False;
+   /* Nothing worth deferring? */
+   if (di->n_ehframe == 0
+       && !ML_(sli_is_valid)(s->debug_frame_escn)
+       && !ML_(sli_is_valid)(s->debug_info_escn))
+      return False;
+
+   vg_assert(s->mimg != NULL);
+   vg_assert(di->deferred == NULL);
+   di->deferred = ML_(dinfo_zalloc)("di.readelf.defer.1", sizeof(*s));
+   *di->deferred = *s;
+   ML_(img_detach)(s->mimg);
+   if (s->dimg) ML_(img_detach)(s->dimg);
+   if (s->aimg) ML_(img_detach)(s->aimg);
+
+   if (VG_(clo_verbosity) > 1)
+      VG_(message)(Vg_DebugMsg, "   deferring CFI and DWARF info of %s\n",
+                                di->fsm.filename);
+   return True;
+}
+
+void ML_(discard_elf_deferred_debug_info) ( struct _DebugInfo* di )
+{
+   ElfDebugSects* s = di->deferred;
+   vg_assert(s != NULL);
+   ML_(img_done)(s->mimg);
+   if (s->dimg) ML_(img_done)(s->dimg);
+   if (s->aimg) ML_(img_done)(s->aimg);
+   ML_(dinfo_free)(s);
+   di->deferred = NULL;
+}
+
+Bool ML_(read_elf_deferred_debug_info) ( struct _DebugInfo* di )
+{
+   ElfDebugSects* s = di->deferred;
+   Bool ok;
+
+   vg_assert(s != NULL);
+   if (VG_(clo_verbosity) > 1)
+      VG_(message)(Vg_DebugMsg, "Reading deferred CFI and DWARF info"
+                                " from %s\n", di->fsm.filename);
+
+   ok = ML_(img_reattach)(s->mimg)
+        && (s->dimg == NULL || ML_(img_reattach)(s->dimg))
+        && (s->aimg == NULL || ML_(img_reattach)(s->aimg));
+   if (ok) {
+      read_elf_debug_sects(di, s);
+   } else {
+      VG_(message)(Vg_UserMsg, "warning: can no longer read %s\n",
+                               di->fsm.filename);
+      VG_(message)(Vg_UserMsg, "         no unwind or line number info"
+                               " loaded\n");
+   }
+
+   ML_(discard_elf_deferred_debug_info)(di);
+   return ok;
+}
+
 /* The central function for reading ELF debug info.  For the
    object/exe specified by the DebugInfo, find ELF sections, then read
    the symbols, line number info, file name info, CFA (stack-unwind
@@ -1938,6 +2149,7 @@ Bool ML_(read_elf_debug_info) ( struct _DebugInfo* di )
    vg_assert(!di->strpool);
    vg_assert(!di->fndnpool);
    vg_assert(!di->soname);
+   vg_assert(!di->deferred);
 
    {
       Bool has_nonempty_rx = False;
@@ -3500,107 +3712,41 @@ Bool ML_(read_elf_debug_info) ( struct _DebugInfo* di )
       }
 
       /* TOPLEVEL */
-      /* Read .eh_frame and .debug_frame (call-frame-info) if any.  Do
-         the .eh_frame section(s) first. */
-      vg_assert(di->n_ehframe >= 0 && di->n_ehframe <= N_EHFRAME_SECTS);
-      for (i = 0; i < di->n_ehframe; i++) {
-         /* see Comment_on_EH_FRAME_MULTIPLE_INSTANCES above for why
-            this next assertion should hold. */
-         vg_assert(ML_(sli_is_valid)(ehframe_escn[i]));
-         vg_assert(ehframe_escn[i].szB == di->ehframe_size[i]);
-         ML_(read_callframe_info_dwarf3)( di,
-                                          ehframe_escn[i],
-                                          di->ehframe_avma[i],
-                                          True/*is_ehframe*/ );
-      }
-      if (ML_(sli_is_valid)(debug_frame_escn)) {
-         ML_(read_callframe_info_dwarf3)( di,
-                                          debug_frame_escn,
-                                          0/*assume zero avma*/,
-                                          False/*!is_ehframe*/ );
-      }
-
-      /* TOPLEVEL */
-      /* jrs 2006-01-01: icc-8.1 has been observed to generate
-         binaries without debug_str sections.  Don't preclude
-         debuginfo reading for that reason, but, in
-         read_unitinfo_dwarf2, do check that debugstr is non-NULL
-         before using it. */
-      if (ML_(sli_is_valid)(debug_info_escn) 
-          && ML_(sli_is_valid)(debug_abbv_escn)
-          && ML_(sli_is_valid)(debug_line_escn)) {
-         /* The old reader: line numbers and unwind info only */
-         ML_(read_debuginfo_dwarf3) ( di,
-                                      debug_info_escn,
-                                      debug_types_escn,
-                                      debug_abbv_escn,
-                                      debug_line_escn,
-                                      debug_str_escn,
-                                      debug_str_alt_escn,
-                                      debug_line_str_escn);
-         /* The new reader: read the DIEs in .debug_info to acquire
-            information on variable types and locations or inline info.
-            But only if the tool asks for it, or the user requests it on
-            the command line. */
-         if (VG_(clo_read_var_info) /* the user or tool asked for it */
-             || VG_(clo_read_inline_info)) {
-            ML_(new_dwarf3_reader)(
-               di, debug_info_escn,     debug_types_escn,
-                   debug_abbv_escn,     debug_line_escn,
-                   debug_str_escn,      debug_ranges_escn,
-                   debug_rnglists_escn, debug_loclists_escn,
-                   debug_loc_escn,      debug_info_alt_escn,
-                   debug_abbv_alt_escn, debug_line_alt_escn,
-                   debug_str_alt_escn,  debug_line_str_escn,
-                   debug_addr_escn,     debug_str_offsets_escn
-            );
+      /* Read the call frame info and the DWARF debug info, now or, if
+         that can be deferred, when first needed. */
+      {
+         ElfDebugSects sects;
+         sects.mimg = mimg;
+         sects.dimg = dimg;
+         sects.aimg = aimg;
+         for (i = 0; i < N_EHFRAME_SECTS; i++)
+            sects.ehframe_escn[i] = ehframe_escn[i];
+         sects.debug_frame_escn       = debug_frame_escn;
+         sects.debug_info_escn        = debug_info_escn;
+         sects.debug_types_escn       = debug_types_escn;
+         sects.debug_abbv_escn        = debug_abbv_escn;
+         sects.debug_line_escn        = debug_line_escn;
+         sects.debug_str_escn         = debug_str_escn;
+         sects.debug_line_str_escn    = debug_line_str_escn;
+         sects.debug_ranges_escn      = debug_ranges_escn;
+         sects.debug_rnglists_escn    = debug_rnglists_escn;
+         sects.debug_loclists_escn    = debug_loclists_escn;
+         sects.debug_loc_escn         = debug_loc_escn;
+         sects.debug_addr_escn        = debug_addr_escn;
+         sects.debug_str_offsets_escn = debug_str_offsets_escn;
+         sects.debug_info_alt_escn    = debug_info_alt_escn;
+         sects.debug_abbv_alt_escn    = debug_abbv_alt_escn;
+         sects.debug_line_alt_escn    = debug_line_alt_escn;
+         sects.debug_str_alt_escn     = debug_str_alt_escn;
+
+         if (defer_elf_debug_sects(di, &sects)) {
+            /* The images now belong to di->deferred. */
+            mimg = dimg = aimg = NULL;
+         } else {
+            read_elf_debug_sects(di, &sects);
          }
       }
 
-      /* TOPLEVEL */
-      // JRS 31 July 2014: dwarf-1 reading is currently broken and
-      // therefore deactivated.
-      //if (dwarf1d_img && dwarf1l_img) {
-      //   ML_(read_debuginfo_dwarf1) ( di, dwarf1d_img, dwarf1d_sz, 
-      //                                    dwarf1l_img, dwarf1l_sz );
-      //}
-
-#     if defined(VGA_arm)
-      /* TOPLEVEL */
-      /* ARM32 only: read .exidx/.extab if present.  Note we are
-         reading these directly out of the mapped in (running) image.
-         Also, read these only if no CFI based unwind info was
-         acquired for this file.
-
-         An .exidx section is always required, but the .extab section
-         can be optionally omitted, provided that .exidx does not
-         refer to it.  If the .exidx is erroneous and does refer to
-         .extab even though .extab is missing, the range checks done
-         by GET_EX_U32 in ExtabEntryExtract in readexidx.c should
-         prevent any invalid memory accesses, and cause the .extab to
-         be rejected as invalid.
-
-         FIXME:
-         * check with m_aspacemgr that the entire [exidx_avma, +exidx_size)
-           and [extab_avma, +extab_size) areas are readable, since we're
-           reading this stuff out of the running image (not from a file/socket)
-           and we don't want to segfault.
-         * DebugInfo::exidx_bias and use text_bias instead.
-           I think it's always the same.
-         * remove DebugInfo::{extab_bias, exidx_svma, extab_svma} since
-           they are never used.
-      */
-      if (di->exidx_present
-          && di->cfsi_used == 0
-          && di->text_present && di->text_size > 0) {
-         Addr text_last_svma = di->text_svma + di->text_size - 1;
-         ML_(read_exidx)( di, (UChar*)di->exidx_avma, di->exidx_size,
-                              (UChar*)di->extab_avma, di->extab_size,
-                              text_last_svma,
-                              di->exidx_bias );
-      }
-#     endif /* defined(VGA_arm) */
-
    } /* "Find interesting sections, read the symbol table(s), read any debug
         information" (a local scope) */
 
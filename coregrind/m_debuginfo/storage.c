@@ -2395,6 +2395,15 @@ void ML_(finish_CFSI_arrays) ( struct _DebugInfo* di )
 void ML_(canonicaliseTables) ( struct _DebugInfo* di )
 {
    canonicaliseSymtab ( di );
+   /* If the rest is yet to be read, it is canonicalised once it has
+      been; the pools must stay unfrozen until then. */
+   if (di->deferred == NULL)
+      ML_(canonicaliseDeferredTables) ( di );
+}
+
+void ML_(canonicaliseDeferredTables) ( struct _DebugInfo* di )
+{
+   vg_assert(di->deferred == NULL);
    canonicaliseLoctab ( di );
    canonicaliseInltab ( di );
    ML_(canonicaliseCFI) ( di );
@@ -1057,6 +1057,11 @@ void VG_(gdbserver_report_syscall) (Bool before, UWord sysno, ThreadId tid)
    }
 }
 
+Bool VG_(gdbserver_catching_syscall) (UWord sysno)
+{
+   return UNLIKELY(catching_syscalls) && catch_this_syscall ((Int)sysno);
+}
+
 void VG_(gdbserver_exit) (ThreadId tid, VgSchedReturnCode tids_schedretcode)
 {
    dlog(1, "VG core calling VG_(gdbserver_exit) tid %u will exit\n", tid);
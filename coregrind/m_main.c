@@ -195,6 +195,8 @@ static void usage_NORETURN ( int need_help )
 "                              and use it to print better error messages in\n"
 "                              tools that make use of it (Memcheck, Helgrind,\n"
 "                              DRD) [no]\n"
+"    --lazy-debuginfo=yes|no   read unwind and line number info for an object\n"
+"                              only when it is first needed [no]\n"
 "    --vgdb-poll=<number>      gdbserver poll max every <number> basic blocks [%d] \n"
 "    --vgdb-shadow-registers=no|yes   let gdb see the shadow registers [no]\n"
 "    --vgdb-prefix=<prefix>    prefix for vgdb FIFOs [%s]\n"
@@ -208,6 +210,8 @@ static void usage_NORETURN ( int need_help )
 "    --scheduling-quantum=<number>  thread-scheduling timeslice in number of\n"
 "           basic blocks [100000]\n"
 "    --fair-sched=no|yes|try   schedule threads fairly on multicore systems [no]\n"
+"    --fast-syscalls=yes|no    run getpid, clock_gettime and a few other cheap\n"
+"                              syscalls without leaving generated code [yes]\n"
 "    --kernel-variant=variant1,variant2,...\n"
 "         handle non-standard kernel variants [none]\n"
 "         where variant is one of:\n"
@@ -284,6 +288,7 @@ static void usage_NORETURN ( int need_help )
 "    --vex-iropt-verbosity=<0..9>           [0]\n"
 "    --vex-iropt-level=<0..2>               [2]\n"
 "    --vex-iropt-unroll-thresh=<0..400>     [120]\n"
+"    --vex-iropt-post-instr=no|yes          [yes]\n"
 "    --vex-guest-max-insns=<1..100>         [50]\n"
 "    --vex-guest-chase=no|yes               [yes]\n"
 "    Precise exception control.  Possible values for 'mode' are as follows\n"
@@ -311,6 +316,8 @@ static void usage_NORETURN ( int need_help )
 "        (Nb: you need --trace-notbelow and/or --trace-notabove\n"
 "             with --trace-flags for full details)\n"
 "    --vex-regalloc-version=2|3             [3]\n"
+"    --vex-regalloc-stats=no|yes            show register allocator\n"
+"                                           spill/reload counts at exit [no]\n"
 "\n"
 "  debugging options for Valgrind tools that report errors\n"
 "    --dump-error=<number>     show translation for basic block associated\n"
@@ -646,6 +653,7 @@ else if VG_INT_CLOM(cloPD, arg, "--scheduling-quantum",
          VG_(fmsg_bad_option)(arg,
             "Bad argument, should be 'yes', 'try' or 'no'\n");
    }
+   else if VG_BOOL_CLO(arg, "--fast-syscalls",    VG_(clo_fast_syscalls)) {}
    else if VG_BOOL_CLOM(cloPD, arg, "--trace-sched",      VG_(clo_trace_sched)) {}
    else if VG_BOOL_CLOM(cloPD, arg, "--trace-signals",    VG_(clo_trace_signals)) {}
    else if VG_BOOL_CLOM(cloPD, arg, "--trace-symtab",     VG_(clo_trace_symtab)) {}
@@ -680,6 +688,7 @@ else if VG_INT_CLOM(cloPD, arg, "--scheduling-quantum",
                         VG_(clo_progress_interval), 0, 3600) {}
    else if VG_BOOL_CLO(arg, "--read-inline-info", VG_(clo_read_inline_info)) {}
    else if VG_BOOL_CLO(arg, "--read-var-info",    VG_(clo_read_var_info)) {}
+   else if VG_BOOL_CLO(arg, "--lazy-debuginfo",   VG_(clo_lazy_debuginfo)) {}
 
    else if VG_INT_CLO (arg, "--dump-error",       VG_(clo_dump_error))   {}
    else if VG_INT_CLO (arg, "--input-fd",         VG_(clo_input_fd))     {}
@@ -725,6 +734,8 @@ else if VG_INT_CLOM(cloPD, arg, "--scheduling-quantum",
                        VG_(clo_vex_control).iropt_level, 0, 2) {}
    else if VG_BINT_CLO(arg, "--vex-regalloc-version",
                        VG_(clo_vex_control).regalloc_version, 2, 3) {}
+   else if VG_BOOL_CLO(arg, "--vex-regalloc-stats",
+                       VG_(clo_vex_regalloc_stats)) {}
 
    else if (VG_STRINDEX_CLO(arg, "--vex-iropt-register-updates",
                            pxStrings, ix)
@@ -749,6 +760,8 @@ else if VG_INT_CLOM(cloPD, arg, "--scheduling-quantum",
 
    else if VG_BINT_CLO(arg, "--vex-iropt-unroll-thresh",
                        VG_(clo_vex_control).iropt_unroll_thresh, 0, 400) {}
+   else if VG_BOOL_CLO(arg, "--vex-iropt-post-instr",
+                       VG_(clo_vex_control).iropt_post_instr) {}
    else if VG_BINT_CLO(arg, "--vex-guest-max-insns",
                        VG_(clo_vex_control).guest_max_insns, 1, 100) {}
    else if VG_BOOL_CLO(arg, "--vex-guest-chase",
@@ -2324,6 +2337,9 @@ void shutdown_actions_NORETURN( ThreadId tid,
       VG_(print_all_stats)(VG_(clo_verbosity) >= 1, /* Memory stats */
                            False /* tool prints stats in the tool fini */);
 
+   if (VG_(clo_vex_regalloc_stats))
+      LibVEX_ShowStats();
+
    /* Show a profile of the heap(s) at shutdown.  Optionally, first
       throw away all the debug info, as that makes it easy to spot
       leaks in the debuginfo reader. */
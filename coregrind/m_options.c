@@ -155,8 +155,10 @@ enum FairSchedType
    Smaller values give finer interleaving but much increased scheduling
    overheads. */
 Word   VG_(clo_scheduling_quantum) = 100000;
+Bool   VG_(clo_fast_syscalls) = True;
 Bool   VG_(clo_trace_sched)    = False;
 Bool   VG_(clo_profile_heap)   = False;
+Bool   VG_(clo_vex_regalloc_stats) = False;
 UInt   VG_(clo_progress_interval) = 0; /* in seconds, 1 .. 3600,
                                           or 0 == disabled */
 Int    VG_(clo_core_redzone_size) = CORE_REDZONE_DEFAULT_SZB;
@@ -177,6 +179,7 @@ UInt   VG_(clo_sim_hints)      = 0;
 Bool   VG_(clo_sym_offsets)    = False;
 Bool   VG_(clo_read_inline_info) = False; // Or should be put it to True by default ???
 Bool   VG_(clo_read_var_info)  = False;
+Bool   VG_(clo_lazy_debuginfo) = False;
 XArray *VG_(clo_req_tsyms);  // array of strings
 Bool   VG_(clo_run_libc_freeres) = True;
 Bool   VG_(clo_run_cxx_freeres) = True;
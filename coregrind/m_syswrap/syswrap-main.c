@@ -2540,6 +2540,112 @@ void VG_(post_syscall) (ThreadId tid)
 }
 
 
+/* ---------------------------------------------------------------------
+   A fast path for cheap syscalls: VG_(client_syscall_fast)
+   ------------------------------------------------------------------ */
+
+/* A handful of syscalls get made from the inner loops of programs
+   that time themselves.  Natively most of them never enter the kernel
+   at all, being served by the vDSO, which we hide from the client.
+   Taking each of them through the scheduler and VG_(client_syscall)
+   costs a dispatcher exit and re-entry, so instead a translation that
+   ends in a syscall first calls VG_(client_syscall_fast) (see
+   m_translate.c).  If the syscall is one of those accepted by
+   is_fast_syscall, it is done in place and 1 is returned, and the
+   translation continues at the following instruction.  Otherwise 0
+   is returned and the syscall goes the normal way.
+
+   Everything accepted here cannot block, does not change any state
+   that the core keeps track of, and writes client memory only as
+   described by its PRE/POST wrappers, which are run as usual so that
+   the tool sees exactly the events it would see on the normal path.
+   The result buffers must already be mapped and writable: otherwise
+   VG_(client_syscall) might have extended the root thread's stack to
+   cover them where we would just fail with EFAULT. */
+
+#if defined(VGP_amd64_linux)
+
+static Bool fast_syscall_buf_ok ( UWord a, SizeT len )
+{
+   return a == 0 || VG_(am_is_valid_for_client)( a, len, VKI_PROT_WRITE );
+}
+
+static Bool is_fast_syscall ( const SyscallArgs* args )
+{
+   switch (args->sysno) {
+      case __NR_getpid:  case __NR_getppid: case __NR_gettid:
+      case __NR_getuid:  case __NR_geteuid:
+      case __NR_getgid:  case __NR_getegid: case __NR_getpgrp:
+         return True;
+      case __NR_clock_gettime:
+      case __NR_clock_getres:
+         return fast_syscall_buf_ok( args->arg2, sizeof(struct vki_timespec) );
+      case __NR_gettimeofday:
+         return fast_syscall_buf_ok( args->arg1, sizeof(struct vki_timeval) )
+                && fast_syscall_buf_ok( args->arg2,
+                                        sizeof(struct vki_timezone) );
+      case __NR_time:
+         return fast_syscall_buf_ok( args->arg1, sizeof(vki_time_t) );
+      case __NR_getcpu:
+         return fast_syscall_buf_ok( args->arg1, sizeof(UInt) )
+                && fast_syscall_buf_ok( args->arg2, sizeof(UInt) )
+                && fast_syscall_buf_ok( args->arg3,
+                                        sizeof(struct vki_getcpu_cache) );
+      default:
+         return False;
+   }
+}
+
+UWord VG_(client_syscall_fast) ( void )
+{
+   ThreadId                 tid = VG_(running_tid);
+   ThreadState*             tst;
+   const SyscallTableEntry* ent;
+   SyscallArgLayout         layout;
+   SyscallArgs              args;
+   SyscallStatus            status;
+   UWord                    flags = 0;
+   SysRes                   sres;
+
+   vg_assert(VG_(is_running_thread)(tid));
+   tst = VG_(get_ThreadState)(tid);
+
+   getSyscallArgsFromGuestState( &args, &tst->arch.vex,
+                                 VEX_TRC_JMP_SYS_SYSCALL );
+   if (!is_fast_syscall( &args )
+       || VG_(clo_trace_syscalls)
+       || VG_(gdbserver_catching_syscall)( args.sysno ))
+      return 0;
+
+   ensure_initialised();
+   ent = get_syscall_entry( args.sysno );
+   getSyscallArgLayout( &layout );
+
+   status.what = SsHandToKernel;
+   status.sres = VG_(mk_SysRes_Error)(0);
+   (ent->before)( tid, &layout, &args, &status, &flags );
+
+   /* None of the wrappers for the syscalls above completes the call
+      itself, asks for it to be run asynchronously, or changes the
+      args. */
+   vg_assert(status.what == SsHandToKernel);
+   vg_assert(flags == 0);
+
+   sres = VG_(do_syscall)( args.sysno, args.arg1, args.arg2, args.arg3,
+                           args.arg4, args.arg5, args.arg6,
+                           args.arg7, args.arg8 );
+   status = convert_SysRes_to_SyscallStatus( sres );
+   putSyscallStatusIntoGuestState( tid, &status, &tst->arch.vex );
+
+   if (ent->after && !sr_isError(status.sres))
+      (ent->after)( tid, &args, &status );
+
+   return 1;
+}
+
+#endif /* defined(VGP_amd64_linux) */
+
+
 /* ---------------------------------------------------------------------
    Dealing with syscalls which get interrupted by a signal:
    VG_(fixup_guest_state_after_syscall_interrupted)
@@ -44,6 +44,7 @@
 
 #include "pub_core_signals.h"    // VG_(synth_fault_{perms,mapping}
 #include "pub_core_stacks.h"     // VG_(unknown_SP_update*)()
+#include "pub_core_syswrap.h"    // VG_(client_syscall_fast)
 #include "pub_core_tooliface.h"  // VG_(tdict)
 
 #include "pub_core_translate.h"
@@ -685,6 +686,112 @@ IRSB* vg_SP_update_pass ( void*             closureV,
 #undef DO_DIE
 }
 
+/*------------------------------------------------------------*/
+/*--- Fast syscall pass                                    ---*/
+/*------------------------------------------------------------*/
+
+/* For a superblock ending in a syscall, try to do the syscall in
+   place first (see VG_(client_syscall_fast) in m_syswrap), by
+   appending
+
+      PUT(IP) = next
+      t = DIRTY VG_(client_syscall_fast)()
+      if (t != 0) goto next  (Boring)
+
+   and only falling through to the original syscall exit if that
+   declined.  This runs after the tool's instrumentation, so the tool
+   does not see the call; the helper instead reports the register and
+   memory accesses itself, exactly as the normal syscall path does.
+   The helper reads the syscall number and args, as well as SP, FP and
+   IP for any error it reports, and writes the result, all together
+   with their first shadows. */
+
+static Bool need_fast_syscall_pass(void)
+{
+#  if defined(VGP_amd64_linux)
+   return VG_(clo_fast_syscalls)
+          && !VG_(needs).syscall_wrapper
+          && !VG_(clo_trace_syscalls)
+          && VG_(clo_sanity_level) < 3;
+#  else
+   return False;
+#  endif
+}
+
+static
+IRSB* vg_fast_syscall_pass ( IRSB* bb, const VexGuestLayout* layout )
+{
+#  if defined(VGP_amd64_linux)
+   IRTemp   handled, guard;
+   IRDirty* d;
+   Int      k, offs_res, offs_args, size_args;
+
+   if (bb->jumpkind != Ijk_Sys_syscall || bb->next->tag != Iex_Const)
+      return bb;
+
+   offs_res  = offsetof(VexGuestArchState, guest_RAX);
+   offs_args = offsetof(VexGuestArchState, guest_RDX);
+   size_args = offsetof(VexGuestArchState, guest_RDI) + sizeof(ULong)
+               - offs_args;
+
+   handled = newIRTemp( bb->tyenv, Ity_I64 );
+   guard   = newIRTemp( bb->tyenv, Ity_I1 );
+   d = unsafeIRDirty_1_N( handled, 0/*regparms*/,
+                          "VG_(client_syscall_fast)",
+                          VG_(fnptr_to_fnentry)( &VG_(client_syscall_fast) ),
+                          mkIRExprVec_0() );
+   d->nFxState = 5;
+   for (k = 0; k < d->nFxState; k++) {
+      d->fxState[k].nRepeats  = 0;
+      d->fxState[k].repeatLen = 0;
+   }
+   for (k = 0; k < 2; k++) {
+      /* k == 0: the guest state proper, k == 1: its first shadow */
+      d->fxState[2*k+0].fx     = Ifx_Modify;
+      d->fxState[2*k+0].offset = offs_res + k * layout->total_sizeB;
+      d->fxState[2*k+0].size   = sizeof(ULong);
+      d->fxState[2*k+1].fx     = Ifx_Read;
+      d->fxState[2*k+1].offset = offs_args + k * layout->total_sizeB;
+      d->fxState[2*k+1].size   = size_args;
+   }
+   d->fxState[4].fx     = Ifx_Read;
+   d->fxState[4].offset = layout->offset_IP;
+   d->fxState[4].size   = layout->sizeof_IP;
+
+   addStmtToIRSB( bb, IRStmt_Put( layout->offset_IP,
+                                  deepCopyIRExpr(bb->next) ) );
+   addStmtToIRSB( bb, IRStmt_Dirty(d) );
+   addStmtToIRSB( bb, IRStmt_WrTmp( guard,
+                                    IRExpr_Binop( Iop_CmpNE64,
+                                                  IRExpr_RdTmp(handled),
+                                                  IRExpr_Const(IRConst_U64(0)) ) ) );
+   addStmtToIRSB( bb, IRStmt_Exit( IRExpr_RdTmp(guard),
+                                   Ijk_Boring,
+                                   bb->next->Iex.Const.con,
+                                   bb->offsIP ) );
+#  endif
+   return bb;
+}
+
+/* The core's own passes over the instrumented IR. */
+static
+IRSB* vg_core_post_instrument ( void*             closureV,
+                                IRSB*             sb_in,
+                                const VexGuestLayout*   layout,
+                                const VexGuestExtents*  vge,
+                                const VexArchInfo*      vai,
+                                IRType            gWordTy,
+                                IRType            hWordTy )
+{
+   IRSB* bb = sb_in;
+   if (need_to_handle_SP_assignment())
+      bb = vg_SP_update_pass( closureV, bb, layout, vge, vai,
+                              gWordTy, hWordTy );
+   if (need_fast_syscall_pass())
+      bb = vg_fast_syscall_pass( bb, layout );
+   return bb;
+}
+
 /*------------------------------------------------------------*/
 /*--- Main entry point for the JITter.                     ---*/
 /*------------------------------------------------------------*/
@@ -1788,7 +1895,8 @@ Bool VG_(translate) ( ThreadId tid,
    }
    /* No need for type kludgery here. */
    vta.instrument2       = need_to_handle_SP_assignment()
-                              ? vg_SP_update_pass
+                           || need_fast_syscall_pass()
+                              ? vg_core_post_instrument
                               : NULL;
    vta.finaltidy         = VG_(needs).final_IR_tidy_pass
                               ? VG_(tdict).tool_final_IR_tidy_pass
@@ -124,6 +124,10 @@ extern void VG_(gdbserver_report_fatal_signal) (const vki_siginfo_t *info,
 extern void VG_(gdbserver_report_syscall) (Bool before, UWord sysno,
                                            ThreadId tid);
 
+// True if GDB has asked to observe syscall sysno, i.e. if
+// VG_(gdbserver_report_syscall) might give control to GDB for it.
+extern Bool VG_(gdbserver_catching_syscall) (UWord sysno);
+
 /* Entry point invoked by scheduler.c to execute the request 
    VALGRIND_CLIENT_MONITOR_COMMAND.
    Returns True if command was not recognised. */
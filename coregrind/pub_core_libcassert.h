@@ -67,10 +67,6 @@ extern void  VG_(core_panic_at)   ( const HChar* str, const UnwindStartRegs* );
 /* Exits with status as client exit code. */
 extern void VG_(client_exit)( Int status );
 
-/* Lightweight exit without any dependencies. */
-__attribute__ ((__noreturn__))
-extern void VG_(exit_now)( Int status );
-
 /* Called when some unhandleable client behaviour is detected.
    Prints a msg and aborts. */
 extern void VG_(unimplemented) ( const HChar* format, ... )
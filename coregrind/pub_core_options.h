@@ -211,10 +211,15 @@ enum FairSchedType { disable_fair_sched, enable_fair_sched, try_fair_sched };
 extern enum FairSchedType VG_(clo_fair_sched);
 /* thread-scheduling timeslice. */
 extern Word   VG_(clo_scheduling_quantum);
+/* Run cheap syscalls in place, without leaving generated code?
+   default: YES */
+extern Bool  VG_(clo_fast_syscalls);
 /* DEBUG: print thread scheduling events?  default: NO */
 extern Bool  VG_(clo_trace_sched);
 /* DEBUG: do heap profiling?  default: NO */
 extern Bool  VG_(clo_profile_heap);
+/* DEBUG: show VEX register allocator statistics at exit?  default: NO */
+extern Bool  VG_(clo_vex_regalloc_stats);
 // DEBUG: report progress every N seconds (1 .. 3600)
 extern UInt VG_(clo_progress_interval);
 #define MAX_REDZONE_SZB 128
@@ -257,6 +262,8 @@ extern Bool VG_(clo_sym_offsets);
 extern Bool VG_(clo_read_inline_info);
 /* Read DWARF3 variable info even if tool doesn't ask for it? */
 extern Bool VG_(clo_read_var_info);
+/* Defer reading CFI and DWARF3 line/inline info until needed?  Default: NO */
+extern Bool VG_(clo_lazy_debuginfo);
 /* Which prefix to strip from full source file paths, if any. */
 extern const HChar* VG_(clo_prefix_to_strip);
 
@@ -46,6 +46,13 @@ extern void VG_(client_syscall) ( ThreadId tid, UInt trc );
 
 extern void VG_(post_syscall)   ( ThreadId tid );
 
+#if defined(VGP_amd64_linux)
+// Called from generated code just before a syscall instruction's exit
+// to the scheduler.  Does the syscall in place and returns 1 if it is
+// a cheap one, else returns 0 and leaves the guest state unchanged.
+extern UWord VG_(client_syscall_fast) ( void );
+#endif
+
 /* Clear this module's private state for thread 'tid' */
 extern void VG_(clear_syscallInfo) ( ThreadId tid );
 
@@ -49,6 +49,66 @@ static ULong s_bitmap2_merge_count;
 
 /* Function definitions. */
 
+/**
+ * Mask for the n bits starting at the bit for address LSB b0 in a bm0[]
+ * word. The n bits must be in the same word.
+ */
+static __inline__ UWord bm0_word_mask(const UWord b0, const UWord n)
+{
+   return n == BITS_PER_UWORD
+      ? ~(UWord)0 : (((UWord)1 << n) - 1) << uword_lsb(b0);
+}
+
+/**
+ * Number of bits from the bit for address LSB b0 up to and including the
+ * bit for address LSB b1 that are in the same bm0[] word as b0.
+ */
+static __inline__ UWord bm0_word_bits(const UWord b0, const UWord b1)
+{
+   const UWord n = BITS_PER_UWORD - uword_lsb(b0);
+   return b1 - b0 + 1 < n ? b1 - b0 + 1 : n;
+}
+
+/**
+ * Set the bits for the address LSBs b0 .. b1 (inclusive) in bm0, which is
+ * either bm2->bm1.bm0_r or bm2->bm1.bm0_w, one word at a time.
+ */
+static void bm2_set_range(struct bitmap2* const bm2, UWord* const bm0,
+                          UWord b0, const UWord b1)
+{
+   while (b0 <= b1)
+   {
+      const UWord n = bm0_word_bits(b0, b1);
+      bm0[uword_msb(b0)] |= bm0_word_mask(b0, n);
+      bm2->summary |= bm2_summary_bit(uword_msb(b0));
+      b0 += n;
+   }
+}
+
+/**
+ * Report whether any of the bits for the address LSBs b0 .. b1 (inclusive)
+ * is set in bm2, in bm0_r if r and in bm0_w if w. Words for which the
+ * summary bit is clear are not looked at.
+ */
+static Bool bm2_has_any(const struct bitmap2* const bm2,
+                        const Bool r, const Bool w, UWord b0, const UWord b1)
+{
+   while (b0 <= b1)
+   {
+      const UWord n = bm0_word_bits(b0, b1);
+      const UWord k = uword_msb(b0);
+      if (bm2->summary & bm2_summary_bit(k))
+      {
+         const UWord bits = (r ? bm2->bm1.bm0_r[k] : 0)
+                          | (w ? bm2->bm1.bm0_w[k] : 0);
+         if (bits & bm0_word_mask(b0, n))
+            return True;
+      }
+      b0 += n;
+   }
+   return False;
+}
+
 void DRD_(bm_module_init)(void)
 {
    tl_assert(!s_bm2_set_template);
@@ -110,6 +170,7 @@ void DRD_(bm_init)(struct bitmap* const bm)
 /** Free the memory allocated by DRD_(bm_init)(). */
 void DRD_(bm_cleanup)(struct bitmap* const bm)
 {
+   s_bitmap2_alive_count -= VG_(OSetGen_Size)(bm->oset);
    VG_(OSetGen_Destroy)(bm->oset);
 }
 
@@ -149,7 +210,6 @@ void DRD_(bm_access_range_load)(struct bitmap* const bm, Addr a1, Addr a2)
       Addr b_start;
       Addr b_end;
       struct bitmap2* bm2;
-      UWord b0;
 
       b_next = first_address_with_higher_msb(b);
       if (b_next > a2)
@@ -177,22 +237,8 @@ void DRD_(bm_access_range_load)(struct bitmap* const bm, Addr a1, Addr a2)
       tl_assert(address_msb(b_start) == address_msb(b_end - 1));
       tl_assert(address_lsb(b_start) <= address_lsb(b_end - 1));
 
-      if (address_lsb(b_start) == 0 && address_lsb(b_end) == 0)
-      {
-         unsigned k;
-
-         for (k = 0; k < BITMAP1_UWORD_COUNT; k++)
-         {
-            bm2->bm1.bm0_r[k] = ~(UWord)0;
-         }
-      }
-      else
-      {
-         for (b0 = address_lsb(b_start); b0 <= address_lsb(b_end - 1); b0++)
-         {
-            bm0_set(bm2->bm1.bm0_r, b0);
-         }
-      }
+      bm2_set_range(bm2, bm2->bm1.bm0_r,
+                    address_lsb(b_start), address_lsb(b_end - 1));
    }
 }
 
@@ -246,7 +292,6 @@ void DRD_(bm_access_range_store)(struct bitmap* const bm,
       Addr b_start;
       Addr b_end;
       struct bitmap2* bm2;
-      UWord b0;
 
       b_next = first_address_with_higher_msb(b);
       if (b_next > a2)
@@ -274,22 +319,8 @@ void DRD_(bm_access_range_store)(struct bitmap* const bm,
       tl_assert(address_msb(b_start) == address_msb(b_end - 1));
       tl_assert(address_lsb(b_start) <= address_lsb(b_end - 1));
 
-      if (address_lsb(b_start) == 0 && address_lsb(b_end) == 0)
-      {
-         unsigned k;
-
-         for (k = 0; k < BITMAP1_UWORD_COUNT; k++)
-         {
-            bm2->bm1.bm0_w[k] = ~(UWord)0;
-         }
-      }
-      else
-      {
-         for (b0 = address_lsb(b_start); b0 <= address_lsb(b_end - 1); b0++)
-         {
-            bm0_set(bm2->bm1.bm0_w, b0);
-         }
-      }
+      bm2_set_range(bm2, bm2->bm1.bm0_w,
+                    address_lsb(b_start), address_lsb(b_end - 1));
    }
 }
 
@@ -346,17 +377,8 @@ Bool DRD_(bm_has_any_load_g)(struct bitmap* const bm)
 
    VG_(OSetGen_ResetIter)(bm->oset);
    for ( ; (bm2 = VG_(OSetGen_Next)(bm->oset)) != NULL; ) {
-      Addr b_start;
-      Addr b_end;
-      UWord b0;
-      const struct bitmap1* const p1 = &bm2->bm1;
-
-      b_start = make_address(bm2->addr, 0);
-      b_end = make_address(bm2->addr + 1, 0);
-
-      for (b0 = address_lsb(b_start); b0 <= address_lsb(b_end - 1); b0++)
-         if (bm0_is_set(p1->bm0_r, b0))
-            return True;
+      if (bm2_has_any(bm2, True, False, 0, ADDR_LSB_MASK))
+         return True;
    }
    return False;
 }
@@ -382,8 +404,6 @@ DRD_(bm_has_any_load)(struct bitmap* const bm, const Addr a1, const Addr a2)
       {
          Addr b_start;
          Addr b_end;
-         UWord b0;
-         const struct bitmap1* const p1 = &bm2->bm1;
 
          if (make_address(bm2->addr, 0) < a1)
             b_start = a1;
@@ -402,12 +422,10 @@ DRD_(bm_has_any_load)(struct bitmap* const bm, const Addr a1, const Addr a2)
          tl_assert(b_start < b_end);
          tl_assert(address_lsb(b_start) <= address_lsb(b_end - 1));
 
-         for (b0 = address_lsb(b_start); b0 <= address_lsb(b_end - 1); b0++)
+         if (bm2_has_any(bm2, True, False,
+                         address_lsb(b_start), address_lsb(b_end - 1)))
          {
-            if (bm0_is_set(p1->bm0_r, b0))
-            {
-               return True;
-            }
+            return True;
          }
       }
    }
@@ -435,8 +453,6 @@ Bool DRD_(bm_has_any_store)(struct bitmap* const bm,
       {
          Addr b_start;
          Addr b_end;
-         UWord b0;
-         const struct bitmap1* const p1 = &bm2->bm1;
 
          if (make_address(bm2->addr, 0) < a1)
             b_start = a1;
@@ -455,12 +471,10 @@ Bool DRD_(bm_has_any_store)(struct bitmap* const bm,
          tl_assert(b_start < b_end);
          tl_assert(address_lsb(b_start) <= address_lsb(b_end - 1));
 
-         for (b0 = address_lsb(b_start); b0 <= address_lsb(b_end - 1); b0++)
+         if (bm2_has_any(bm2, False, True,
+                         address_lsb(b_start), address_lsb(b_end - 1)))
          {
-            if (bm0_is_set(p1->bm0_w, b0))
-            {
-               return True;
-            }
+            return True;
          }
       }
    }
@@ -490,8 +504,6 @@ Bool DRD_(bm_has_any_access)(struct bitmap* const bm,
       {
          Addr b_start;
          Addr b_end;
-         UWord b0;
-         const struct bitmap1* const p1 = &bm2->bm1;
 
          if (make_address(bm2->addr, 0) < a1)
             b_start = a1;
@@ -510,16 +522,10 @@ Bool DRD_(bm_has_any_access)(struct bitmap* const bm,
          tl_assert(b_start < b_end);
          tl_assert(address_lsb(b_start) <= address_lsb(b_end - 1));
 
-         for (b0 = address_lsb(b_start); b0 <= address_lsb(b_end - 1); b0++)
+         if (bm2_has_any(bm2, True, True,
+                         address_lsb(b_start), address_lsb(b_end - 1)))
          {
-            /*
-             * Note: the statement below uses a binary or instead of a logical
-             * or on purpose.
-             */
-            if (bm0_is_set(p1->bm0_r, b0) | bm0_is_set(p1->bm0_w, b0))
-            {
-               return True;
-            }
+            return True;
          }
       }
    }
@@ -823,8 +829,6 @@ Bool DRD_(bm_has_conflict_with)(struct bitmap* const bm,
       {
          Addr b_start;
          Addr b_end;
-         UWord b0;
-         const struct bitmap1* const p1 = &bm2->bm1;
 
          if (make_address(bm2->addr, 0) < a1)
             b_start = a1;
@@ -843,24 +847,11 @@ Bool DRD_(bm_has_conflict_with)(struct bitmap* const bm,
          tl_assert(b_start < b_end);
          tl_assert(address_lsb(b_start) <= address_lsb(b_end - 1));
 
-         for (b0 = address_lsb(b_start); b0 <= address_lsb(b_end - 1); b0++)
+         tl_assert(access_type == eLoad || access_type == eStore);
+         if (bm2_has_any(bm2, access_type == eStore, True,
+                         address_lsb(b_start), address_lsb(b_end - 1)))
          {
-            if (access_type == eLoad)
-            {
-               if (bm0_is_set(p1->bm0_w, b0))
-               {
-                  return True;
-               }
-            }
-            else
-            {
-               tl_assert(access_type == eStore);
-               if (bm0_is_set(p1->bm0_r, b0)
-                   | bm0_is_set(p1->bm0_w, b0))
-               {
-                  return True;
-               }
-            }
+            return True;
          }
       }
    }
@@ -1139,9 +1130,7 @@ void DRD_(bm_remove_cleared_marked)(struct bitmap* bm)
    for ( ; (bm2 = VG_(OSetGen_Next)(bm->oset)) != 0; )
    {
       const UWord a1 = bm2->addr;
-      if (bm2->recalc
-          && ! DRD_(bm_has_any_access(bm, make_address(a1, 0),
-                                      make_address(a1 + 1, 0))))
+      if (bm2->recalc && ! bm2_has_any(bm2, True, True, 0, ADDR_LSB_MASK))
       {
          bm2_remove(bm, a1);
          VG_(OSetGen_ResetIterAt)(bm->oset, &a1);
@@ -1166,6 +1155,7 @@ int DRD_(bm_has_races)(struct bitmap* const lhs, struct bitmap* const rhs)
       const struct bitmap2* bm2r;
       const struct bitmap1* bm1l;
       const struct bitmap1* bm1r;
+      UWord summary;
       unsigned k;
 
       bm2l = VG_(OSetGen_Next)(lhs->oset);
@@ -1182,22 +1172,30 @@ int DRD_(bm_has_races)(struct bitmap* const lhs, struct bitmap* const rhs)
 
       bm1l = &bm2l->bm1;
       bm1r = &bm2r->bm1;
+      summary = bm2l->summary & bm2r->summary;
 
-      for (k = 0; k < BITMAP1_UWORD_COUNT; k++)
+      for (k = 0; summary && k < BITMAP1_UWORD_COUNT; k++)
       {
          unsigned b;
-         for (b = 0; b < BITS_PER_UWORD; b++)
+         UWord races;
+
+         if (! (summary & bm2_summary_bit(k)))
+         {
+            /* Skip the rest of the group. */
+            k |= BM2_SUMMARY_WORDS - 1;
+            continue;
+         }
+         /* All bits for which HAS_RACE() holds, one word at a time. */
+         races = (bm1l->bm0_w[k] & (bm1r->bm0_r[k] | bm1r->bm0_w[k]))
+               | (bm1l->bm0_r[k] & bm1r->bm0_w[k]);
+         for (b = 0; races != 0 && b < BITS_PER_UWORD; b++)
          {
-            UWord const access_mask
-               = ((bm1l->bm0_r[k] & bm0_mask(b)) ? LHS_R : 0)
-               | ((bm1l->bm0_w[k] & bm0_mask(b)) ? LHS_W : 0)
-               | ((bm1r->bm0_r[k] & bm0_mask(b)) ? RHS_R : 0)
-               | ((bm1r->bm0_w[k] & bm0_mask(b)) ? RHS_W : 0);
             Addr const a = make_address(bm2l->addr, k * BITS_PER_UWORD | b);
-            if (HAS_RACE(access_mask) && ! DRD_(is_suppressed)(a, a + 1))
+            if ((races & bm0_mask(b)) && ! DRD_(is_suppressed)(a, a + 1))
             {
                return 1;
             }
+            races &= ~bm0_mask(b);
          }
       }
    }
@@ -1255,6 +1253,24 @@ ULong DRD_(bm_get_bitmap2_merge_count)(void)
    return s_bitmap2_merge_count;
 }
 
+/** Number of bytes used by the second level bitmaps of all bitmaps. */
+ULong DRD_(bm_get_bitmap2_memory)(void)
+{
+   return s_bitmap2_alive_count * sizeof(struct bitmap2);
+}
+
+/** Number of bytes used by the second level bitmaps of bitmap bm. */
+ULong DRD_(bm_get_memory)(struct bitmap* const bm)
+{
+   return VG_(OSetGen_Size)(bm->oset) * sizeof(struct bitmap2);
+}
+
+/** Maximum of DRD_(bm_get_bitmap2_memory)() so far. */
+ULong DRD_(bm_get_max_bitmap2_memory)(void)
+{
+   return s_max_bitmap2_alive_count * sizeof(struct bitmap2);
+}
+
 /** Compute *bm2l |= *bm2r. */
 static
 void bm2_merge(struct bitmap2* const bm2l, const struct bitmap2* const bm2r)
@@ -1267,12 +1283,33 @@ void bm2_merge(struct bitmap2* const bm2l, const struct bitmap2* const bm2r)
 
    s_bitmap2_merge_count++;
 
-   for (k = 0; k < BITMAP1_UWORD_COUNT; k++)
-   {
-      bm2l->bm1.bm0_r[k] |= bm2r->bm1.bm0_r[k];
-   }
-   for (k = 0; k < BITMAP1_UWORD_COUNT; k++)
+   /*
+    * Only merge the groups of words for which the summary bit of bm2r is
+    * set. The words of a group are merged without further tests, which
+    * allows the compiler to use SIMD instructions for the inner loop.
+    */
+   for (k = 0; k < BITMAP1_UWORD_COUNT; k += BM2_SUMMARY_WORDS)
    {
-      bm2l->bm1.bm0_w[k] |= bm2r->bm1.bm0_w[k];
+      UWord r[BM2_SUMMARY_WORDS];
+      UWord w[BM2_SUMMARY_WORDS];
+      unsigned j;
+
+      if (! (bm2r->summary & bm2_summary_bit(k)))
+         continue;
+      /*
+       * Compute the group in r[] and w[] before storing it, so that the
+       * compiler does not have to care about bm2l and bm2r overlapping.
+       */
+      for (j = 0; j < BM2_SUMMARY_WORDS; j++)
+      {
+         r[j] = bm2l->bm1.bm0_r[k + j] | bm2r->bm1.bm0_r[k + j];
+         w[j] = bm2l->bm1.bm0_w[k + j] | bm2r->bm1.bm0_w[k + j];
+      }
+      for (j = 0; j < BM2_SUMMARY_WORDS; j++)
+      {
+         bm2l->bm1.bm0_r[k + j] = r[j];
+         bm2l->bm1.bm0_w[k + j] = w[j];
+      }
    }
+   bm2l->summary |= bm2r->summary;
 }
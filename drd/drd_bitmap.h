@@ -212,6 +212,8 @@ Addr first_address_with_higher_uword_msb(const Addr a)
 /* Local variables. */
 
 static ULong s_bitmap2_creation_count;
+static ULong s_bitmap2_alive_count;
+static ULong s_max_bitmap2_alive_count;
 
 
 
@@ -329,14 +331,42 @@ static __inline__ UWord bm0_is_any_set(const UWord* bm0,
 /*********************************************************************/
 
 
+/**
+ * Number of bm0_r[] / bm0_w[] words summarized by one bit of
+ * bitmap2::summary. A group of several words is merged without a test per
+ * word, so that the compiler can vectorize the loop.
+ */
+#define BM2_SUMMARY_WORDS 8U
+
+#if BITMAP1_UWORD_COUNT / BM2_SUMMARY_WORDS > (1U << BITS_PER_BITS_PER_UWORD)
+#error Pick a larger value for BM2_SUMMARY_WORDS.
+#endif
+
 /* Second level bitmap. */
 struct bitmap2
 {
    Addr           addr;   ///< address_msb(...)
    Bool           recalc;
+   /**
+    * Bit i is set if any of the words bm1.bm0_r[k] or bm1.bm0_w[k] with
+    * k / BM2_SUMMARY_WORDS == i may be nonzero. Bits are only cleared
+    * when the whole second level bitmap is cleared, so a set bit does not
+    * guarantee that there is an access, but a clear bit guarantees that
+    * there is none.
+    */
+   UWord          summary;
    struct bitmap1 bm1;
 };
 
+/** Summary bit of bitmap2 for the bm0_r[] / bm0_w[] word with index k. */
+static __inline__ UWord bm2_summary_bit(const UWord k)
+{
+#ifdef ENABLE_DRD_CONSISTENCY_CHECKS
+   tl_assert(k < BITMAP1_UWORD_COUNT);
+#endif
+   return (UWord)1 << (k / BM2_SUMMARY_WORDS);
+}
+
 
 static void bm2_clear(struct bitmap2* const bm2);
 static __inline__
@@ -547,6 +577,7 @@ void bm2_clear(struct bitmap2* const bm2)
 #ifdef ENABLE_DRD_CONSISTENCY_CHECKS
    tl_assert(bm2);
 #endif
+   bm2->summary = 0;
    VG_(memset)(&bm2->bm1, 0, sizeof(bm2->bm1));
 }
 
@@ -568,9 +599,12 @@ struct bitmap2* bm2_insert(struct bitmap* const bm, const UWord a1)
 #endif
 
    s_bitmap2_creation_count++;
+   if (++s_bitmap2_alive_count > s_max_bitmap2_alive_count)
+      s_max_bitmap2_alive_count = s_bitmap2_alive_count;
 
    bm2 = VG_(OSetGen_AllocNode)(bm->oset, sizeof(*bm2));
    bm2->addr = a1;
+   bm2->recalc = False;
    VG_(OSetGen_Insert)(bm->oset, bm2);
 
    bm_update_cache(bm, a1, bm2);
@@ -585,6 +619,7 @@ struct bitmap2* bm2_insert_copy(struct bitmap* const bm,
    struct bitmap2* bm2_copy;
 
    bm2_copy = bm2_insert(bm, bm2->addr);
+   bm2_copy->summary = bm2->summary;
    VG_(memcpy)(&bm2_copy->bm1, &bm2->bm1, sizeof(bm2->bm1));
    return bm2_copy;
 }
@@ -651,6 +686,7 @@ void bm2_remove(struct bitmap* const bm, const UWord a1)
 
    bm2 = VG_(OSetGen_Remove)(bm->oset, &a1);
    VG_(OSetGen_FreeNode)(bm->oset, bm2);
+   s_bitmap2_alive_count--;
 
    bm_update_cache(bm, a1, NULL);
 }
@@ -666,9 +702,8 @@ void bm_access_aligned_load(struct bitmap* const bm,
 #endif
 
    bm2 = bm2_lookup_or_insert_exclusive(bm, address_msb(a1));
-   bm0_set_range(bm2->bm1.bm0_r,
-                 (a1 >> ADDR_IGNORED_BITS) & ADDR_LSB_MASK,
-                 SCALED_SIZE(size));
+   bm0_set_range(bm2->bm1.bm0_r, address_lsb(a1), SCALED_SIZE(size));
+   bm2->summary |= bm2_summary_bit(uword_msb(address_lsb(a1)));
 }
 
 static __inline__
@@ -682,9 +717,8 @@ void bm_access_aligned_store(struct bitmap* const bm,
 #endif
 
    bm2 = bm2_lookup_or_insert_exclusive(bm, address_msb(a1));
-   bm0_set_range(bm2->bm1.bm0_w,
-                 (a1 >> ADDR_IGNORED_BITS) & ADDR_LSB_MASK,
-                 SCALED_SIZE(size));
+   bm0_set_range(bm2->bm1.bm0_w, address_lsb(a1), SCALED_SIZE(size));
+   bm2->summary |= bm2_summary_bit(uword_msb(address_lsb(a1)));
 }
 
 static __inline__
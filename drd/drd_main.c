@@ -72,6 +72,8 @@ static Bool DRD_(process_cmd_line_option)(const HChar* arg)
    Bool report_signal_unlocked = False;
    Bool segment_merging        = False;
    int segment_merge_interval  = -1;
+   int max_segments            = -1;
+   int max_segment_memory      = -1;
    int shared_threshold_ms     = -1;
    Bool show_confl_seg         = False;
    Bool trace_barrier          = False;
@@ -107,6 +109,8 @@ static Bool DRD_(process_cmd_line_option)(const HChar* arg)
    }
    else if VG_INT_CLO (arg, "--segment-merging-interval", segment_merge_interval)
    {}
+   else if VG_INT_CLO (arg, "--max-segments",        max_segments) {}
+   else if VG_INT_CLO (arg, "--max-segment-memory",  max_segment_memory) {}
    else if VG_BOOL_CLO(arg, "--show-confl-seg",      show_confl_seg) {
       DRD_(set_show_conflicting_segments)(show_confl_seg);
    }
@@ -177,6 +181,10 @@ static Bool DRD_(process_cmd_line_option)(const HChar* arg)
    }
    if (segment_merge_interval != -1)
       DRD_(thread_set_segment_merge_interval)(segment_merge_interval);
+   if (max_segments >= 0)
+      DRD_(thread_set_max_segments)(max_segments);
+   if (max_segment_memory >= 0)
+      DRD_(thread_set_max_segment_memory)((ULong)max_segment_memory << 20);
    if (trace_address) {
       const Addr addr = VG_(strtoll16)(trace_address, 0);
       DRD_(start_tracing_address_range)(addr, addr + 1, False);
@@ -218,6 +226,11 @@ static void DRD_(print_usage)(void)
 "        in race reports but can also trigger an out of memory error.\n"
 "    --segment-merging-interval=<n> Perform segment merging every time n new\n"
 "        segments have been created. Default: %d.\n"
+"    --max-segments=<n>        Merge segments, and if that does not suffice\n"
+"                              discard the oldest segments, when more than\n"
+"                              n segments are alive [0, no limit].\n"
+"    --max-segment-memory=<n>  Same, when the bitmaps that record memory\n"
+"                              accesses use more than n MB [0, no limit].\n"
 "    --shared-threshold=<n>    Print an error message if a reader lock\n"
 "                              is held longer than the specified time (in\n"
 "                              milliseconds) [off]\n"
@@ -788,6 +801,11 @@ static void DRD_(fini)(Int exitcode)
                    "           %llu partial updates because of thread join"
                    " operations.\n",
                    pu_join);
+      VG_(message)(Vg_UserMsg,
+                   "           %llu partial and %llu no updates because of"
+                   " context switches.\n",
+                   DRD_(thread_get_switch_conflict_set_count)(),
+                   DRD_(thread_get_switch_conflict_set_unchanged_count)());
       VG_(message)(Vg_UserMsg,
                    " segments: created %llu segments, max %llu alive,\n",
                    DRD_(sg_get_segments_created_count)(),
@@ -796,6 +814,12 @@ static void DRD_(fini)(Int exitcode)
                    "           %llu discard points and %llu merges.\n",
                    DRD_(thread_get_discard_ordered_segments_count)(),
                    DRD_(sg_get_segment_merge_count)());
+      VG_(message)(Vg_UserMsg,
+                   "           %llu alive using %llu KB at exit and %llu"
+                   " discarded because of the budget.\n",
+                   DRD_(sg_get_segments_alive_count)(),
+                   DRD_(thread_get_segment_memory)() >> 10,
+                   DRD_(thread_get_discard_over_budget_count)());
       VG_(message)(Vg_UserMsg,
                    "segmnt cr: %llu mutex, %llu rwlock, %llu semaphore and"
                    " %llu barrier.\n",
@@ -808,6 +832,11 @@ static void DRD_(fini)(Int exitcode)
                    " and %llu level two bitmaps were allocated.\n",
                    DRD_(bm_get_bitmap_creation_count)(),
                    DRD_(bm_get_bitmap2_creation_count)());
+      VG_(message)(Vg_UserMsg,
+                   "           %llu KB used by level two bitmaps at exit,"
+                   " max %llu KB.\n",
+                   DRD_(bm_get_bitmap2_memory)() >> 10,
+                   DRD_(bm_get_max_bitmap2_memory)() >> 10);
       VG_(message)(Vg_UserMsg,
                    "    mutex: %llu non-recursive lock/unlock events.\n",
                    DRD_(get_mutex_lock_count)());
@@ -47,6 +47,12 @@ typedef struct segment
    DrdThreadId        tid;
    /** Reference count: number of pointers that point to this segment. */
    int                refcnt;
+   /**
+    * Whether the bitmap of this segment has been merged into the conflict
+    * set of the running thread. Only maintained for segments that are in
+    * the segment list of a thread.
+    */
+   Bool               in_conflict_set;
    /** Stack trace of the first instruction of the segment. */
    ExeContext*        stacktrace;
    /** Vector clock associated with the segment. */
@@ -90,6 +90,12 @@ Bool DRD_(is_suppressed)(const Addr a1, const Addr a2)
    return DRD_(bm_has)(s_suppressed, a1, a2, eStore);
 }
 
+/** Number of bytes used by the suppression and tracing bitmaps. */
+ULong DRD_(suppression_get_bitmap_memory)(void)
+{
+   return DRD_(bm_get_memory)(s_suppressed) + DRD_(bm_get_memory)(s_traced);
+}
+
 /**
  * Return true if data race detection suppression has been requested for any
  * of the bytes in the range a1 .. a2 - 1 inclusive. Return false in case none
@@ -23,6 +23,7 @@ void DRD_(start_tracing_address_range)(const Addr a1, const Addr a2,
 void DRD_(stop_tracing_address_range)(const Addr a1, const Addr a2);
 Bool DRD_(is_any_traced)(const Addr a1, const Addr a2);
 void DRD_(suppression_stop_using_mem)(const Addr a1, const Addr a2);
+ULong DRD_(suppression_get_bitmap_memory)(void);
 
 
 static __inline__ Bool DRD_(any_address_is_traced)(void)
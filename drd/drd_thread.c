@@ -47,7 +47,10 @@ static void thread_append_segment(const DrdThreadId tid, Segment* const sg);
 static void thread_discard_segment(const DrdThreadId tid, Segment* const sg);
 static void thread_compute_conflict_set(struct bitmap** conflict_set,
                                         const DrdThreadId tid);
+static void thread_switch_conflict_set(const DrdThreadId tid);
+static void thread_recalc_marked_conflict_set(const DrdThreadId tid);
 static Bool thread_conflict_set_up_to_date(const DrdThreadId tid);
+static void thread_maybe_merge_segments(void);
 
 
 /* Local variables. */
@@ -59,6 +62,9 @@ static ULong    s_update_conflict_set_count;
 static ULong    s_update_conflict_set_new_sg_count;
 static ULong    s_update_conflict_set_sync_count;
 static ULong    s_update_conflict_set_join_count;
+static ULong    s_switch_conflict_set_count;
+static ULong    s_switch_conflict_set_unchanged_count;
+static ULong    s_discard_over_budget_count;
 static ULong    s_conflict_set_bitmap_creation_count;
 static ULong    s_conflict_set_bitmap2_creation_count;
 static ThreadId s_vg_running_tid  = VG_INVALID_THREADID;
@@ -70,9 +76,18 @@ static Bool     s_trace_context_switches = False;
 static Bool     s_trace_conflict_set = False;
 static Bool     s_trace_conflict_set_bm = False;
 static Bool     s_trace_fork_join = False;
+/**
+ * Whether bitmap2::recalc has been set in the conflict set for segments that
+ * left the conflict set without the conflict set having been recalculated.
+ */
+static Bool     s_conflict_set_marked;
 static Bool     s_segment_merging = True;
 static Bool     s_new_segments_since_last_merge;
 static int      s_segment_merge_interval = 10;
+/** Limit on the number of segments alive, or zero if there is no limit. */
+static ULong    s_max_segments;
+/** Limit on the bitmap memory in bytes, or zero if there is no limit. */
+static ULong    s_max_segment_memory;
 static unsigned s_join_list_vol = 10;
 static unsigned s_deletion_head;
 static unsigned s_deletion_tail;
@@ -138,6 +153,18 @@ void DRD_(thread_set_segment_merge_interval)(const int i)
    s_segment_merge_interval = i;
 }
 
+/** Set the maximum number of segments alive (0 = no limit). */
+void DRD_(thread_set_max_segments)(const ULong n)
+{
+   s_max_segments = n;
+}
+
+/** Set the maximum bitmap memory in bytes (0 = no limit). */
+void DRD_(thread_set_max_segment_memory)(const ULong bytes)
+{
+   s_max_segment_memory = bytes;
+}
+
 void DRD_(thread_set_join_list_vol)(const int jlv)
 {
    s_join_list_vol = jlv;
@@ -533,6 +560,11 @@ void DRD_(thread_delete)(const DrdThreadId tid, const Bool detached)
       sg_prev = sg->thr_prev;
       sg->thr_next = NULL;
       sg->thr_prev = NULL;
+      if (sg->in_conflict_set) {
+         DRD_(bm_mark)(DRD_(g_conflict_set), DRD_(sg_bm)(sg));
+         sg->in_conflict_set = False;
+         s_conflict_set_marked = True;
+      }
       DRD_(sg_put)(sg);
    }
    DRD_(g_threadinfo)[tid].valid = False;
@@ -546,6 +578,18 @@ void DRD_(thread_delete)(const DrdThreadId tid, const Bool detached)
    DRD_(g_threadinfo)[tid].sg_last = NULL;
 
    tl_assert(!DRD_(IsValidDrdThreadId)(tid));
+
+   /*
+    * Remove the accesses of the deleted segments from the conflict set. If
+    * the running thread is not known, this happens upon the next context
+    * switch.
+    */
+   if (s_conflict_set_marked
+       && DRD_(IsValidDrdThreadId)(DRD_(g_drd_running_tid))
+       && DRD_(g_threadinfo)[DRD_(g_drd_running_tid)].sg_last)
+   {
+      thread_recalc_marked_conflict_set(DRD_(g_drd_running_tid));
+   }
 }
 
 /**
@@ -594,6 +638,14 @@ void DRD_(drd_thread_atfork_child)(const ThreadId tid)
 
    DRD_(bm_cleanup)(DRD_(g_conflict_set));
    DRD_(bm_init)(DRD_(g_conflict_set));
+   s_conflict_set_marked = False;
+   for (i = 1; i < DRD_N_THREADS; i++)
+   {
+      Segment* sg;
+
+      for (sg = DRD_(g_threadinfo)[i].sg_first; sg; sg = sg->thr_next)
+         sg->in_conflict_set = False;
+   }
 }
 
 /** Called just before pthread_cancel(). */
@@ -794,7 +846,7 @@ void DRD_(thread_set_running_tid)(const ThreadId vg_tid,
       }
       s_vg_running_tid = vg_tid;
       DRD_(g_drd_running_tid) = drd_tid;
-      thread_compute_conflict_set(&DRD_(g_conflict_set), drd_tid);
+      thread_switch_conflict_set(drd_tid);
       s_context_switch_count++;
    }
 
@@ -877,6 +929,16 @@ void thread_discard_segment(const DrdThreadId tid, Segment* const sg)
       DRD_(g_threadinfo)[tid].sg_first = sg->thr_next;
    if (sg == DRD_(g_threadinfo)[tid].sg_last)
       DRD_(g_threadinfo)[tid].sg_last = sg->thr_prev;
+   if (sg->in_conflict_set)
+   {
+      /*
+       * Mark the part of the conflict set this segment contributed to. It
+       * is recalculated during the next conflict set update.
+       */
+      DRD_(bm_mark)(DRD_(g_conflict_set), DRD_(sg_bm)(sg));
+      sg->in_conflict_set = False;
+      s_conflict_set_marked = True;
+   }
    DRD_(sg_put)(sg);
 
 #ifdef ENABLE_DRD_CONSISTENCY_CHECKS
@@ -1119,6 +1181,22 @@ static void thread_merge_segments(void)
             {
                /* Merge sg and sg_next into sg. */
                DRD_(sg_merge)(sg, sg_next);
+               /*
+                * Both segments are ordered in the same way against the
+                * latest segment of the running thread, so both or none of
+                * them belong in the conflict set. Their in_conflict_set
+                * flags may still differ: e.g. a segment created for another
+                * thread than the running one starts with the flag clear,
+                * and only gets it during the next conflict set update. If
+                * sg is in the conflict set, the accesses it took over from
+                * sg_next must be in there too. If only sg_next is,
+                * discarding it marks its part of the conflict set for
+                * recalculation.
+                */
+               if (sg->in_conflict_set && ! sg_next->in_conflict_set)
+                  DRD_(bm_merge2)(DRD_(g_conflict_set), DRD_(sg_bm)(sg_next));
+               if (sg->in_conflict_set)
+                  sg_next->in_conflict_set = False;
                thread_discard_segment(i, sg_next);
             }
          }
@@ -1130,6 +1208,83 @@ static void thread_merge_segments(void)
    }
 }
 
+/**
+ * Report the number of bytes used by the bitmaps of all segments alive, that
+ * is all bitmaps except the conflict set and the suppression bitmaps.
+ */
+ULong DRD_(thread_get_segment_memory)(void)
+{
+   ULong other = DRD_(suppression_get_bitmap_memory)();
+
+   if (DRD_(g_conflict_set))
+      other += DRD_(bm_get_memory)(DRD_(g_conflict_set));
+   return DRD_(bm_get_bitmap2_memory)() - other;
+}
+
+/**
+ * Report whether the number of segments alive or the memory used by their
+ * bitmaps exceeds quarters / 4 of --max-segments or --max-segment-memory.
+ */
+static Bool thread_segment_budget_exceeded(const unsigned quarters)
+{
+   return (s_max_segments
+           && DRD_(sg_get_segments_alive_count)() * 4
+              > s_max_segments * quarters)
+      || (s_max_segment_memory
+          && DRD_(thread_get_segment_memory)() * 4
+             > s_max_segment_memory * quarters);
+}
+
+/**
+ * Discard the oldest segments that are neither the latest segment of a thread
+ * nor referenced by a synchronization object until the segment count and the
+ * bitmap memory are below three quarters of the budget. Data races between
+ * the accesses in a discarded segment and later accesses are not reported.
+ */
+static void thread_discard_segments_over_budget(void)
+{
+   Segment* sg;
+   Segment* sg_prev;
+
+   for (sg = DRD_(g_sg_list); sg && sg->g_next; sg = sg->g_next)
+      ;
+   for ( ; sg && thread_segment_budget_exceeded(3); sg = sg_prev) {
+      sg_prev = sg->g_prev;
+      if (DRD_(sg_get_refcnt)(sg) == 1 && sg->thr_next) {
+         thread_discard_segment(sg->tid, sg);
+         s_discard_over_budget_count++;
+      }
+   }
+
+   if (s_conflict_set_marked
+       && DRD_(IsValidDrdThreadId)(DRD_(g_drd_running_tid))
+       && DRD_(g_threadinfo)[DRD_(g_drd_running_tid)].sg_last)
+   {
+      thread_recalc_marked_conflict_set(DRD_(g_drd_running_tid));
+   }
+}
+
+/**
+ * Merge segments every --segment-merging-interval new segments, and also
+ * whenever the segment budget has been exceeded. If merging does not bring
+ * the segment count and bitmap memory back under the budget, discard the
+ * oldest segments.
+ */
+static void thread_maybe_merge_segments(void)
+{
+   const Bool over_budget = thread_segment_budget_exceeded(4);
+
+   if ((s_segment_merging
+        && ++s_new_segments_since_last_merge >= s_segment_merge_interval)
+       || over_budget)
+   {
+      thread_discard_ordered_segments();
+      thread_merge_segments();
+   }
+   if (over_budget && thread_segment_budget_exceeded(3))
+      thread_discard_segments_over_budget();
+}
+
 /**
  * Create a new segment for the specified thread, and discard any segments
  * that cannot cause races anymore.
@@ -1154,12 +1309,7 @@ void DRD_(thread_new_segment)(const DrdThreadId tid)
 
    tl_assert(thread_conflict_set_up_to_date(DRD_(g_drd_running_tid)));
 
-   if (s_segment_merging
-       && ++s_new_segments_since_last_merge >= s_segment_merge_interval)
-   {
-      thread_discard_ordered_segments();
-      thread_merge_segments();
-   }
+   thread_maybe_merge_segments();
 }
 
 /** Call this function after thread 'joiner' joined thread 'joinee'. */
@@ -1267,12 +1417,7 @@ void DRD_(thread_new_segment_and_combine_vc)(DrdThreadId tid, const Segment* sg)
 
    thread_combine_vc_sync(tid, sg);
 
-   if (s_segment_merging
-       && ++s_new_segments_since_last_merge >= s_segment_merge_interval)
-   {
-      thread_discard_ordered_segments();
-      thread_merge_segments();
-   }
+   thread_maybe_merge_segments();
 }
 
 /**
@@ -1467,6 +1612,8 @@ static void thread_compute_conflict_set(struct bitmap** conflict_set,
                                         const DrdThreadId tid)
 {
    Segment* p;
+   /* Whether this is the conflict set of the running thread. */
+   const Bool update_flags = conflict_set == &DRD_(g_conflict_set);
 
    tl_assert(0 <= (int)tid && tid < DRD_N_THREADS
              && tid != DRD_INVALID_THREADID);
@@ -1484,6 +1631,8 @@ static void thread_compute_conflict_set(struct bitmap** conflict_set,
    } else {
       *conflict_set = DRD_(bm_new)();
    }
+   if (update_flags)
+      s_conflict_set_marked = False;
 
    if (s_trace_conflict_set) {
       HChar* str;
@@ -1509,12 +1658,22 @@ static void thread_compute_conflict_set(struct bitmap** conflict_set,
       }
 
       for (j = 0; j < DRD_N_THREADS; j++) {
+         if (j == tid && update_flags) {
+            Segment* q;
+
+            for (q = DRD_(g_threadinfo)[j].sg_last; q; q = q->thr_prev)
+               q->in_conflict_set = False;
+         }
          if (j != tid && DRD_(IsValidDrdThreadId)(j)) {
             Segment* q;
 
             for (q = DRD_(g_threadinfo)[j].sg_last; q; q = q->thr_prev) {
-               if (!DRD_(vc_lte)(&q->vc, &p->vc)
-                   && !DRD_(vc_lte)(&p->vc, &q->vc)) {
+               const Bool included = !DRD_(vc_lte)(&q->vc, &p->vc)
+                                     && !DRD_(vc_lte)(&p->vc, &q->vc);
+
+               if (update_flags)
+                  q->in_conflict_set = included;
+               if (included) {
                   if (s_trace_conflict_set) {
                      HChar* str;
 
@@ -1553,6 +1712,121 @@ static void thread_compute_conflict_set(struct bitmap** conflict_set,
    }
 }
 
+/**
+ * Recalculate the second-level bitmaps of the conflict set for which
+ * bitmap2::recalc has been set from the segments that are in the conflict set
+ * of thread tid, and clear bitmap2::recalc afterwards.
+ */
+static void thread_recalc_marked_conflict_set(const DrdThreadId tid)
+{
+   const Segment* const p = DRD_(g_threadinfo)[tid].sg_last;
+   unsigned j;
+
+   DRD_(bm_clear_marked)(DRD_(g_conflict_set));
+
+   for (j = 0; j < DRD_N_THREADS; j++) {
+      if (j != tid && DRD_(IsValidDrdThreadId)(j)) {
+         Segment* q;
+         for (q = DRD_(g_threadinfo)[j].sg_last;
+              q && !DRD_(vc_lte)(&q->vc, &p->vc);
+              q = q->thr_prev) {
+            if (q->in_conflict_set)
+               DRD_(bm_merge2_marked)(DRD_(g_conflict_set), DRD_(sg_bm)(q));
+         }
+      }
+   }
+
+   DRD_(bm_remove_cleared_marked)(DRD_(g_conflict_set));
+   DRD_(bm_unmark)(DRD_(g_conflict_set));
+   s_conflict_set_marked = False;
+}
+
+/**
+ * Update the conflict set after the running thread has changed into tid.
+ * Only the parts of the conflict set to which the segments contributed that
+ * entered or left the conflict set are recalculated. Falls back to
+ * thread_compute_conflict_set() if the conflict set changes substantially.
+ */
+static void thread_switch_conflict_set(const DrdThreadId tid)
+{
+   const Segment* p;
+   unsigned j;
+   unsigned segments = 0;
+   unsigned changed = 0;
+
+   tl_assert(0 <= (int)tid && tid < DRD_N_THREADS
+             && tid != DRD_INVALID_THREADID);
+   tl_assert(tid == DRD_(g_drd_running_tid));
+
+   if (! DRD_(g_conflict_set)) {
+      thread_compute_conflict_set(&DRD_(g_conflict_set), tid);
+      return;
+   }
+
+   p = DRD_(g_threadinfo)[tid].sg_last;
+   for (j = 0; j < DRD_N_THREADS; j++) {
+      if (DRD_(IsValidDrdThreadId)(j)) {
+         Segment* q;
+         for (q = DRD_(g_threadinfo)[j].sg_last; q; q = q->thr_prev) {
+            const Bool included = j != tid
+               && !DRD_(vc_lte)(&q->vc, &p->vc)
+               && !DRD_(vc_lte)(&p->vc, &q->vc);
+            segments++;
+            if (included != q->in_conflict_set)
+               changed++;
+         }
+      }
+   }
+
+   if (changed == 0 && ! s_conflict_set_marked) {
+      s_switch_conflict_set_unchanged_count++;
+      tl_assert(thread_conflict_set_up_to_date(tid));
+      return;
+   }
+   if (2 * changed > segments) {
+      thread_compute_conflict_set(&DRD_(g_conflict_set), tid);
+      return;
+   }
+
+   if (s_trace_conflict_set) {
+      HChar* str;
+
+      str = DRD_(vc_aprint)(&p->vc);
+      VG_(message)(Vg_DebugMsg,
+                   "switching conflict set to thread %u with vc %s:"
+                   " %u of %u segments changed\n", tid, str, changed,
+                   segments);
+      VG_(free)(str);
+   }
+
+   for (j = 0; changed && j < DRD_N_THREADS; j++) {
+      if (DRD_(IsValidDrdThreadId)(j)) {
+         Segment* q;
+         for (q = DRD_(g_threadinfo)[j].sg_last; q; q = q->thr_prev) {
+            const Bool included = j != tid
+               && !DRD_(vc_lte)(&q->vc, &p->vc)
+               && !DRD_(vc_lte)(&p->vc, &q->vc);
+            if (included != q->in_conflict_set) {
+               DRD_(bm_mark)(DRD_(g_conflict_set), DRD_(sg_bm)(q));
+               q->in_conflict_set = included;
+            }
+         }
+      }
+   }
+
+   thread_recalc_marked_conflict_set(tid);
+
+   s_switch_conflict_set_count++;
+
+   if (s_trace_conflict_set_bm) {
+      VG_(message)(Vg_DebugMsg, "[%u] switched conflict set:\n", tid);
+      DRD_(bm_print)(DRD_(g_conflict_set));
+      VG_(message)(Vg_DebugMsg, "[%u] end of switched conflict set.\n", tid);
+   }
+
+   tl_assert(thread_conflict_set_up_to_date(tid));
+}
+
 /**
  * Update the conflict set after the vector clock of thread tid has been
  * updated from old_vc to its current value, either because a new segment has
@@ -1562,7 +1836,6 @@ void DRD_(thread_update_conflict_set)(const DrdThreadId tid,
                                       const VectorClock* const old_vc)
 {
    const VectorClock* new_vc;
-   Segment* p;
    unsigned j;
 
    tl_assert(0 <= (int)tid && tid < DRD_N_THREADS
@@ -1584,8 +1857,6 @@ void DRD_(thread_update_conflict_set)(const DrdThreadId tid,
    new_vc = DRD_(thread_get_vc)(tid);
    tl_assert(DRD_(vc_lte)(old_vc, new_vc));
 
-   DRD_(bm_unmark)(DRD_(g_conflict_set));
-
    for (j = 0; j < DRD_N_THREADS; j++)
    {
       Segment* q;
@@ -1596,8 +1867,7 @@ void DRD_(thread_update_conflict_set)(const DrdThreadId tid,
       for (q = DRD_(g_threadinfo)[j].sg_last;
            q && !DRD_(vc_lte)(&q->vc, new_vc);
            q = q->thr_prev) {
-         const Bool included_in_old_conflict_set
-            = !DRD_(vc_lte)(old_vc, &q->vc);
+         const Bool included_in_old_conflict_set = q->in_conflict_set;
          const Bool included_in_new_conflict_set
             = !DRD_(vc_lte)(new_vc, &q->vc);
 
@@ -1612,13 +1882,14 @@ void DRD_(thread_update_conflict_set)(const DrdThreadId tid,
                          ? "merging" : "ignoring", str);
             VG_(free)(str);
          }
-         if (included_in_old_conflict_set != included_in_new_conflict_set)
+         if (included_in_old_conflict_set != included_in_new_conflict_set) {
             DRD_(bm_mark)(DRD_(g_conflict_set), DRD_(sg_bm)(q));
+            q->in_conflict_set = included_in_new_conflict_set;
+         }
       }
 
       for ( ; q && !DRD_(vc_lte)(&q->vc, old_vc); q = q->thr_prev) {
-         const Bool included_in_old_conflict_set
-            = !DRD_(vc_lte)(old_vc, &q->vc);
+         const Bool included_in_old_conflict_set = q->in_conflict_set;
          const Bool included_in_new_conflict_set
             = !DRD_(vc_lte)(&q->vc, new_vc)
             && !DRD_(vc_lte)(new_vc, &q->vc);
@@ -1634,27 +1905,14 @@ void DRD_(thread_update_conflict_set)(const DrdThreadId tid,
                          ? "merging" : "ignoring", str);
             VG_(free)(str);
          }
-         if (included_in_old_conflict_set != included_in_new_conflict_set)
+         if (included_in_old_conflict_set != included_in_new_conflict_set) {
             DRD_(bm_mark)(DRD_(g_conflict_set), DRD_(sg_bm)(q));
-      }
-   }
-
-   DRD_(bm_clear_marked)(DRD_(g_conflict_set));
-
-   p = DRD_(g_threadinfo)[tid].sg_last;
-   for (j = 0; j < DRD_N_THREADS; j++) {
-      if (j != tid && DRD_(IsValidDrdThreadId)(j)) {
-         Segment* q;
-         for (q = DRD_(g_threadinfo)[j].sg_last;
-              q && !DRD_(vc_lte)(&q->vc, &p->vc);
-              q = q->thr_prev) {
-            if (!DRD_(vc_lte)(&p->vc, &q->vc))
-               DRD_(bm_merge2_marked)(DRD_(g_conflict_set), DRD_(sg_bm)(q));
+            q->in_conflict_set = included_in_new_conflict_set;
          }
       }
    }
 
-   DRD_(bm_remove_cleared_marked)(DRD_(g_conflict_set));
+   thread_recalc_marked_conflict_set(tid);
 
    s_update_conflict_set_count++;
 
@@ -1720,6 +1978,32 @@ ULong DRD_(thread_get_update_conflict_set_join_count)(void)
    return s_update_conflict_set_join_count;
 }
 
+/**
+ * Return how many times the conflict set has been updated partially because
+ * of a context switch.
+ */
+ULong DRD_(thread_get_switch_conflict_set_count)(void)
+{
+   return s_switch_conflict_set_count;
+}
+
+/**
+ * Return how many context switches did not change the conflict set.
+ */
+ULong DRD_(thread_get_switch_conflict_set_unchanged_count)(void)
+{
+   return s_switch_conflict_set_unchanged_count;
+}
+
+/**
+ * Return the number of segments that have been discarded because of
+ * --max-segments or --max-segment-memory.
+ */
+ULong DRD_(thread_get_discard_over_budget_count)(void)
+{
+   return s_discard_over_budget_count;
+}
+
 /**
  * Return the number of first-level bitmaps that have been created during
  * conflict set updates.
@@ -138,6 +138,8 @@ void DRD_(thread_set_trace_fork_join)(const Bool t);
 void DRD_(thread_set_segment_merging)(const Bool m);
 int DRD_(thread_get_segment_merge_interval)(void);
 void DRD_(thread_set_segment_merge_interval)(const int i);
+void DRD_(thread_set_max_segments)(const ULong n);
+void DRD_(thread_set_max_segment_memory)(const ULong bytes);
 void DRD_(thread_set_join_list_vol)(const int jlv);
 
 void DRD_(thread_init)(void);
@@ -211,6 +213,10 @@ ULong DRD_(thread_get_update_conflict_set_count)(void);
 ULong DRD_(thread_get_update_conflict_set_new_sg_count)(void);
 ULong DRD_(thread_get_update_conflict_set_sync_count)(void);
 ULong DRD_(thread_get_update_conflict_set_join_count)(void);
+ULong DRD_(thread_get_switch_conflict_set_count)(void);
+ULong DRD_(thread_get_switch_conflict_set_unchanged_count)(void);
+ULong DRD_(thread_get_discard_over_budget_count)(void);
+ULong DRD_(thread_get_segment_memory)(void);
 ULong DRD_(thread_get_conflict_set_bitmap_creation_count)(void);
 ULong DRD_(thread_get_conflict_set_bitmap2_creation_count)(void);
 
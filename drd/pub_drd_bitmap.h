@@ -147,5 +147,8 @@ void DRD_(bm_print)(struct bitmap* bm);
 ULong DRD_(bm_get_bitmap_creation_count)(void);
 ULong DRD_(bm_get_bitmap2_creation_count)(void);
 ULong DRD_(bm_get_bitmap2_merge_count)(void);
+ULong DRD_(bm_get_bitmap2_memory)(void);
+ULong DRD_(bm_get_max_bitmap2_memory)(void);
+ULong DRD_(bm_get_memory)(struct bitmap* const bm);
 
 #endif /* __PUB_DRD_BITMAP_H */
@@ -319,6 +319,42 @@ void bm_test3(const int outer_loop_step, const int inner_loop_step)
   DRD_(bm_delete)(bm1);
 }
 
+/**
+ * Test whether the functions that look at a range of bits one word at a time
+ * agree with the bit by bit lookups.
+ */
+void bm_test4(void)
+{
+  unsigned i, j;
+  struct bitmap* bm1;
+  struct bitmap* bm2;
+
+  const Addr lb = make_address(2, 0) - 2 * BITS_PER_UWORD;
+  const Addr ub = make_address(2, 0) + 2 * BITS_PER_UWORD;
+  const Addr s  = lb + BITS_PER_UWORD / 2 + 1;
+  const Addr e  = ub - BITS_PER_UWORD - 3;
+
+  bm1 = DRD_(bm_new)();
+  DRD_(bm_access_range_store)(bm1, s, e);
+  bm2 = DRD_(bm_new)();
+  DRD_(bm_merge2)(bm2, bm1);
+  assert(bm_equal_print_diffs(bm1, bm2));
+  assert(! DRD_(bm_has_any_load)(bm2, lb, ub));
+  for (i = lb; i < ub; i++)
+  {
+    for (j = i + 1; j <= ub; j++)
+    {
+      const Bool any = i < e && s < j;
+      assert(DRD_(bm_has_any_store)(bm2, i, j) == any);
+      assert(DRD_(bm_has_any_access)(bm2, i, j) == any);
+      assert(DRD_(bm_has_conflict_with)(bm2, i, j, eLoad) == any);
+      assert(DRD_(bm_has_conflict_with)(bm2, i, j, eStore) == any);
+    }
+  }
+  DRD_(bm_delete)(bm2);
+  DRD_(bm_delete)(bm1);
+}
+
 int main(int argc, char** argv)
 {
   int outer_loop_step = ADDR_GRANULARITY;
@@ -352,6 +388,7 @@ int main(int argc, char** argv)
   bm_test1();
   bm_test2();
   bm_test3(outer_loop_step, inner_loop_step);
+  bm_test4();
   DRD_(bm_module_cleanup)();
 
   fprintf(stderr, "End of DRD BM unit test.\n");
@@ -82,12 +82,18 @@ Bool  HG_(clo_delta_stacktrace) = False;
 
 UWord HG_(clo_conflict_cache_size) = 2000000;
 
+UWord HG_(clo_history_budget) = 0;
+
 UWord HG_(clo_sanity_flags) = 0;
 
 Bool  HG_(clo_free_is_write) = False;
 
 UWord HG_(clo_vts_pruning) = 1;
 
+UWord HG_(clo_vts_gc_step) = 1000;
+
+UInt HG_(clo_shadow_cache_bits) = 16;
+
 Bool  HG_(clo_check_stack_refs) = True;
 
 /*--------------------------------------------------------------------*/
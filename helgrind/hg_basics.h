@@ -110,6 +110,12 @@ extern Bool  HG_(clo_delta_stacktrace);
    amd 10 million.  Default is 1 million. */
 extern UWord HG_(clo_conflict_cache_size);
 
+/* When doing "full" history collection, the maximum memory in MB used
+   by the previous-access map and the stack traces it refers to.  When
+   reached, the least recently used entries are discarded.  0 means no
+   limit other than HG_(clo_conflict_cache_size). */
+extern UWord HG_(clo_history_budget);
+
 /* Sanity check level.  This is an or-ing of
    SCE_{THREADS,LOCKS,BIGRANGE,ACCESS,LAOG}. */
 extern UWord HG_(clo_sanity_flags);
@@ -133,6 +139,16 @@ extern Bool HG_(clo_free_is_write);
       mostly a big time waster, but minimises space use. */
 extern UWord HG_(clo_vts_pruning);
 
+/* Nr of vts_tab entries a VTS GC (and pruning, if done) visits per
+   step.  A GC round is spread over steps taken at later
+   synchronisation events and thread switches.  0 means the whole
+   round is done at once.  Default is 1000. */
+extern UWord HG_(clo_vts_gc_step);
+
+/* The shadow memory cache has 2^HG_(clo_shadow_cache_bits) lines.
+   Must be between 10 and 20.  Default is 16. */
+extern UInt HG_(clo_shadow_cache_bits);
+
 /* When False, race checking ignores memory references which are to
    the stack, which speeds things up a bit.  Default: True. */
 extern Bool HG_(clo_check_stack_refs); 
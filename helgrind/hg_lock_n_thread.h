@@ -76,6 +76,22 @@ typedef  UInt         ThrID;
    The core may later re-use the same ThreadId for what is a logically
    completely different thread, which of course must have a different
    Thread structure. */
+
+/* An entry of a Thread's lockset transition cache: adding the lock
+   (.lk_op & 1) or removing it (!(.lk_op & 1)) to/from lockset .from
+   gives lockset .to.  The lock is the Lock* .lk_op & ~1, and .lk_op
+   is zero for an unused entry. */
+#define N_LSET_CACHE_BITS 4
+#define N_LSET_CACHE      (1 << N_LSET_CACHE_BITS)
+#define N_LSET_CACHE_WAYS 4
+typedef
+   struct {
+      UWord     lk_op;
+      WordSetID from;
+      WordSetID to;
+   }
+   LsetCacheEnt;
+
 typedef
    struct _Thread {
       /* ADMIN */
@@ -86,6 +102,8 @@ typedef
       /* USEFUL */
       WordSetID locksetA; /* WordSet of Lock* currently held by thread */
       WordSetID locksetW; /* subset of locksetA held in w-mode */
+      /* Recent transitions of locksetA/W, see lockset_transition */
+      LsetCacheEnt lset_cache[N_LSET_CACHE];
       /* EXPOSITION */
       /* Place where parent was when this thread was created. */
       ExeContext* created_at;
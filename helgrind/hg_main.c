@@ -194,6 +194,53 @@ static Thread* mk_Thread ( Thr* hbthr ) {
    return thread;
 }
 
+/* Adds lk to (if add) or removes it from (if !add) lockset ws of thr.
+   Threads tend to take and release the same few locks over and over,
+   so the resulting locksets are looked up in a small per-thread cache
+   of recent transitions before going to univ_lsets.  The cache is
+   N_LSET_CACHE_WAYS-way set associative, with the entries of a set in
+   most recently used first order.  The entries never go stale, as the
+   locksets in univ_lsets are never deleted (HG_(dieWS) is only used on
+   univ_laog), and the result only depends on the lockset and the Lock*
+   value. */
+static UWord stats__lset_cache_queries = 0;
+static UWord stats__lset_cache_misses  = 0;
+
+static WordSetID lockset_transition ( Thread* thr, WordSetID ws,
+                                      Lock* lk, Bool add )
+{
+   UWord         lk_op = (UWord)lk | (add ? 1 : 0);
+   UInt          h     = ((UInt)(lk_op >> 3) ^ (UInt)lk_op
+                          ^ ((UInt)ws * 0x9E3779B1)) * 0x9E3779B1;
+   LsetCacheEnt* set   = &thr->lset_cache[(h >> (32 - N_LSET_CACHE_BITS))
+                                          & ~(N_LSET_CACHE_WAYS - 1)];
+   LsetCacheEnt  ent;
+   UInt          i;
+
+   tl_assert(((UWord)lk & 1) == 0);
+   stats__lset_cache_queries++;
+   if (LIKELY(set[0].lk_op == lk_op && set[0].from == ws))
+      return set[0].to;
+   for (i = 1; i < N_LSET_CACHE_WAYS; i++) {
+      if (set[i].lk_op == lk_op && set[i].from == ws)
+         break;
+   }
+   if (i < N_LSET_CACHE_WAYS) {
+      ent = set[i];
+   } else {
+      stats__lset_cache_misses++;
+      i = N_LSET_CACHE_WAYS - 1;
+      ent.lk_op = lk_op;
+      ent.from  = ws;
+      ent.to    = add ? HG_(addToWS)( univ_lsets, ws, (UWord)lk )
+                      : HG_(delFromWS)( univ_lsets, ws, (UWord)lk );
+   }
+   for (; i > 0; i--)
+      set[i] = set[i-1];
+   set[0] = ent;
+   return ent.to;
+}
+
 // Make a new lock which is unlocked (hence ownerless)
 // and insert the new lock in admin_locks double linked list.
 static Lock* mk_LockN ( LockKind kind, Addr guestaddr ) {
@@ -378,13 +425,13 @@ static void remove_Lock_from_locksets_of_all_owning_Threads( Lock* lk )
       tl_assert(HG_(elemWS)( univ_lsets,
                              thr->locksetA, (UWord)lk ));
       thr->locksetA
-         = HG_(delFromWS)( univ_lsets, thr->locksetA, (UWord)lk );
+         = lockset_transition( thr, thr->locksetA, lk, False/*del*/ );
 
       if (lk->heldW) {
          tl_assert(HG_(elemWS)( univ_lsets,
                                 thr->locksetW, (UWord)lk ));
          thr->locksetW
-            = HG_(delFromWS)( univ_lsets, thr->locksetW, (UWord)lk );
+            = lockset_transition( thr, thr->locksetW, lk, False/*del*/ );
       }
    }
    VG_(doneIterBag)( lk->heldBy );
@@ -1183,8 +1230,8 @@ void evhH__post_thread_w_acquires_lock ( Thread* thr,
       laog__pre_thread_acquires_lock( thr, lk );
    }
    /* update the thread's held-locks set */
-   thr->locksetA = HG_(addToWS)( univ_lsets, thr->locksetA, (UWord)lk );
-   thr->locksetW = HG_(addToWS)( univ_lsets, thr->locksetW, (UWord)lk );
+   thr->locksetA = lockset_transition( thr, thr->locksetA, lk, True/*add*/ );
+   thr->locksetW = lockset_transition( thr, thr->locksetW, lk, True/*add*/ );
    /* fall through */
 
   error:
@@ -1258,7 +1305,7 @@ void evhH__post_thread_r_acquires_lock ( Thread* thr,
       laog__pre_thread_acquires_lock( thr, lk );
    }
    /* update the thread's held-locks set */
-   thr->locksetA = HG_(addToWS)( univ_lsets, thr->locksetA, (UWord)lk );
+   thr->locksetA = lockset_transition( thr, thr->locksetA, lk, True/*add*/ );
    /* but don't update thr->locksetW, since lk is only rd-held */
    /* fall through */
 
@@ -1390,9 +1437,9 @@ void evhH__pre_thread_releases_lock ( Thread* thr,
       //}
       /* update this thread's lockset accordingly. */
       thr->locksetA
-         = HG_(delFromWS)( univ_lsets, thr->locksetA, (UWord)lock );
+         = lockset_transition( thr, thr->locksetA, lock, False/*del*/ );
       thr->locksetW
-         = HG_(delFromWS)( univ_lsets, thr->locksetW, (UWord)lock );
+         = lockset_transition( thr, thr->locksetW, lock, False/*del*/ );
       /* push our VC into the lock */
       tl_assert(thr->hbthr);
       tl_assert(lock->hbso);
@@ -5786,6 +5833,9 @@ static Bool hg_process_cmd_line_option ( const HChar* arg )
    else if VG_BINT_CLO(arg, "--conflict-cache-size",
                        HG_(clo_conflict_cache_size), 10*1000, 150*1000*1000) {}
 
+   else if VG_BINT_CLO(arg, "--history-budget",
+                       HG_(clo_history_budget), 0, 1024*1024) {}
+
    /* "stuvwx" --> stuvwx (binary) */
    else if VG_STR_CLO(arg, "--hg-sanity-flags", tmp_str) {
       Int j;
@@ -5816,6 +5866,11 @@ static Bool hg_process_cmd_line_option ( const HChar* arg )
                             HG_(clo_vts_pruning), 1);
    else if VG_XACT_CLO(arg, "--vts-pruning=always",
                             HG_(clo_vts_pruning), 2);
+   else if VG_BINT_CLO(arg, "--vts-gc-step",
+                       HG_(clo_vts_gc_step), 0, 1000000) {}
+
+   else if VG_BINT_CLO(arg, "--shadow-cache-bits",
+                       HG_(clo_shadow_cache_bits), 10, 20) {}
 
    else if VG_BOOL_CLO(arg, "--check-stack-refs",
                             HG_(clo_check_stack_refs)) {}
@@ -5844,6 +5899,8 @@ static void hg_print_usage ( void )
 "        yes : derive a stacktrace from the previous stacktrace\n"
 "          if there was no call/return or similar instruction\n"
 "    --conflict-cache-size=N   size of 'full' history cache [2000000]\n"
+"    --history-budget=<MB>     memory limit of 'full' history cache,\n"
+"                              0 for no limit [0]\n"
 "    --check-stack-refs=no|yes race-check reads and writes on the\n"
 "                              main stack and thread stacks? [yes]\n"
 "    --ignore-thread-creation=yes|no Ignore activities during thread\n"
@@ -5871,6 +5928,9 @@ static void hg_print_debug_usage ( void )
 "       never:   is never done (may cause big space leaks in Helgrind)\n"
 "       auto:    done just often enough to keep space usage under control\n"
 "       always:  done after every VTS GC (mostly just a big time waster)\n"
+"    --vts-gc-step=<number>   VTS GC and pruning visit <number> VTSs per\n"
+"        step, spreading a GC over later sync events; 0 = all at once [1000]\n"
+"    --shadow-cache-bits=<10..20>  shadow memory cache has 2^<N> lines [16]\n"
     );
 }
 
@@ -5901,6 +5961,8 @@ static void hg_print_stats (void)
    VG_(printf)("\n");
    VG_(printf)("        locksets: %'8d unique lock sets\n",
                (Int)HG_(cardinalityWSU)( univ_lsets ));
+   VG_(printf)("   lockset cache: %'8lu queries, %'lu misses\n",
+               stats__lset_cache_queries, stats__lset_cache_misses);
    if (HG_(clo_track_lockorders)) {
       VG_(printf)("       univ_laog: %'8d unique lock sets\n",
                   (Int)HG_(cardinalityWSU)( univ_laog ));
@@ -216,14 +216,19 @@ typedef
 #define FI_LINE_SZB_LOG2  5
 #define FI_NUM_LINES_LOG2 10
 
+/* The nr of lines of each filter is adapted to the thread's working
+   set, between these limits.  A filter starts with FI_NUM_LINES. */
+#define FI_MIN_NUM_LINES_LOG2 8
+#define FI_MAX_NUM_LINES_LOG2 13
+
 #define FI_LINE_SZB       (1 << FI_LINE_SZB_LOG2)
 #define FI_NUM_LINES      (1 << FI_NUM_LINES_LOG2)
 
 #define FI_TAG_MASK        (~(Addr)(FI_LINE_SZB - 1))
 #define FI_GET_TAG(_a)     ((_a) & FI_TAG_MASK)
 
-#define FI_GET_LINENO(_a)  ( ((_a) >> FI_LINE_SZB_LOG2) \
-                             & (Addr)(FI_NUM_LINES-1) )
+#define FI_GET_LINENO(_fi,_a)  ( ((_a) >> FI_LINE_SZB_LOG2) \
+                                 & (_fi)->lineno_mask )
 
 
 /* In the lines, each 8 bytes are treated individually, and are mapped
@@ -242,7 +247,12 @@ typedef
 */
 
 /* tags are separated from lines.  tags are Addrs and are
-   the base address of the line. */
+   the base address of the line.  A tag of 1 (not line aligned)
+   marks a line holding nothing.
+
+   The linenos of the lines with a valid tag are recorded in dirty,
+   so that clearing the filter is proportional to the nr of lines used
+   since the previous clear, rather than to the filter size. */
 typedef
    struct {
       UShort u16s[FI_LINE_SZB / 8]; /* each UShort covers 8 bytes */
@@ -251,8 +261,13 @@ typedef
 
 typedef
    struct {
-      Addr   tags[FI_NUM_LINES];
-      FiLine lines[FI_NUM_LINES];
+      UWord   lineno_mask; /* nr of lines - 1 */
+      Addr*   tags;
+      FiLine* lines;
+      UInt*   dirty;
+      UInt    nr_dirty;  /* nr of valid entries in dirty */
+      UInt    nr_evicts; /* nr of valid lines evicted since last clear */
+      UInt    nr_small;  /* nr of successive clears with few dirty lines */
    }
    Filter;
 
@@ -325,6 +340,12 @@ struct _Thr {
       set them to VtsID_INVALID. */
    Bool joinedwith_done;
 
+   /* Is initially False, and is set to True when a round of VTS
+      pruning starts removing this thread's entries from the VTSs.
+      From then on, those entries are ignored when comparing VTSs, so
+      that it makes no difference whether a VTS has been pruned yet. */
+   Bool pruned;
+
    /* A small integer giving a unique identity to this Thr.  See
       comments on the definition of ScalarTS for details. */
    ThrID thrid : SCALARTS_N_THRBITS;
@@ -594,8 +615,9 @@ static inline Bool is_sane_SecMap ( SecMap* sm ) {
 
 /* ------ Cache ------ */
 
-#define N_WAY_BITS 16
-#define N_WAY_NENT (1 << N_WAY_BITS)
+/* The cache has 2^N_WAY_BITS entries, N_WAY_BITS being given by
+   --shadow-cache-bits. */
+#define N_WAY_BITS (HG_(clo_shadow_cache_bits))
 
 /* Each tag is the address of the associated CacheLine, rounded down
    to a CacheLine address boundary.  A CacheLine size must be a power
@@ -606,8 +628,9 @@ static inline Bool is_sane_SecMap ( SecMap* sm ) {
    with a bogus tag. */
 typedef
    struct {
-      CacheLine lyns0[N_WAY_NENT];
-      Addr      tags0[N_WAY_NENT];
+      CacheLine* lyns0;
+      Addr*      tags0;
+      UWord      nent; /* 1 << N_WAY_BITS */
    }
    Cache;
 
@@ -624,9 +647,31 @@ static inline Bool is_valid_scache_tag ( Addr tag ) {
 static WordFM* map_shmem = NULL; /* WordFM Addr SecMap* */
 static Cache   cache_shmem;
 
+/* SecMap table: a two-level direct-mapped table giving the SecMap of
+   each SecMap base address below 2^SM_TAB_ADDR_BITS, or NULL if there
+   is none, similarly to memcheck's primary_map.  It holds the same
+   SecMaps as map_shmem for these addresses, so that finding them
+   does not need a map_shmem lookup.  map_shmem is still used for
+   higher addresses, and to iterate over all SecMaps.  The second
+   level tables are allocated on demand, each covers
+   2^(N_SECMAP_BITS + SM_TAB_L2_BITS) bytes of address space. */
+#if VG_WORDSIZE == 8
+#  define SM_TAB_ADDR_BITS 48
+#else
+#  define SM_TAB_ADDR_BITS 32
+#endif
+#define SM_TAB_L2_BITS 17
+#define SM_TAB_L1_BITS (SM_TAB_ADDR_BITS - N_SECMAP_BITS - SM_TAB_L2_BITS)
+#define SM_TAB_L1_NENT (1 << SM_TAB_L1_BITS)
+#define SM_TAB_L2_NENT (1 << SM_TAB_L2_BITS)
+
+static SecMap** sm_tab[SM_TAB_L1_NENT];
+
 
 static UWord stats__secmaps_search       = 0; // # SM finds
+static UWord stats__secmaps_search_tab   = 0; // # SM sm_tab lookups
 static UWord stats__secmaps_search_slow  = 0; // # SM lookupFMs
+static UWord stats__secmaps_tab_l2       = 0; // # sm_tab 2nd levels
 static UWord stats__secmaps_allocd       = 0; // # SecMaps issued
 static UWord stats__secmaps_in_map_shmem = 0; // # SecMaps 'live'
 static UWord stats__secmaps_scanGC       = 0; // # nr of scan GC done.
@@ -669,6 +714,8 @@ static UWord stats__vts__tick            = 0; // # calls to VTS__tick
 static UWord stats__vts__join            = 0; // # calls to VTS__join
 static UWord stats__vts__cmpLEQ          = 0; // # calls to VTS__cmpLEQ
 static UWord stats__vts__cmp_structural  = 0; // # calls to VTS__cmp_structural
+static UWord stats__vts__join_dense      = 0; // # entries joined densely
+static UWord stats__vts__cmpLEQ_dense    = 0; // # entries compared densely
 static UWord stats__vts_tab_GC           = 0; // # nr of vts_tab GC
 static UWord stats__vts_pruning          = 0; // # nr of vts pruning
 
@@ -812,6 +859,45 @@ static SecMap* shmem__alloc_or_recycle_SecMap ( void )
    return sm;
 }
 
+/* Returns the sm_tab entry for the SecMap base address gaKey, or NULL
+   if gaKey is not covered by sm_tab.  If alloc, allocates the second
+   level table if needed, otherwise returns NULL if there is none. */
+static inline SecMap** sm_tab_entry ( Addr gaKey, Bool alloc )
+{
+   UWord    ix = gaKey >> N_SECMAP_BITS;
+   UWord    l1 = ix >> SM_TAB_L2_BITS;
+   SecMap** l2;
+
+   if (UNLIKELY(l1 >= SM_TAB_L1_NENT))
+      return NULL;
+   l2 = sm_tab[l1];
+   if (UNLIKELY(l2 == NULL)) {
+      if (!alloc)
+         return NULL;
+      l2 = HG_(zalloc)( "libhb.sm_tab_entry.1",
+                        SM_TAB_L2_NENT * sizeof(SecMap*) );
+      sm_tab[l1] = l2;
+      stats__secmaps_tab_l2++;
+   }
+   return &l2[ix & (SM_TAB_L2_NENT - 1)];
+}
+
+static inline Bool sm_tab_covers ( Addr gaKey )
+{
+   return (gaKey >> (N_SECMAP_BITS + SM_TAB_L2_BITS)) < SM_TAB_L1_NENT;
+}
+
+/* Forget about the SecMap sm at gaKey, which is being removed from
+   map_shmem. */
+static inline void sm_tab_remove ( Addr gaKey, SecMap* sm )
+{
+   if (sm_tab_covers(gaKey)) {
+      SecMap** sm_p = sm_tab_entry(gaKey, False);
+      tl_assert (sm_p && *sm_p == sm);
+      *sm_p = NULL;
+   }
+}
+
 typedef struct { Addr gaKey; SecMap* sm; } SMCacheEnt;
 static SMCacheEnt smCache[3] = { {1,NULL}, {1,NULL}, {1,NULL} };
 
@@ -836,16 +922,22 @@ static SecMap* shmem__find_SecMap ( Addr ga )
       return smCache[1].sm;
    }
    // end Cache
-   stats__secmaps_search_slow++;
-   if (VG_(lookupFM)( map_shmem,
-                      NULL/*keyP*/, (UWord*)&sm, (UWord)gaKey )) {
-      tl_assert(sm != NULL);
+   if (LIKELY(sm_tab_covers(gaKey))) {
+      SecMap** sm_p = sm_tab_entry(gaKey, False);
+      stats__secmaps_search_tab++;
+      if (sm_p)
+         sm = *sm_p;
+   } else {
+      stats__secmaps_search_slow++;
+      if (!VG_(lookupFM)( map_shmem,
+                          NULL/*keyP*/, (UWord*)&sm, (UWord)gaKey ))
+         tl_assert(sm == NULL);
+   }
+   if (sm != NULL) {
       smCache[2] = smCache[1];
       smCache[1] = smCache[0];
       smCache[0].gaKey = gaKey;
       smCache[0].sm    = sm;
-   } else {
-      tl_assert(sm == NULL);
    }
    return sm;
 }
@@ -916,6 +1008,7 @@ static UWord shmem__SecMap_do_GC(Bool really)
         }
         if (!VG_(delFromFM)(map_shmem, &fm_gaKey, (UWord*)&fm_sm, gaKey))
           tl_assert (0);
+        sm_tab_remove (gaKey, sm);
         stats__secmaps_in_map_shmem--;
         tl_assert (gaKey == fm_gaKey);
         tl_assert (sm == fm_sm);
@@ -965,6 +1058,8 @@ static SecMap* shmem__find_or_alloc_SecMap ( Addr ga )
       sm = shmem__alloc_or_recycle_SecMap();
       tl_assert(sm);
       VG_(addToFM)( map_shmem, (UWord)gaKey, (UWord)sm );
+      if (sm_tab_covers(gaKey))
+         *sm_tab_entry(gaKey, True) = sm;
       stats__secmaps_in_map_shmem++;
       if (CHECK_ZSM) tl_assert(is_sane_SecMap(sm));
       return sm;
@@ -1508,7 +1603,7 @@ static __attribute__((noinline)) void cacheline_wback ( UWord wix )
    if (0)
    VG_(printf)("scache wback line %d\n", (Int)wix);
 
-   tl_assert(wix >= 0 && wix < N_WAY_NENT);
+   tl_assert(wix >= 0 && wix < cache_shmem.nent);
 
    tag =  cache_shmem.tags0[wix];
    cl  = &cache_shmem.lyns0[wix];
@@ -1647,7 +1742,7 @@ static __attribute__((noinline)) void cacheline_fetch ( UWord wix )
    if (0)
    VG_(printf)("scache fetch line %d\n", (Int)wix);
 
-   tl_assert(wix >= 0 && wix < N_WAY_NENT);
+   tl_assert(wix >= 0 && wix < cache_shmem.nent);
 
    tag =  cache_shmem.tags0[wix];
    cl  = &cache_shmem.lyns0[wix];
@@ -1691,17 +1786,17 @@ static void shmem__invalidate_scache_range (Addr ga, SizeT szB)
    tl_assert (0 == (szB & (N_LINE_ARANGE - 1)));
    
 
-   Word ga_ix = (ga >> N_LINE_BITS) & (N_WAY_NENT - 1);
+   Word ga_ix = (ga >> N_LINE_BITS) & (cache_shmem.nent - 1);
    Word nwix = szB / N_LINE_ARANGE;
 
-   if (nwix > N_WAY_NENT)
-      nwix = N_WAY_NENT; // no need to check several times the same entry.
+   if (nwix > cache_shmem.nent)
+      nwix = cache_shmem.nent; // no need to check several times the same entry.
 
    for (wix = 0; wix < nwix; wix++) {
       if (address_in_range(cache_shmem.tags0[ga_ix], ga, szB))
          cache_shmem.tags0[ga_ix] = 1/*INVALID*/;
       ga_ix++;
-      if (UNLIKELY(ga_ix == N_WAY_NENT))
+      if (UNLIKELY(ga_ix == cache_shmem.nent))
          ga_ix = 0;
    }
 }
@@ -1712,7 +1807,7 @@ static void shmem__flush_and_invalidate_scache ( void ) {
    Addr tag;
    if (0) VG_(printf)("%s","scache flush and invalidate\n");
    tl_assert(!is_valid_scache_tag(1));
-   for (wix = 0; wix < N_WAY_NENT; wix++) {
+   for (wix = 0; wix < cache_shmem.nent; wix++) {
       tag = cache_shmem.tags0[wix];
       if (tag == 1/*INVALID*/) {
          /* already invalid; nothing to do */
@@ -1758,7 +1853,7 @@ static inline CacheLine* get_cacheline ( Addr a )
    /* tag is 'a' with the in-line offset masked out, 
       eg a[31]..a[4] 0000 */
    Addr       tag = a & ~(N_LINE_ARANGE - 1);
-   UWord      wix = (a >> N_LINE_BITS) & (N_WAY_NENT - 1);
+   UWord      wix = (a >> N_LINE_BITS) & (cache_shmem.nent - 1);
    stats__cache_totrefs++;
    if (LIKELY(tag == cache_shmem.tags0[wix])) {
       return &cache_shmem.lyns0[wix];
@@ -1776,7 +1871,7 @@ static __attribute__((noinline))
    CacheLine* cl;
    Addr*      tag_old_p;
    Addr       tag = a & ~(N_LINE_ARANGE - 1);
-   UWord      wix = (a >> N_LINE_BITS) & (N_WAY_NENT - 1);
+   UWord      wix = (a >> N_LINE_BITS) & (cache_shmem.nent - 1);
 
    tl_assert(tag != cache_shmem.tags0[wix]);
 
@@ -1990,9 +2085,19 @@ static void zsm_init ( void )
    map_shmem = VG_(newFM)( HG_(zalloc), "libhb.zsm_init.1 (map_shmem)",
                            HG_(free), 
                            NULL/*unboxed UWord cmp*/);
+   /* Allocate the cache.  The lines are only touched when used,
+      so take them directly from the address space manager. */
+   cache_shmem.nent = 1UL << N_WAY_BITS;
+   cache_shmem.lyns0 = VG_(am_shadow_alloc)
+      ( cache_shmem.nent * sizeof(CacheLine) );
+   if (cache_shmem.lyns0 == NULL)
+      VG_(out_of_memory_NORETURN)( "helgrind:zsm_init",
+                                   cache_shmem.nent * sizeof(CacheLine) );
+   cache_shmem.tags0 = HG_(zalloc)( "libhb.zsm_init.2 (cache tags)",
+                                    cache_shmem.nent * sizeof(Addr) );
    /* Invalidate all cache entries. */
    tl_assert(!is_valid_scache_tag(1));
-   for (UWord wix = 0; wix < N_WAY_NENT; wix++) {
+   for (UWord wix = 0; wix < cache_shmem.nent; wix++) {
       cache_shmem.tags0[wix] = 1/*INVALID*/;
    }
 
@@ -2069,8 +2174,9 @@ static void scalarts_limitations_fail_NORETURN ( Bool due_to_nThrs )
    New entries are added at the end.  The order isn't important, but
    the ThrID values must be unique.
    verydead_thread_table_not_pruned lists the identity of the threads
-   that died since the previous round of pruning.
-   Once pruning is done, these ThrID are added in verydead_thread_table.
+   that died since the previous round of pruning started.  A round of
+   pruning removes the threads listed at its start; once the round is
+   done, these ThrID are moved to verydead_thread_table.
    We don't actually need to keep the set of threads that have ever died --
    only the threads that have died since the previous round of
    pruning.  But it's useful for sanity check purposes to keep the
@@ -2142,11 +2248,14 @@ static VTS* VTS__new ( const HChar* who, UInt sizeTS );
    number of ScalarTSs present. */
 static VTS* VTS__clone ( const HChar* who, VTS* vts );
 
-/* Make a clone of 'vts' with the thrids in 'thrids' removed.  The new
-   array is sized exactly to hold the number of required elements.
-   'thridsToDel' is an array of ThrIDs to be omitted in the clone, and
-   must be in strictly increasing order. */
-static VTS* VTS__subtract ( const HChar* who, VTS* vts, XArray* thridsToDel );
+/* Make a clone of 'vts' without the entries of threads being pruned
+   (those with Thr::pruned set).  The new array is sized exactly to
+   hold the number of required elements. */
+static VTS* VTS__subtract ( const HChar* who, VTS* vts );
+
+/* Remove the entries of threads being pruned from 'vts', in place.
+   Returns the number of entries removed. */
+static UInt VTS__remove_pruned ( VTS* vts );
 
 /* Delete this VTS in its entirety. */
 static void VTS__delete ( VTS* vts );
@@ -2227,6 +2336,153 @@ static Bool is_sane_VTS ( VTS* vts )
 }
 
 
+/* A ScalarTS is a 64 bit word, in which the thrid and the tym occupy
+   disjoint bit ranges.  So for two ScalarTSs with the same thrid,
+   comparing the words compares the tyms, and the greater word is the
+   ScalarTS with the greater tym.  VTSs are sorted by thrid, and in
+   programs with many threads, two VTSs usually mention the same
+   threads over long stretches.  Such a stretch is really a pair of
+   dense vectors, indexed the same way, and is joined or compared a
+   vector at a time, without the per-entry merge logic.  The general
+   merge only handles the entries where the two VTSs differ.
+
+   vts_thrid_mask has the thrid bits of a ScalarTS word set.  It is
+   computed at startup, as the layout of bitfields depends on the
+   target. */
+static ULong vts_thrid_mask = 0;
+
+/* On amd64 hosts with AVX2, the dense stretches are done 4 entries
+   at a time.  AVX2 only has a signed compare, and the top bit of the
+   word is the top bit of the tym, which can be set.  So the words are
+   compared with their top bit flipped, which gives the unsigned
+   order. */
+#if defined(VGA_amd64) \
+    && (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5))
+#  define VTS_DENSE_AVX2 1
+static Bool vts_dense_avx2 = False;
+
+typedef Long VTS_V4 __attribute__((vector_size(32)));
+
+__attribute__((target("avx2")))
+static UWord VTS__join_dense_avx2 ( ULong* out, const ULong* a,
+                                    const ULong* b, UWord n )
+{
+   const VTS_V4 mask = (VTS_V4){ 0, 0, 0, 0 } + (Long)vts_thrid_mask;
+   const VTS_V4 bias = (VTS_V4){ 0, 0, 0, 0 } + (Long)(1ULL << 63);
+   UWord i;
+   for (i = 0; i + 4 <= n; i += 4) {
+      VTS_V4 x, y, d, gt;
+      __builtin_memcpy(&x, &a[i], sizeof(x));
+      __builtin_memcpy(&y, &b[i], sizeof(y));
+      d = (x ^ y) & mask;
+      if ((d[0] | d[1] | d[2] | d[3]) != 0)
+         break;
+      gt = (x ^ bias) > (y ^ bias);
+      x  = (x & gt) | (y & ~gt);
+      __builtin_memcpy(&out[i], &x, sizeof(x));
+   }
+   return i;
+}
+
+__attribute__((target("avx2")))
+static UWord VTS__cmpLEQ_dense_avx2 ( const ULong* a, const ULong* b,
+                                      UWord n )
+{
+   const VTS_V4 mask = (VTS_V4){ 0, 0, 0, 0 } + (Long)vts_thrid_mask;
+   const VTS_V4 bias = (VTS_V4){ 0, 0, 0, 0 } + (Long)(1ULL << 63);
+   UWord i;
+   for (i = 0; i + 4 <= n; i += 4) {
+      VTS_V4 x, y, d;
+      __builtin_memcpy(&x, &a[i], sizeof(x));
+      __builtin_memcpy(&y, &b[i], sizeof(y));
+      d = ((x ^ y) & mask) | ((x ^ bias) > (y ^ bias));
+      if ((d[0] | d[1] | d[2] | d[3]) != 0)
+         break;
+   }
+   return i;
+}
+
+__attribute__((target("avx2")))
+static UWord VTS__cmp_dense_avx2 ( const ULong* a, const ULong* b, UWord n )
+{
+   UWord i;
+   for (i = 0; i + 4 <= n; i += 4) {
+      VTS_V4 x, y, d;
+      __builtin_memcpy(&x, &a[i], sizeof(x));
+      __builtin_memcpy(&y, &b[i], sizeof(y));
+      d = x ^ y;
+      if ((d[0] | d[1] | d[2] | d[3]) != 0)
+         break;
+   }
+   return i;
+}
+#endif
+
+/* Join the first 'n' entries of 'a' and 'b' into 'out', for as long
+   as they mention the same threads.  Returns the nr of entries done. */
+static inline UWord VTS__join_dense ( ScalarTS* out, const ScalarTS* a,
+                                      const ScalarTS* b, UWord n )
+{
+   ULong*       wout = (ULong*)out;
+   const ULong* wa   = (const ULong*)a;
+   const ULong* wb   = (const ULong*)b;
+   UWord        i    = 0;
+#  if defined(VTS_DENSE_AVX2)
+   if (vts_dense_avx2 && n >= 8)
+      i = VTS__join_dense_avx2(wout, wa, wb, n);
+#  endif
+   for (; i < n; i++) {
+      ULong x = wa[i];
+      ULong y = wb[i];
+      if ((x ^ y) & vts_thrid_mask)
+         break;
+      wout[i] = x > y ? x : y;
+   }
+   return i;
+}
+
+/* Returns the nr of leading entries of 'a' and 'b', out of 'n', which
+   mention the same threads and for which 'a' is LEQ 'b'. */
+static inline UWord VTS__cmpLEQ_dense ( const ScalarTS* a,
+                                        const ScalarTS* b, UWord n )
+{
+   const ULong* wa = (const ULong*)a;
+   const ULong* wb = (const ULong*)b;
+   UWord        i  = 0;
+#  if defined(VTS_DENSE_AVX2)
+   if (vts_dense_avx2 && n >= 8)
+      i = VTS__cmpLEQ_dense_avx2(wa, wb, n);
+#  endif
+   for (; i < n; i++) {
+      ULong x = wa[i];
+      ULong y = wb[i];
+      if (((x ^ y) & vts_thrid_mask) || x > y)
+         break;
+   }
+   return i;
+}
+
+
+/* Returns the nr of leading entries, out of 'n', which are identical
+   in 'a' and 'b'. */
+static inline UWord VTS__cmp_dense ( const ScalarTS* a, const ScalarTS* b,
+                                     UWord n )
+{
+   const ULong* wa = (const ULong*)a;
+   const ULong* wb = (const ULong*)b;
+   UWord        i  = 0;
+#  if defined(VTS_DENSE_AVX2)
+   if (vts_dense_avx2 && n >= 8)
+      i = VTS__cmp_dense_avx2(wa, wb, n);
+#  endif
+   for (; i < n; i++) {
+      if (wa[i] != wb[i])
+         break;
+   }
+   return i;
+}
+
+
 /* Create a new, empty VTS.
 */
 static VTS* VTS__new ( const HChar* who, UInt sizeTS )
@@ -2258,22 +2514,24 @@ static VTS* VTS__clone ( const HChar* who, VTS* vts )
 }
 
 
-/* Make a clone of a VTS with specified ThrIDs removed.  'thridsToDel'
-   must be in strictly increasing order.  We could obviously do this
-   much more efficiently (in linear time) if necessary.
+/* True if the entries of thrid are being pruned from all VTSs. */
+static inline Bool ThrID__is_pruned ( ThrID thrid )
+{
+   return Thr__from_ThrID(thrid)->pruned;
+}
+
+/* Make a clone of a VTS without the entries of threads being pruned.
 */
-static VTS* VTS__subtract ( const HChar* who, VTS* vts, XArray* thridsToDel )
+static VTS* VTS__subtract ( const HChar* who, VTS* vts )
 {
    UInt i, j;
    tl_assert(vts);
-   tl_assert(thridsToDel);
    tl_assert( *(ULong*)(&vts->ts[vts->sizeTS]) == 0x0ddC0ffeeBadF00dULL);
    UInt nTS = vts->usedTS;
    /* Figure out how many ScalarTSs will remain in the output. */
    UInt nReq = nTS;
    for (i = 0; i < nTS; i++) {
-      ThrID thrid = vts->ts[i].thrid;
-      if (VG_(lookupXA)(thridsToDel, &thrid, NULL, NULL))
+      if (ThrID__is_pruned(vts->ts[i].thrid))
          nReq--;
    }
    tl_assert(nReq <= nTS);
@@ -2281,8 +2539,7 @@ static VTS* VTS__subtract ( const HChar* who, VTS* vts, XArray* thridsToDel )
    VTS* res = VTS__new(who, nReq);
    j = 0;
    for (i = 0; i < nTS; i++) {
-      ThrID thrid = vts->ts[i].thrid;
-      if (VG_(lookupXA)(thridsToDel, &thrid, NULL, NULL))
+      if (ThrID__is_pruned(vts->ts[i].thrid))
          continue;
       res->ts[j++] = vts->ts[i];
    }
@@ -2294,6 +2551,21 @@ static VTS* VTS__subtract ( const HChar* who, VTS* vts, XArray* thridsToDel )
 }
 
 
+/* Remove the entries of threads being pruned from a VTS, in place.
+*/
+static UInt VTS__remove_pruned ( VTS* vts )
+{
+   UInt i, j, nTS = vts->usedTS;
+   for (i = j = 0; i < nTS; i++) {
+      if (ThrID__is_pruned(vts->ts[i].thrid))
+         continue;
+      vts->ts[j++] = vts->ts[i];
+   }
+   vts->usedTS = j;
+   return nTS - j;
+}
+
+
 /* Delete this VTS in its entirety.
 */
 static void VTS__delete ( VTS* vts )
@@ -2342,14 +2614,20 @@ static void VTS__tick ( /*OUT*/VTS* out, Thr* me, VTS* vts )
    tl_assert(is_sane_VTS(vts));
    n = vts->usedTS;
 
-   /* Copy all entries which precede 'me'. */
-   for (i = 0; i < n; i++) {
-      ScalarTS* here = &vts->ts[i];
-      if (UNLIKELY(here->thrid >= me_thrid))
-         break;
-      UInt hi = out->usedTS++;
-      out->ts[hi] = *here;
+   /* Copy all entries which precede 'me'.  Find them by binary
+      search, since the VTS is sorted by thrid. */
+   { UInt lo = 0, hi = n;
+     while (lo < hi) {
+        UInt mid = lo + (hi - lo) / 2;
+        if (vts->ts[mid].thrid < me_thrid)
+           lo = mid + 1;
+        else
+           hi = mid;
+     }
+     i = lo;
    }
+   VG_(memcpy)(&out->ts[0], &vts->ts[0], i * sizeof(ScalarTS));
+   out->usedTS = i;
 
    /* 'i' now indicates the next entry to copy, if any.
        There are 3 possibilities:
@@ -2385,11 +2663,9 @@ static void VTS__tick ( /*OUT*/VTS* out, Thr* me, VTS* vts )
          out->ts[hi].tym   = 1;
       }
       /* And copy any remaining entries. */
-      for (/*keepgoing*/; i < n; i++) {
-         ScalarTS* here2 = &vts->ts[i];
-         UInt hi = out->usedTS++;
-         out->ts[hi] = *here2;
-      }
+      VG_(memcpy)(&out->ts[out->usedTS], &vts->ts[i],
+                  (n - i) * sizeof(ScalarTS));
+      out->usedTS += n - i;
    }
 
    tl_assert(is_sane_VTS(out));
@@ -2427,6 +2703,20 @@ static void VTS__join ( /*OUT*/VTS* out, VTS* a, VTS* b )
 
    while (1) {
 
+      /* Do the stretch, if any, over which a and b mention the same
+         threads, as a pair of dense vectors. */
+      if (ia < useda && ib < usedb) {
+         UWord nDense = VTS__join_dense( &out->ts[out->usedTS],
+                                         &a->ts[ia], &b->ts[ib],
+                                         useda - ia < usedb - ib
+                                            ? useda - ia : usedb - ib );
+         out->usedTS += nDense;
+         ia += nDense;
+         ib += nDense;
+         ncommon += nDense;
+         stats__vts__join_dense += nDense;
+      }
+
       /* This logic is to enumerate triples (thrid, tyma, tymb) drawn
          from a and b in order, where thrid is the next ThrID
          occurring in either a or b, and tyma/b are the relevant
@@ -2525,6 +2815,17 @@ static UInt/*ThrID*/ VTS__cmpLEQ ( VTS* a, VTS* b )
          scalar timestamps, taking into account implicit zeroes. */
       ThrID thrid;
 
+      /* Skip the stretch, if any, over which a and b mention the same
+         threads and a is LEQ b, a dense vector at a time. */
+      if (ia < useda && ib < usedb) {
+         UWord nDense = VTS__cmpLEQ_dense( &a->ts[ia], &b->ts[ib],
+                                           useda - ia < usedb - ib
+                                              ? useda - ia : usedb - ib );
+         ia += nDense;
+         ib += nDense;
+         stats__vts__cmpLEQ_dense += nDense;
+      }
+
       tl_assert(ia >= 0 && ia <= useda);
       tl_assert(ib >= 0 && ib <= usedb);
 
@@ -2580,9 +2881,12 @@ static UInt/*ThrID*/ VTS__cmpLEQ ( VTS* a, VTS* b )
       /* having laboriously determined (tyma, tymb), do something
          useful with it. */
       if (tyma > tymb) {
-         /* not LEQ at this index.  Quit, since the answer is
-            determined already. */
+         /* not LEQ at this index, unless the entries of this thread
+            are being pruned, and so must be treated as absent. */
          tl_assert(thrid >= 1024);
+         if (UNLIKELY(ThrID__is_pruned(thrid)))
+            continue;
+         /* Quit, since the answer is determined already. */
          return thrid;
       }
    }
@@ -2618,21 +2922,15 @@ Word VTS__cmp_structural ( VTS* a, VTS* b )
       ScalarTS *tmpa = NULL, *tmpb = NULL;
       stats__vts__cmp_structural_slow++;
       /* Same length vectors.  Find the first difference, if any, as
-         fast as possible. */
-      for (i = 0; i < useda; i++) {
-         tmpa = &ctsa[i];
-         tmpb = &ctsb[i];
-         if (LIKELY(tmpa->tym == tmpb->tym
-                    && tmpa->thrid == tmpb->thrid))
-            continue;
-         else
-            break;
-      }
+         fast as possible, comparing whole ScalarTS words. */
+      i = VTS__cmp_dense(ctsa, ctsb, useda);
       if (UNLIKELY(i == useda)) {
          /* They're identical. */
          return 0;
       } else {
          tl_assert(i >= 0 && i < useda);
+         tmpa = &ctsa[i];
+         tmpb = &ctsb[i];
          if (tmpa->tym < tmpb->tym) return -1;
          if (tmpa->tym > tmpb->tym) return 1;
          if (tmpa->thrid < tmpb->thrid) return -1;
@@ -2787,23 +3085,26 @@ static void VtsID__invalidate_caches ( void ); /* fwds */
    If .vts == NULL, then this entry is not in use, so:
    - .rc == 0
    - this entry is on the freelist (unfortunately, does not imply
-     any constraints on value for u.freelink)
+     any constraints on value for freelink)
    If .vts != NULL, then this entry is in use:
-   - .vts is findable in vts_set
+   - .vts is findable in vts_set, unless .alias
    - .vts->id == this entry number
    - no specific value for .rc (even 0 is OK)
-   - this entry is not on freelist, so u.freelink == VtsID_INVALID
+   - this entry is not on freelist, so freelink == VtsID_INVALID
 */
 typedef
    struct {
-      VTS*  vts;      /* vts, in vts_set */
+      VTS*  vts;      /* vts, in vts_set unless .alias */
       UWord rc;       /* reference count - enough for entire aspace */
-      union {
-         VtsID freelink; /* chain for free entries, VtsID_INVALID at end */
-         VtsID remap;    /* used only during pruning, for used entries */
-      } u; 
-      /* u.freelink only used when vts == NULL,
-         u.remap only used when vts != NULL, during pruning. */
+      VtsID freelink; /* chain for free entries, VtsID_INVALID at end */
+      /* .garbage is set for the entries with a zero .rc when a GC
+         round starts, and cleared if the entry is used again before
+         the round gets to it. */
+      Bool  garbage;
+      /* Pruning can make a VTS structurally identical to one already
+         in vts_set.  The entry then keeps its pruned VTS, outside of
+         vts_set, until it is freed. */
+      Bool  alias;
    }
    VtsTE;
 
@@ -2820,6 +3121,20 @@ static VtsID vts_tab_freelist = VtsID_INVALID;
    set appropriately so as to check for the next GC point. */
 static Word vts_next_GC_at = 1000;
 
+/* A GC round visits the vts_tab entries that exist when it starts, a
+   step of HG_(clo_vts_gc_step) entries at a time.  vts_gc_next is the
+   next entry to visit, and vts_gc_end is the size of vts_tab when the
+   round started.  A round is active iff vts_gc_next < vts_gc_end. */
+static UWord vts_gc_next = 0;
+static UWord vts_gc_end  = 0;
+static UWord vts_gc_nFreed;
+
+/* Nr of threads at the head of verydead_thread_table_not_pruned being
+   pruned by the active GC round, 0 if the round does no pruning. */
+static UWord vts_prune_nThr = 0;
+static UWord vts_prune_nPruned, vts_prune_nAliased;
+static UWord vts_prune_nSTSsBefore, vts_prune_nSTSsAfter;
+
 static void vts_tab_init ( void )
 {
    vts_tab = VG_(newXA)( HG_(zalloc), "libhb.vts_tab_init.1",
@@ -2833,8 +3148,8 @@ static void add_to_free_list ( VtsID ii )
    VtsTE* ie = VG_(indexXA)( vts_tab, ii );
    tl_assert(ie->vts == NULL);
    tl_assert(ie->rc == 0);
-   tl_assert(ie->u.freelink == VtsID_INVALID);
-   ie->u.freelink = vts_tab_freelist;
+   tl_assert(ie->freelink == VtsID_INVALID);
+   ie->freelink = vts_tab_freelist;
    vts_tab_freelist = ii;
 }
 
@@ -2850,7 +3165,8 @@ static VtsID get_from_free_list ( void )
    ie = VG_(indexXA)( vts_tab, ii );
    tl_assert(ie->vts == NULL);
    tl_assert(ie->rc == 0);
-   vts_tab_freelist = ie->u.freelink;
+   vts_tab_freelist = ie->freelink;
+   ie->freelink = VtsID_INVALID;
    return ii;
 }
 
@@ -2865,7 +3181,9 @@ static VtsID get_new_VtsID ( void )
       return ii;
    te.vts = NULL;
    te.rc = 0;
-   te.u.freelink = VtsID_INVALID;
+   te.freelink = VtsID_INVALID;
+   te.garbage = False;
+   te.alias = False;
    ii = (VtsID)VG_(addToXA)( vts_tab, &te );
    return ii;
 }
@@ -2904,21 +3222,32 @@ static VtsID vts_tab__find__or__clone_and_add ( VTS* cand )
 {
    VTS* in_tab = NULL;
    tl_assert(cand->id == VtsID_INVALID);
+   /* While a round of pruning is going on, new VTSs are made without
+      the entries of the threads being pruned, as the round may
+      already have gone past their slot in vts_tab. */
+   if (UNLIKELY(vts_prune_nThr > 0))
+      VTS__remove_pruned(cand);
    Bool already_have = vts_set__find__or__clone_and_add( &in_tab, cand );
    tl_assert(in_tab);
    if (already_have) {
-      /* We already have a copy of 'cand'.  Use that. */
+      /* We already have a copy of 'cand'.  Use that.  It may have been
+         unused when the current GC round started, in which case it
+         is not garbage any more. */
       VtsTE* ie;
       tl_assert(in_tab->id != VtsID_INVALID);
       ie = VG_(indexXA)( vts_tab, in_tab->id );
       tl_assert(ie->vts == in_tab);
+      tl_assert(!ie->alias);
+      ie->garbage = False;
       return in_tab->id;
    } else {
       VtsID  ii = get_new_VtsID();
       VtsTE* ie = VG_(indexXA)( vts_tab, ii );
       ie->vts = in_tab;
       ie->rc = 0;
-      ie->u.freelink = VtsID_INVALID;
+      ie->freelink = VtsID_INVALID;
+      ie->garbage = False;
+      ie->alias = False;
       in_tab->id = ii;
       return ii;
    }
@@ -2952,58 +3281,207 @@ static void show_vts_stats ( const HChar* caller )
 }
 
 
-/* --- Helpers for VtsID pruning --- */
+/* --- VTS GC and pruning --- */
 
-static
-void remap_VtsID ( /*MOD*/XArray* /* of VtsTE */ old_tab,
-                   /*MOD*/XArray* /* of VtsTE */ new_tab,
-                   VtsID* ii )
-{
-   VtsTE *old_te, *new_te;
-   VtsID old_id, new_id;
-   /* We're relying here on VG_(indexXA)'s range checking to assert on
-      any stupid values, in particular *ii == VtsID_INVALID. */
-   old_id = *ii;
-   old_te = VG_(indexXA)( old_tab, old_id );
-   old_te->rc--;
-   new_id = old_te->u.remap;
-   new_te = VG_(indexXA)( new_tab, new_id );
-   new_te->rc++;
-   *ii = new_id;
+/* A GC round frees the vts_tab entries which are not in use, and, if
+   it is a pruning round, removes the entries of threads which have
+   become very dead (see VTS__declare_thread_very_dead) from the VTSs
+   in use.  Doing that for all of vts_tab at once can pause a program
+   which creates and destroys many threads for a long time, so
+   vts_tab__start_GC only does what has to be done atomically, and the
+   entries are visited later by vts_tab__GC_step, a step at a time.
+
+   Freeing: the reference counts are only up to date when the shadow
+   cache has been flushed, so the entries with a zero .rc are marked as
+   garbage when the round starts.  Such an entry is not referenced by
+   anything, and the only way it can be used again before the round
+   gets to it is by vts_tab__find__or__clone_and_add finding its VTS,
+   which clears the mark.
+
+   Pruning: VTSs are pruned in place, keeping their VtsIDs, so that the
+   VtsIDs in shadow memory, Thrs and SOs need not be remapped.  While
+   the round is going on, some VTSs still have entries for the threads
+   being pruned.  These threads have Thr::pruned set, and VTS__cmpLEQ
+   ignores their entries, so that comparisons give the same result as
+   if all VTSs were already pruned.  Joins and ticks can copy such
+   entries into new VTSs, so vts_tab__find__or__clone_and_add removes
+   them from new VTSs until the round is over. */
+
+/* Frees vts_tab entry i, which is garbage. */
+static void vts_tab__free_entry ( UWord i )
+{
+   VtsTE* te = VG_(indexXA)( vts_tab, i );
+   tl_assert(te->vts);
+   tl_assert(te->rc == 0); /* else something used a garbage entry */
+   tl_assert(te->vts->id == i);
+   /* first, remove it from vts_set. */
+   if (!te->alias) {
+      UWord oldK = 0, oldV = 12345;
+      Bool  present = VG_(delFromFM)( vts_set,
+                                      &oldK, &oldV, (UWord)te->vts );
+      tl_assert(present); /* else it isn't in vts_set ?! */
+      tl_assert(oldV == 0); /* no info stored in vts_set val fields */
+      tl_assert(oldK == (UWord)te->vts); /* else what did delFromFM find?! */
+   }
+   /* now free the VTS itself */
+   VTS__delete(te->vts);
+   te->vts = NULL;
+   te->garbage = False;
+   te->alias = False;
+   /* and finally put this entry on the free list */
+   tl_assert(te->freelink == VtsID_INVALID); /* can't already be on it */
+   add_to_free_list( i );
 }
 
-static
-void remap_VtsIDs_in_SVal ( /*MOD*/XArray* /* of VtsTE */ old_tab,
-                            /*MOD*/XArray* /* of VtsTE */ new_tab,
-                            SVal* s )
+/* Removes the entries of the threads being pruned from the VTS of
+   vts_tab entry i, which is in use. */
+static void vts_tab__prune_entry ( UWord i )
+{
+   VtsTE* te      = VG_(indexXA)( vts_tab, i );
+   VTS*   old_vts = te->vts;
+   UWord  j;
+
+   tl_assert(old_vts->id == i);
+   vts_prune_nSTSsBefore += old_vts->usedTS;
+   for (j = 0; j < old_vts->usedTS; j++)
+      if (ThrID__is_pruned(old_vts->ts[j].thrid))
+         break;
+   if (j == old_vts->usedTS) {
+      /* nothing to prune */
+      vts_prune_nSTSsAfter += old_vts->usedTS;
+      return;
+   }
+
+   VTS* new_vts = VTS__subtract("libhb.vts_tab__prune_entry.new_vts",
+                                old_vts);
+   tl_assert(new_vts->sizeTS == new_vts->usedTS);
+   tl_assert(*(ULong*)(&new_vts->ts[new_vts->usedTS])
+             == 0x0ddC0ffeeBadF00dULL);
+   vts_prune_nPruned++;
+   vts_prune_nSTSsAfter += new_vts->usedTS;
+
+   /* Get rid of the old VTS and its vts_set entry. */
+   if (!te->alias) {
+      UWord oldK = 0, oldV = 12345;
+      Bool  present = VG_(delFromFM)( vts_set,
+                                      &oldK, &oldV, (UWord)old_vts );
+      tl_assert(present); /* else it isn't in vts_set ?! */
+      tl_assert(oldV == 0); /* no info stored in vts_set val fields */
+      tl_assert(oldK == (UWord)old_vts); /* else what did delFromFM find?! */
+   }
+   VTS__delete(old_vts);
+
+   /* Put the pruned VTS in vts_set, unless a structurally identical
+      version is already there, in which case this entry becomes an
+      alias for it. */
+   new_vts->id = i;
+   te->vts = new_vts;
+   te->alias = VG_(lookupFM)(vts_set, NULL, NULL, (UWord)new_vts);
+   if (te->alias)
+      vts_prune_nAliased++;
+   else
+      VG_(addToFM)(vts_set, (UWord)new_vts, 0);
+}
+
+static void vts_tab__finish_GC ( void )
+{
+   UWord i, nTab, nLive;
+
+   /* Now figure out when the next GC should be.  We'll allow the
+      number of VTSs to double before GCing again.  Except of course
+      that since we can't (or, at least, don't) shrink vts_tab, we
+      can't set the threshold value smaller than it. */
+   nTab = vts_gc_end;
+   tl_assert(vts_gc_nFreed <= nTab);
+   nLive = nTab - vts_gc_nFreed;
+   vts_next_GC_at = 2 * nLive;
+   if (vts_next_GC_at < VG_(sizeXA)( vts_tab ))
+      vts_next_GC_at = VG_(sizeXA)( vts_tab );
+
+   stats__vts_tab_GC++;
+   if (VG_(clo_stats)) {
+      tl_assert(nTab > 0);
+      VG_(message)(Vg_DebugMsg,
+                   "libhb: VTS GC: #%lu  old size %lu  live %lu  (%2llu%%)\n",
+                   stats__vts_tab_GC, 
+                   nTab, nLive, (100ULL * (ULong)nLive) / (ULong)nTab);
+   }
+
+   if (vts_prune_nThr == 0)
+      return;
+
+   /* Move the pruned very dead threads from
+      verydead_thread_table_not_pruned to verydead_thread_table.  Sort
+      and check verydead_thread_table to verify a thread was reported
+      very dead only once. */
+   for (i = 0; i < vts_prune_nThr; i++) {
+      ThrID thrid = 
+         *(ThrID*)VG_(indexXA)( verydead_thread_table_not_pruned, i );
+      VG_(addToXA)( verydead_thread_table, &thrid );
+   }
+   verydead_thread_table_sort_and_check (verydead_thread_table);
+   VG_(dropHeadXA) (verydead_thread_table_not_pruned, vts_prune_nThr);
+   vts_prune_nThr = 0;
+
+   stats__vts_pruning++;
+   if (VG_(clo_stats)) {
+      VG_(message)(
+         Vg_DebugMsg,
+         "libhb: VTS PR: #%lu  live %lu (avg sz %lu -> %lu)  "
+            "pruned %lu  aliased %lu\n",
+         stats__vts_pruning, nLive,
+         vts_prune_nSTSsBefore / (nLive ? nLive : 1),
+         vts_prune_nSTSsAfter / (nLive ? nLive : 1),
+         vts_prune_nPruned, vts_prune_nAliased
+      );
+   }
+}
+
+/* Visits the next 'n' vts_tab entries of the active GC round,
+   finishing the round if it gets to the end. */
+static void vts_tab__GC_step ( UWord n )
 {
-   SVal old_sv, new_sv;
-   old_sv = *s;
-   if (SVal__isC(old_sv)) {
-      VtsID rMin, wMin;
-      rMin = SVal__unC_Rmin(old_sv);
-      wMin = SVal__unC_Wmin(old_sv);
-      remap_VtsID( old_tab, new_tab, &rMin );
-      remap_VtsID( old_tab, new_tab, &wMin );
-      new_sv = SVal__mkC( rMin, wMin );
-      *s = new_sv;
-  }
+   UWord i, end;
+
+   tl_assert(vts_gc_next < vts_gc_end);
+   end = n > vts_gc_end - vts_gc_next ? vts_gc_end : vts_gc_next + n;
+   for (i = vts_gc_next; i < end; i++) {
+      VtsTE* te = VG_(indexXA)( vts_tab, i );
+      if (te->vts == NULL)
+         continue; /* freed and not reused since the round started */
+      if (te->garbage) {
+         vts_tab__free_entry(i);
+         vts_gc_nFreed++;
+      } else if (vts_prune_nThr > 0) {
+         vts_tab__prune_entry(i);
+      }
+   }
+   vts_gc_next = end;
+   if (vts_gc_next == vts_gc_end)
+      vts_tab__finish_GC();
 }
 
+static inline void vts_tab__maybe_GC_step ( void )
+{
+   if (UNLIKELY(vts_gc_next < vts_gc_end))
+      vts_tab__GC_step(HG_(clo_vts_gc_step));
+}
 
 /* NOT TO BE CALLED FROM WITHIN libzsm. */
 __attribute__((noinline))
-static void vts_tab__do_GC ( Bool show_stats )
+static void vts_tab__start_GC ( Bool show_stats )
 {
-   UWord i, nTab, nLive, nFreed;
+   UWord i, nTab;
 
-   /* ---------- BEGIN VTS GC ---------- */
    /* check this is actually necessary. */
    tl_assert(vts_tab_freelist == VtsID_INVALID);
+   tl_assert(vts_gc_next == vts_gc_end);
+   tl_assert(vts_prune_nThr == 0);
 
-   /* empty the caches for partial order checks and binary joins.  We
-      could do better and prune out the entries to be deleted, but it
-      ain't worth the hassle. */
+   /* empty the caches for partial order checks and binary joins.  They
+      do not hold references, and must not hold on to entries freed
+      by the round.  Also, the cached comparisons would be out of date
+      once the VTSs are pruned. */
    VtsID__invalidate_caches();
 
    /* First, make the reference counts up to date. */
@@ -3016,63 +3494,17 @@ static void vts_tab__do_GC ( Bool show_stats )
       show_vts_stats("before GC");
    }
 
-   /* Now we can inspect the entire vts_tab.  Any entries with zero
-      .rc fields are now no longer in use and can be put back on the
-      free list, removed from vts_set, and deleted. */
-   nFreed = 0;
+   /* Any entries with zero .rc fields are now no longer in use, and
+      will be freed when the round gets to them. */
    for (i = 0; i < nTab; i++) {
-      Bool present;
-      UWord oldK = 0, oldV = 12345;
       VtsTE* te = VG_(indexXA)( vts_tab, i );
       if (te->vts == NULL) {
          tl_assert(te->rc == 0);
          continue; /* already on the free list (presumably) */
       }
-      if (te->rc > 0)
-         continue; /* in use */
-      /* Ok, we got one we can free. */
-      tl_assert(te->vts->id == i);
-      /* first, remove it from vts_set. */
-      present = VG_(delFromFM)( vts_set,
-                                &oldK, &oldV, (UWord)te->vts );
-      tl_assert(present); /* else it isn't in vts_set ?! */
-      tl_assert(oldV == 0); /* no info stored in vts_set val fields */
-      tl_assert(oldK == (UWord)te->vts); /* else what did delFromFM find?! */
-      /* now free the VTS itself */
-      VTS__delete(te->vts);
-      te->vts = NULL;
-      /* and finally put this entry on the free list */
-      tl_assert(te->u.freelink == VtsID_INVALID); /* can't already be on it */
-      add_to_free_list( i );
-      nFreed++;
-   }
-
-   /* Now figure out when the next GC should be.  We'll allow the
-      number of VTSs to double before GCing again.  Except of course
-      that since we can't (or, at least, don't) shrink vts_tab, we
-      can't set the threshold value smaller than it. */
-   tl_assert(nFreed <= nTab);
-   nLive = nTab - nFreed;
-   tl_assert(nLive >= 0 && nLive <= nTab);
-   vts_next_GC_at = 2 * nLive;
-   if (vts_next_GC_at < nTab)
-      vts_next_GC_at = nTab;
-
-   if (show_stats) {
-      show_vts_stats("after GC");
-      VG_(printf)("<<GC ends, next gc at %ld>>\n", vts_next_GC_at);
+      te->garbage = te->rc == 0;
    }
 
-   stats__vts_tab_GC++;
-   if (VG_(clo_stats)) {
-      tl_assert(nTab > 0);
-      VG_(message)(Vg_DebugMsg,
-                   "libhb: VTS GC: #%lu  old size %lu  live %lu  (%2llu%%)\n",
-                   stats__vts_tab_GC, 
-                   nTab, nLive, (100ULL * (ULong)nLive) / (ULong)nTab);
-   }
-   /* ---------- END VTS GC ---------- */
-
    /* Decide whether to do VTS pruning.  We have one of three
       settings. */
    static UInt pruning_auto_ctr = 0; /* do not make non-static */
@@ -3091,300 +3523,36 @@ static void vts_tab__do_GC ( Bool show_stats )
          tl_assert(0);
    }
 
-   /* The rest of this routine only handles pruning, so we can
-      quit at this point if it is not to be done. */
-   if (!do_pruning)
-      return;
    /* No need to do pruning if no thread died since the last pruning as
-      no VtsTE can be pruned. */
-   if (VG_(sizeXA)( verydead_thread_table_not_pruned) == 0)
-      return;
-
-   /* ---------- BEGIN VTS PRUNING ---------- */
-   /* Sort and check the very dead threads that died since the last pruning.
-      Sorting is used for the check and so that we can quickly look
-      up the dead-thread entries as we work through the VTSs. */
-   verydead_thread_table_sort_and_check (verydead_thread_table_not_pruned);
-
-   /* We will run through the old table, and create a new table and
-      set, at the same time setting the u.remap entries in the old
-      table to point to the new entries.  Then, visit every VtsID in
-      the system, and replace all of them with new ones, using the
-      u.remap entries in the old table.  Finally, we can delete the old
-      table and set. */
-
-   XArray* /* of VtsTE */ new_tab
-      = VG_(newXA)( HG_(zalloc), "libhb.vts_tab__do_GC.new_tab",
-                    HG_(free), sizeof(VtsTE) );
-
-   /* WordFM VTS* void */
-   WordFM* new_set
-      = VG_(newFM)( HG_(zalloc), "libhb.vts_tab__do_GC.new_set",
-                    HG_(free),
-                    (Word(*)(UWord,UWord))VTS__cmp_structural );
-
-   /* Visit each old VTS.  For each one:
-
-      * make a pruned version
-
-      * search new_set for the pruned version, yielding either
-        Nothing (not present) or the new VtsID for it.
-
-      * if not present, allocate a new VtsID for it, insert (pruned
-        VTS, new VtsID) in the tree, and set
-        remap_table[old VtsID] = new VtsID.
-
-      * if present, set remap_table[old VtsID] = new VtsID, where
-        new VtsID was determined by the tree lookup.  Then free up
-        the clone.
-   */
-
-   UWord nBeforePruning = 0, nAfterPruning = 0;
-   UWord nSTSsBefore = 0, nSTSsAfter = 0;
-   VtsID new_VtsID_ctr = 0;
-
-   for (i = 0; i < nTab; i++) {
-
-      /* For each old VTS .. */
-      VtsTE* old_te  = VG_(indexXA)( vts_tab, i );
-      VTS*   old_vts = old_te->vts;
-
-      /* Skip it if not in use */
-      if (old_te->rc == 0) {
-         tl_assert(old_vts == NULL);
-         continue;
-      }
-      tl_assert(old_te->u.remap == VtsID_INVALID);
-      tl_assert(old_vts != NULL);
-      tl_assert(old_vts->id == i);
-      tl_assert(old_vts->ts != NULL);
-
-      /* It is in use. Make a pruned version. */
-      nBeforePruning++;
-      nSTSsBefore += old_vts->usedTS;
-      VTS* new_vts = VTS__subtract("libhb.vts_tab__do_GC.new_vts",
-                                   old_vts, verydead_thread_table_not_pruned);
-      tl_assert(new_vts->sizeTS == new_vts->usedTS);
-      tl_assert(*(ULong*)(&new_vts->ts[new_vts->usedTS])
-                == 0x0ddC0ffeeBadF00dULL);
-
-      /* Get rid of the old VTS and the tree entry.  It's a bit more
-         complex to incrementally delete the VTSs now than to nuke
-         them all after we're done, but the upside is that we don't
-         wind up temporarily storing potentially two complete copies
-         of each VTS and hence spiking memory use. */
-      UWord oldK = 0, oldV = 12345;
-      Bool  present = VG_(delFromFM)( vts_set,
-                                      &oldK, &oldV, (UWord)old_vts );
-      tl_assert(present); /* else it isn't in vts_set ?! */
-      tl_assert(oldV == 0); /* no info stored in vts_set val fields */
-      tl_assert(oldK == (UWord)old_vts); /* else what did delFromFM find?! */
-      /* now free the VTS itself */
-      VTS__delete(old_vts);
-      old_te->vts = NULL;
-      old_vts = NULL;
-
-      /* NO MENTIONS of old_vts allowed beyond this point. */
-
-      /* Ok, we have the pruned copy in new_vts.  See if a
-         structurally identical version is already present in new_set.
-         If so, delete the one we just made and move on; if not, add
-         it. */
-      VTS*  identical_version = NULL;
-      UWord valW = 12345;
-      if (VG_(lookupFM)(new_set, (UWord*)&identical_version, &valW,
-                        (UWord)new_vts)) {
-         // already have it
-         tl_assert(valW == 0);
-         tl_assert(identical_version != NULL);
-         tl_assert(identical_version != new_vts);
-         VTS__delete(new_vts);
-         new_vts = identical_version;
-         tl_assert(new_vts->id != VtsID_INVALID);
-      } else {
-         tl_assert(valW == 12345);
-         tl_assert(identical_version == NULL);
-         new_vts->id = new_VtsID_ctr++;
-         Bool b = VG_(addToFM)(new_set, (UWord)new_vts, 0);
-         tl_assert(!b);
-         VtsTE new_te;
-         new_te.vts      = new_vts;
-         new_te.rc       = 0;
-         new_te.u.freelink = VtsID_INVALID;
-         Word j = VG_(addToXA)( new_tab, &new_te );
-         tl_assert(j <= i);
-         tl_assert(j == new_VtsID_ctr - 1);
-         // stats
-         nAfterPruning++;
-         nSTSsAfter += new_vts->usedTS;
-      }
-      old_te->u.remap = new_vts->id;
-
-   } /* for (i = 0; i < nTab; i++) */
-
-   /* Move very dead thread from verydead_thread_table_not_pruned to
-      verydead_thread_table. Sort and check verydead_thread_table
-      to verify a thread was reported very dead only once. */
-   {
-      UWord nBT = VG_(sizeXA)( verydead_thread_table_not_pruned);
-
-      for (i = 0; i < nBT; i++) {
+      no VtsTE can be pruned.  Otherwise, sort and check the very dead
+      threads that died since the last pruning, and declare them as
+      being pruned. */
+   if (do_pruning && VG_(sizeXA)( verydead_thread_table_not_pruned) > 0) {
+      verydead_thread_table_sort_and_check (verydead_thread_table_not_pruned);
+      vts_prune_nThr = VG_(sizeXA)( verydead_thread_table_not_pruned);
+      for (i = 0; i < vts_prune_nThr; i++) {
          ThrID thrid = 
             *(ThrID*)VG_(indexXA)( verydead_thread_table_not_pruned, i );
-         VG_(addToXA)( verydead_thread_table, &thrid );
-      }
-      verydead_thread_table_sort_and_check (verydead_thread_table);
-      VG_(dropHeadXA) (verydead_thread_table_not_pruned, nBT);
-   }
-
-   /* At this point, we have:
-      * the old VTS table, with its u.remap entries set,
-        and with all .vts == NULL.
-      * the old VTS tree should be empty, since it and the old VTSs
-        it contained have been incrementally deleted was we worked
-        through the old table.
-      * the new VTS table, with all .rc == 0, all u.freelink and u.remap
-        == VtsID_INVALID. 
-      * the new VTS tree.
-   */
-   tl_assert( VG_(sizeFM)(vts_set) == 0 );
-
-   /* Now actually apply the mapping. */
-   /* Visit all the VtsIDs in the entire system.  Where do we expect
-      to find them?
-      (a) in shadow memory -- the LineZs and LineFs
-      (b) in our collection of struct _Thrs.
-      (c) in our collection of struct _SOs.
-      Nowhere else, AFAICS.  Not in the zsm cache, because that just
-      got invalidated.
-
-      Using the u.remap fields in vts_tab, map each old VtsID to a new
-      VtsID.  For each old VtsID, dec its rc; and for each new one,
-      inc it.  This sets up the new refcounts, and it also gives a
-      cheap sanity check of the old ones: all old refcounts should be
-      zero after this operation.
-   */
-
-   /* Do the mappings for (a) above: iterate over the Primary shadow
-      mem map (WordFM Addr SecMap*). */
-   UWord secmapW = 0;
-   VG_(initIterFM)( map_shmem );
-   while (VG_(nextIterFM)( map_shmem, NULL, &secmapW )) {
-      UWord   j;
-      SecMap* sm = (SecMap*)secmapW;
-      tl_assert(sm->magic == SecMap_MAGIC);
-      /* Deal with the LineZs */
-      for (i = 0; i < N_SECMAP_ZLINES; i++) {
-         LineZ* lineZ = &sm->linesZ[i];
-         if (lineZ->dict[0] != SVal_INVALID) {
-            for (j = 0; j < 4; j++)
-               remap_VtsIDs_in_SVal(vts_tab, new_tab, &lineZ->dict[j]);
-         } else {
-            LineF* lineF = SVal2Ptr (lineZ->dict[1]);
-            for (j = 0; j < N_LINE_ARANGE; j++)
-               remap_VtsIDs_in_SVal(vts_tab, new_tab, &lineF->w64s[j]);
-         }
-      }
-   }
-   VG_(doneIterFM)( map_shmem );
-
-   /* Do the mappings for (b) above: visit our collection of struct
-      _Thrs. */
-   Thread* hgthread = get_admin_threads();
-   tl_assert(hgthread);
-   while (hgthread) {
-      Thr* hbthr = hgthread->hbthr;
-      tl_assert(hbthr);
-      /* Threads that are listed in the prunable set have their viR
-         and viW set to VtsID_INVALID, so we can't mess with them. */
-      if (hbthr->llexit_done && hbthr->joinedwith_done) {
-         tl_assert(hbthr->viR == VtsID_INVALID);
-         tl_assert(hbthr->viW == VtsID_INVALID);
-         hgthread = hgthread->admin;
-         continue;
+         Thr* thr = Thr__from_ThrID(thrid);
+         tl_assert(!thr->pruned);
+         tl_assert(thr->viR == VtsID_INVALID);
+         tl_assert(thr->viW == VtsID_INVALID);
+         thr->pruned = True;
       }
-      remap_VtsID( vts_tab, new_tab, &hbthr->viR );
-      remap_VtsID( vts_tab, new_tab, &hbthr->viW );
-      hgthread = hgthread->admin;
-   }
-
-   /* Do the mappings for (c) above: visit the struct _SOs. */
-   SO* so = admin_SO;
-   while (so) {
-      if (so->viR != VtsID_INVALID)
-         remap_VtsID( vts_tab, new_tab, &so->viR );
-      if (so->viW != VtsID_INVALID)
-         remap_VtsID( vts_tab, new_tab, &so->viW );
-      so = so->admin_next;
-   }
-
-   /* So, we're nearly done (with this incredibly complex operation).
-      Check the refcounts for the old VtsIDs all fell to zero, as
-      expected.  Any failure is serious. */
-   for (i = 0; i < nTab; i++) {
-      VtsTE* te = VG_(indexXA)( vts_tab, i );
-      tl_assert(te->vts == NULL);
-      /* This is the assert proper.  Note we're also asserting
-         zeroness for old entries which are unmapped.  That's OK. */
-      tl_assert(te->rc == 0);
+      vts_prune_nPruned = vts_prune_nAliased = 0;
+      vts_prune_nSTSsBefore = vts_prune_nSTSsAfter = 0;
    }
 
-   /* Install the new table and set. */
-   VG_(deleteFM)(vts_set, NULL/*kFin*/, NULL/*vFin*/);
-   vts_set = new_set;
-   VG_(deleteXA)( vts_tab );
-   vts_tab = new_tab;
-
-   /* The freelist of vts_tab entries is empty now, because we've
-      compacted all of the live entries at the low end of the
-      table. */
-   vts_tab_freelist = VtsID_INVALID;
-
-   /* Sanity check vts_set and vts_tab. */
-
-   /* Because all the live entries got slid down to the bottom of vts_tab: */
-   tl_assert( VG_(sizeXA)( vts_tab ) == VG_(sizeFM)( vts_set ));
-
-   /* Assert that the vts_tab and vts_set entries point at each other
-      in the required way */
-   UWord wordK = 0, wordV = 0;
-   VG_(initIterFM)( vts_set );
-   while (VG_(nextIterFM)( vts_set, &wordK, &wordV )) {
-      tl_assert(wordK != 0);
-      tl_assert(wordV == 0);
-      VTS* vts = (VTS*)wordK;
-      tl_assert(vts->id != VtsID_INVALID);
-      VtsTE* te = VG_(indexXA)( vts_tab, vts->id );
-      tl_assert(te->vts == vts);
-   }
-   VG_(doneIterFM)( vts_set );
-
-   /* Also iterate over the table, and check each entry is
-      plausible. */
-   nTab = VG_(sizeXA)( vts_tab );
-   for (i = 0; i < nTab; i++) {
-      VtsTE* te = VG_(indexXA)( vts_tab, i );
-      tl_assert(te->vts);
-      tl_assert(te->vts->id == i);
-      tl_assert(te->rc > 0); /* 'cos we just GC'd */
-      tl_assert(te->u.freelink == VtsID_INVALID); /* in use */
-      /* value of te->u.remap  not relevant */
-   }
+   vts_gc_next = 0;
+   vts_gc_end = nTab;
+   vts_gc_nFreed = 0;
+   if (HG_(clo_vts_gc_step) == 0)
+      vts_tab__GC_step(nTab);
 
-   /* And we're done.  Bwahahaha. Ha. Ha. Ha. */
-   stats__vts_pruning++;
-   if (VG_(clo_stats)) {
-      tl_assert(nTab > 0);
-      VG_(message)(
-         Vg_DebugMsg,
-         "libhb: VTS PR: #%lu  before %lu (avg sz %lu)  "
-            "after %lu (avg sz %lu)\n",
-         stats__vts_pruning,
-         nBeforePruning, nSTSsBefore / (nBeforePruning ? nBeforePruning : 1),
-         nAfterPruning, nSTSsAfter / (nAfterPruning ? nAfterPruning : 1)
-      );
+   if (show_stats) {
+      show_vts_stats("after GC start");
+      VG_(printf)("<<GC started, next gc at %ld>>\n", vts_next_GC_at);
    }
-   /* ---------- END VTS PRUNING ---------- */
 }
 
 
@@ -3571,28 +3739,129 @@ static Thr* VtsID__findFirst_notLEQ ( VtsID vi1, VtsID vi2 )
 //                                                     //
 /////////////////////////////////////////////////////////
 
+static UWord stats__filter_clears = 0;
+static UWord stats__filter_clears_full = 0;
+static UWord stats__filter_evicts = 0;
+static UWord stats__filter_grows = 0;
+static UWord stats__filter_shrinks = 0;
+
+/* Allocates the lines of fi : 2^nlines_log2 lines holding nothing. */
+static void Filter__alloc_lines ( Filter* fi, UInt nlines_log2 )
+{
+   UWord nlines = 1UL << nlines_log2;
+   UWord i;
+   fi->tags = HG_(zalloc)( "libhb.Filter__alloc_lines.1",
+                           nlines * (sizeof(Addr) + sizeof(FiLine)
+                                     + sizeof(UInt)) );
+   fi->lines = (FiLine*)&fi->tags[nlines];
+   fi->dirty = (UInt*)&fi->lines[nlines];
+   fi->lineno_mask = nlines - 1;
+   for (i = 0; i < nlines; i++)
+      fi->tags[i] = 1; /* impossible value -- cannot match */
+   fi->nr_dirty = 0;
+   fi->nr_evicts = 0;
+   fi->nr_small = 0;
+}
+
+static Filter* Filter__new ( void )
+{
+   Filter* fi = HG_(zalloc)( "libhb.Filter__new.1", sizeof(Filter) );
+   Filter__alloc_lines( fi, FI_NUM_LINES_LOG2 );
+   return fi;
+}
+
+static void Filter__delete ( Filter* fi )
+{
+   HG_(free)( fi->tags );
+   HG_(free)( fi );
+}
+
+/* A filter is halved after FI_SHRINK_CLEARS successive clears, each
+   having found less than 1/16th of its lines used. */
+#define FI_SHRINK_CLEARS 1024
+
+/* Adapts the size of fi to its use since the previous clear : if
+   more lines were evicted than fi has, the working set of the thread
+   between two synchronisation events does not fit in, so double it.
+   If fi is persistently mostly unused, halve it, to reduce its cache
+   footprint.  Returns True if fi was resized, in which case it holds
+   nothing anymore. */
+static Bool Filter__maybe_resize ( Filter* fi )
+{
+   UWord nlines = fi->lineno_mask + 1;
+   Int   nlines_log2 = VG_(log2)( nlines );
+
+   if (UNLIKELY(fi->nr_evicts >= nlines)) {
+      fi->nr_small = 0;
+      if (nlines_log2 < FI_MAX_NUM_LINES_LOG2) {
+         HG_(free)( fi->tags );
+         Filter__alloc_lines( fi, nlines_log2 + 1 );
+         stats__filter_grows++;
+         return True;
+      }
+   } else if (fi->nr_dirty < nlines / 16) {
+      if (UNLIKELY(++fi->nr_small >= FI_SHRINK_CLEARS)
+          && nlines_log2 > FI_MIN_NUM_LINES_LOG2) {
+         HG_(free)( fi->tags );
+         Filter__alloc_lines( fi, nlines_log2 - 1 );
+         stats__filter_shrinks++;
+         return True;
+      }
+   } else {
+      fi->nr_small = 0;
+   }
+   return False;
+}
+
 /* Forget everything we know -- clear the filter and let everything
    through.  This needs to be as fast as possible, since it is called
    every time the running thread changes, and every time a thread's
    vector clocks change, which can be quite frequent.  The obvious
    fast way to do this is simply to stuff in tags which we know are
    not going to match anything, since they're not aligned to the start
-   of a line. */
+   of a line.  Unless a large part of the filter was used, only the
+   lines used since the previous clear need this. */
 static void Filter__clear ( Filter* fi, const HChar* who )
 {
    UWord i;
    if (0) VG_(printf)("  Filter__clear(%p, %s)\n", fi, who);
-   for (i = 0; i < FI_NUM_LINES; i += 8) {
-      fi->tags[i+0] = 1; /* impossible value -- cannot match */
-      fi->tags[i+1] = 1;
-      fi->tags[i+2] = 1;
-      fi->tags[i+3] = 1;
-      fi->tags[i+4] = 1;
-      fi->tags[i+5] = 1;
-      fi->tags[i+6] = 1;
-      fi->tags[i+7] = 1;
+   stats__filter_clears++;
+   stats__filter_evicts += fi->nr_evicts;
+   if (Filter__maybe_resize( fi ))
+      return;
+   if (fi->nr_dirty <= (fi->lineno_mask + 1) / 8) {
+      for (i = 0; i < fi->nr_dirty; i++)
+         fi->tags[fi->dirty[i]] = 1;
+   } else {
+      stats__filter_clears_full++;
+      for (i = 0; i <= fi->lineno_mask; i += 8) {
+         fi->tags[i+0] = 1; /* impossible value -- cannot match */
+         fi->tags[i+1] = 1;
+         fi->tags[i+2] = 1;
+         fi->tags[i+3] = 1;
+         fi->tags[i+4] = 1;
+         fi->tags[i+5] = 1;
+         fi->tags[i+6] = 1;
+         fi->tags[i+7] = 1;
+      }
+      tl_assert(i == fi->lineno_mask + 1);
    }
-   tl_assert(i == FI_NUM_LINES);
+   fi->nr_dirty = 0;
+   fi->nr_evicts = 0;
+}
+
+/* Makes line lineno of fi hold atag, with nothing seen yet. */
+static inline void Filter__set_line ( Filter* fi, UWord lineno, Addr atag )
+{
+   FiLine* line = &fi->lines[lineno];
+   UWord   i;
+   if (fi->tags[lineno] == 1)
+      fi->dirty[fi->nr_dirty++] = lineno;
+   else
+      fi->nr_evicts++;
+   fi->tags[lineno] = atag;
+   for (i = 0; i < FI_LINE_SZB / 8; i++)
+      line->u16s[i] = 0;
 }
 
 /* Clearing an arbitrary range in the filter.  Unfortunately
@@ -3601,7 +3870,7 @@ static void Filter__clear ( Filter* fi, const HChar* who )
 static void Filter__clear_1byte ( Filter* fi, Addr a )
 {
    Addr    atag   = FI_GET_TAG(a);     /* tag of 'a' */
-   UWord   lineno = FI_GET_LINENO(a);  /* lineno for 'a' */
+   UWord   lineno = FI_GET_LINENO(fi, a);  /* lineno for 'a' */
    FiLine* line   = &fi->lines[lineno];
    UWord   loff   = (a - atag) / 8;
    UShort  mask   = 0x3 << (2 * (a & 7));
@@ -3618,7 +3887,7 @@ static void Filter__clear_1byte ( Filter* fi, Addr a )
 static void Filter__clear_8bytes_aligned ( Filter* fi, Addr a )
 {
    Addr    atag   = FI_GET_TAG(a);     /* tag of 'a' */
-   UWord   lineno = FI_GET_LINENO(a);  /* lineno for 'a' */
+   UWord   lineno = FI_GET_LINENO(fi, a);  /* lineno for 'a' */
    FiLine* line   = &fi->lines[lineno];
    UWord   loff   = (a - atag) / 8;
    if (LIKELY( fi->tags[lineno] == atag )) {
@@ -3662,6 +3931,11 @@ static void Filter__clear_range ( Filter* fi, Addr a, UWord len )
       copy of the data, then do it the fast way. On RETURN, we check
       the two values are equal. */
    Filter fi_check = *fi;
+   SizeT  fi_check_szB
+      = (fi->lineno_mask + 1) * (sizeof(Addr) + sizeof(FiLine));
+   fi_check.tags = HG_(zalloc)( "libhb.Filter__clear_range.1", fi_check_szB );
+   VG_(memcpy)(fi_check.tags, fi->tags, fi_check_szB);
+   fi_check.lines = (FiLine*)&fi_check.tags[fi->lineno_mask + 1];
    Filter__clear_range_SLOW(&fi_check, a, len);
 #  define RETURN goto check_and_return
 #  else
@@ -3676,7 +3950,7 @@ static void Filter__clear_range ( Filter* fi, Addr a, UWord len )
    UWord rlen = len; /* remaining length to clear */
 
    Addr    c = a; /* Current position we are clearing. */
-   UWord   clineno = FI_GET_LINENO(c); /* Current lineno we are clearing */
+   UWord   clineno = FI_GET_LINENO(fi, c); /* Current lineno we are clearing */
    FiLine* cline; /* Current line we are clearing */
    UWord   cloff; /* Current offset in line we are clearing, when clearing
                      partial lines. */
@@ -3732,7 +4006,7 @@ static void Filter__clear_range ( Filter* fi, Addr a, UWord len )
       rlen -= c - a;
    }
    // We have changed c, so re-establish clineno.
-   clineno = FI_GET_LINENO(c);
+   clineno = FI_GET_LINENO(fi, c);
 
    if (rlen >= FI_LINE_SZB) {
       /* Here, c is filter line-aligned. Clear all full lines that
@@ -3740,8 +4014,8 @@ static void Filter__clear_range ( Filter* fi, Addr a, UWord len )
       UWord nfull = rlen / FI_LINE_SZB;
       UWord full_len = nfull * FI_LINE_SZB;
       rlen -= full_len;
-      if (nfull > FI_NUM_LINES)
-         nfull = FI_NUM_LINES; // no need to check several times the same entry.
+      if (nfull > fi->lineno_mask + 1)
+         nfull = fi->lineno_mask + 1; // no need to check several times the same entry.
 
       for (UWord n = 0; n < nfull; n++) {
          if (UNLIKELY(address_in_range(fi->tags[clineno], c, full_len))) {
@@ -3752,18 +4026,16 @@ static void Filter__clear_range ( Filter* fi, Addr a, UWord len )
             cline->u16s[3] = 0;
             STATIC_ASSERT (4 == sizeof(cline->u16s)/sizeof(cline->u16s[0]));
          }
-         clineno++;
-         if (UNLIKELY(clineno == FI_NUM_LINES))
-            clineno = 0;
+         clineno = (clineno + 1) & fi->lineno_mask;
       }
 
       c += full_len;
-      clineno = FI_GET_LINENO(c);
+      clineno = FI_GET_LINENO(fi, c);
    }
 
    if (CHECK_ZSM) {
       tl_assert(VG_IS_8_ALIGNED(c));
-      tl_assert(clineno == FI_GET_LINENO(c));
+      tl_assert(clineno == FI_GET_LINENO(fi, c));
    }
 
    /* Do the last filter line, if it was not cleared as a full filter line */
@@ -3795,7 +4067,8 @@ static void Filter__clear_range ( Filter* fi, Addr a, UWord len )
 
 #  if CHECK_ZSM > 0
    check_and_return:
-   tl_assert (VG_(memcmp)(&fi_check, fi, sizeof(fi_check)) == 0);
+   tl_assert (VG_(memcmp)(fi_check.tags, fi->tags, fi_check_szB) == 0);
+   HG_(free)(fi_check.tags);
 #  endif
 #  undef RETURN
 }
@@ -3808,7 +4081,7 @@ static inline Bool Filter__ok_to_skip_crd64 ( Filter* fi, Addr a )
       return False;
    { 
      Addr    atag   = FI_GET_TAG(a);     /* tag of 'a' */
-     UWord   lineno = FI_GET_LINENO(a);  /* lineno for 'a' */
+     UWord   lineno = FI_GET_LINENO(fi, a);  /* lineno for 'a' */
      FiLine* line   = &fi->lines[lineno];
      UWord   loff   = (a - atag) / 8;
      UShort  mask   = 0xAAAA;
@@ -3820,10 +4093,7 @@ static inline Bool Filter__ok_to_skip_crd64 ( Filter* fi, Addr a )
         return ok;
      } else {
         /* miss.  nuke existing line and re-use it. */
-        UWord i;
-        fi->tags[lineno] = atag;
-        for (i = 0; i < FI_LINE_SZB / 8; i++)
-           line->u16s[i] = 0;
+        Filter__set_line( fi, lineno, atag );
         line->u16s[loff] = mask;
         return False;
      }
@@ -3836,7 +4106,7 @@ static inline Bool Filter__ok_to_skip_crd32 ( Filter* fi, Addr a )
       return False;
    {
      Addr    atag   = FI_GET_TAG(a);     /* tag of 'a' */
-     UWord   lineno = FI_GET_LINENO(a);  /* lineno for 'a' */
+     UWord   lineno = FI_GET_LINENO(fi, a);  /* lineno for 'a' */
      FiLine* line   = &fi->lines[lineno];
      UWord   loff   = (a - atag) / 8;
      UShort  mask   = 0xAA << (2 * (a & 4)); /* 0xAA00 or 0x00AA */
@@ -3848,10 +4118,7 @@ static inline Bool Filter__ok_to_skip_crd32 ( Filter* fi, Addr a )
         return ok;
      } else {
         /* miss.  nuke existing line and re-use it. */
-        UWord   i;
-        fi->tags[lineno] = atag;
-        for (i = 0; i < FI_LINE_SZB / 8; i++)
-           line->u16s[i] = 0;
+        Filter__set_line( fi, lineno, atag );
         line->u16s[loff] = mask;
         return False;
      }
@@ -3864,7 +4131,7 @@ static inline Bool Filter__ok_to_skip_crd16 ( Filter* fi, Addr a )
       return False;
    {
      Addr    atag   = FI_GET_TAG(a);     /* tag of 'a' */
-     UWord   lineno = FI_GET_LINENO(a);  /* lineno for 'a' */
+     UWord   lineno = FI_GET_LINENO(fi, a);  /* lineno for 'a' */
      FiLine* line   = &fi->lines[lineno];
      UWord   loff   = (a - atag) / 8;
      UShort  mask   = 0xA << (2 * (a & 6));
@@ -3877,10 +4144,7 @@ static inline Bool Filter__ok_to_skip_crd16 ( Filter* fi, Addr a )
         return ok;
      } else {
         /* miss.  nuke existing line and re-use it. */
-        UWord   i;
-        fi->tags[lineno] = atag;
-        for (i = 0; i < FI_LINE_SZB / 8; i++)
-           line->u16s[i] = 0;
+        Filter__set_line( fi, lineno, atag );
         line->u16s[loff] = mask;
         return False;
      }
@@ -3891,7 +4155,7 @@ static inline Bool Filter__ok_to_skip_crd08 ( Filter* fi, Addr a )
 {
    {
      Addr    atag   = FI_GET_TAG(a);     /* tag of 'a' */
-     UWord   lineno = FI_GET_LINENO(a);  /* lineno for 'a' */
+     UWord   lineno = FI_GET_LINENO(fi, a);  /* lineno for 'a' */
      FiLine* line   = &fi->lines[lineno];
      UWord   loff   = (a - atag) / 8;
      UShort  mask   = 0x2 << (2 * (a & 7));
@@ -3904,10 +4168,7 @@ static inline Bool Filter__ok_to_skip_crd08 ( Filter* fi, Addr a )
         return ok;
      } else {
         /* miss.  nuke existing line and re-use it. */
-        UWord   i;
-        fi->tags[lineno] = atag;
-        for (i = 0; i < FI_LINE_SZB / 8; i++)
-           line->u16s[i] = 0;
+        Filter__set_line( fi, lineno, atag );
         line->u16s[loff] = mask;
         return False;
      }
@@ -3923,7 +4184,7 @@ static inline Bool Filter__ok_to_skip_cwr64 ( Filter* fi, Addr a )
       return False;
    { 
      Addr    atag   = FI_GET_TAG(a);     /* tag of 'a' */
-     UWord   lineno = FI_GET_LINENO(a);  /* lineno for 'a' */
+     UWord   lineno = FI_GET_LINENO(fi, a);  /* lineno for 'a' */
      FiLine* line   = &fi->lines[lineno];
      UWord   loff   = (a - atag) / 8;
      UShort  mask   = 0xFFFF;
@@ -3935,10 +4196,7 @@ static inline Bool Filter__ok_to_skip_cwr64 ( Filter* fi, Addr a )
         return ok;
      } else {
         /* miss.  nuke existing line and re-use it. */
-        UWord i;
-        fi->tags[lineno] = atag;
-        for (i = 0; i < FI_LINE_SZB / 8; i++)
-           line->u16s[i] = 0;
+        Filter__set_line( fi, lineno, atag );
         line->u16s[loff] = mask;
         return False;
      }
@@ -3951,7 +4209,7 @@ static inline Bool Filter__ok_to_skip_cwr32 ( Filter* fi, Addr a )
       return False;
    {
      Addr    atag   = FI_GET_TAG(a);     /* tag of 'a' */
-     UWord   lineno = FI_GET_LINENO(a);  /* lineno for 'a' */
+     UWord   lineno = FI_GET_LINENO(fi, a);  /* lineno for 'a' */
      FiLine* line   = &fi->lines[lineno];
      UWord   loff   = (a - atag) / 8;
      UShort  mask   = 0xFF << (2 * (a & 4)); /* 0xFF00 or 0x00FF */
@@ -3963,10 +4221,7 @@ static inline Bool Filter__ok_to_skip_cwr32 ( Filter* fi, Addr a )
         return ok;
      } else {
         /* miss.  nuke existing line and re-use it. */
-        UWord   i;
-        fi->tags[lineno] = atag;
-        for (i = 0; i < FI_LINE_SZB / 8; i++)
-           line->u16s[i] = 0;
+        Filter__set_line( fi, lineno, atag );
         line->u16s[loff] = mask;
         return False;
      }
@@ -3979,7 +4234,7 @@ static inline Bool Filter__ok_to_skip_cwr16 ( Filter* fi, Addr a )
       return False;
    {
      Addr    atag   = FI_GET_TAG(a);     /* tag of 'a' */
-     UWord   lineno = FI_GET_LINENO(a);  /* lineno for 'a' */
+     UWord   lineno = FI_GET_LINENO(fi, a);  /* lineno for 'a' */
      FiLine* line   = &fi->lines[lineno];
      UWord   loff   = (a - atag) / 8;
      UShort  mask   = 0xF << (2 * (a & 6));
@@ -3992,10 +4247,7 @@ static inline Bool Filter__ok_to_skip_cwr16 ( Filter* fi, Addr a )
         return ok;
      } else {
         /* miss.  nuke existing line and re-use it. */
-        UWord   i;
-        fi->tags[lineno] = atag;
-        for (i = 0; i < FI_LINE_SZB / 8; i++)
-           line->u16s[i] = 0;
+        Filter__set_line( fi, lineno, atag );
         line->u16s[loff] = mask;
         return False;
      }
@@ -4006,7 +4258,7 @@ static inline Bool Filter__ok_to_skip_cwr08 ( Filter* fi, Addr a )
 {
    {
      Addr    atag   = FI_GET_TAG(a);     /* tag of 'a' */
-     UWord   lineno = FI_GET_LINENO(a);  /* lineno for 'a' */
+     UWord   lineno = FI_GET_LINENO(fi, a);  /* lineno for 'a' */
      FiLine* line   = &fi->lines[lineno];
      UWord   loff   = (a - atag) / 8;
      UShort  mask   = 0x3 << (2 * (a & 7));
@@ -4019,10 +4271,7 @@ static inline Bool Filter__ok_to_skip_cwr08 ( Filter* fi, Addr a )
         return ok;
      } else {
         /* miss.  nuke existing line and re-use it. */
-        UWord   i;
-        fi->tags[lineno] = atag;
-        for (i = 0; i < FI_LINE_SZB / 8; i++)
-           line->u16s[i] = 0;
+        Filter__set_line( fi, lineno, atag );
         line->u16s[loff] = mask;
         return False;
      }
@@ -4079,7 +4328,8 @@ static Thr* Thr__new ( void )
    thr->viW = VtsID_INVALID;
    thr->llexit_done = False;
    thr->joinedwith_done = False;
-   thr->filter = HG_(zalloc)( "libhb.Thr__new.2", sizeof(Filter) );
+   thr->pruned = False;
+   thr->filter = Filter__new();
    if (HG_(clo_history_level) == 1)
       thr->local_Kws_n_stacks
          = VG_(newXA)( HG_(zalloc),
@@ -4298,6 +4548,7 @@ static UWord stats__ctxt_tab_cmps = 0;
 
 //////////// BEGIN RCEC pool allocator
 static PoolAlloc* rcec_pool_allocator;
+static SizeT      rcec_szB; /* size of an RCEC including its frames */
 static RCEC* alloc_RCEC ( void ) {
    return VG_(allocEltPA) ( rcec_pool_allocator );
 }
@@ -4819,8 +5070,9 @@ static Word cmp_oldref_tsw (const void* node1, const void* node2 )
 
 //////////// BEGIN OldRef pool allocator
 static PoolAlloc* oldref_pool_allocator;
-// Note: We only allocate elements in this pool allocator, we never free them.
-// We stop allocating elements at VG_(clo_conflict_cache_size).
+// Note: We stop allocating elements at VG_(clo_conflict_cache_size).
+// Elements are only freed when --history-budget is exceeded, see
+// evict_lru_OldRef.
 //////////// END OldRef pool allocator
 
 static OldRef mru; 
@@ -4863,25 +5115,70 @@ static inline void OldRef_newest(OldRef *new)
 static VgHashTable* oldrefHT    = NULL; /* Hash table* OldRef* */
 static UWord     oldrefHTN    = 0;    /* # elems in oldrefHT */
 /* Note: the nr of ref in the oldrefHT will always be equal to
-   the nr of elements that were allocated from the OldRef pool allocator
-   as we never free an OldRef : we just re-use them. */
+   the nr of elements that were allocated (and not freed) from the
+   OldRef pool allocator : we normally just re-use them. */
+
+static UWord stats__evm__budget_evictions = 0;
 
+/* Memory budget in bytes for the OldRefs and RCECs, as given by
+   --history-budget.  0 means no budget : only the nr of OldRefs is
+   limited, by --conflict-cache-size. */
+static SizeT event_map_budget_szB = 0;
+
+/* Memory used by the OldRefs and by the RCECs referenced from them,
+   with nr_rcec RCECs. */
+static inline SizeT event_map_szB ( UWord nr_rcec )
+{
+   return oldrefHTN * sizeof(OldRef) + nr_rcec * rcec_szB;
+}
+
+static inline Bool event_map_over_budget ( UWord nr_rcec )
+{
+   return event_map_budget_szB > 0
+          && event_map_szB(nr_rcec) > event_map_budget_szB;
+}
+
+/* True if one more OldRef still fits in the budget. */
+static inline Bool event_map_can_grow ( void )
+{
+   return event_map_budget_szB == 0
+          || event_map_szB(RCEC_referenced) + sizeof(OldRef)
+                <= event_map_budget_szB;
+}
+
+/* Removes the lru OldRef from the event map and returns it. */
+static OldRef* evict_lru_OldRef ( void )
+{
+   OldRef *oldref_ht;
+   OldRef *oldref = lru.next;
+
+   tl_assert (oldref != &mru);
+   OldRef_unchain(oldref);
+   oldref_ht = VG_(HT_gen_remove) (oldrefHT, oldref, cmp_oldref_tsw);
+   tl_assert (oldref == oldref_ht);
+   ctxt__rcdec( oldref->acc.rcec );
+   return oldref;
+}
 
 /* allocates a new OldRef or re-use the lru one if all allowed OldRef
-   have already been allocated. */
+   have already been allocated, or if the memory budget is reached.
+   When over budget, the oldest OldRefs are freed, until the OldRefs
+   and the RCECs they reference fit again in the budget. */
 static OldRef* alloc_or_reuse_OldRef ( void )
 {
-   if (oldrefHTN < HG_(clo_conflict_cache_size)) {
+   if (lru.next == &mru
+       || (oldrefHTN < HG_(clo_conflict_cache_size)
+           && event_map_can_grow())) {
       oldrefHTN++;
       return VG_(allocEltPA) ( oldref_pool_allocator );
    } else {
-      OldRef *oldref_ht;
-      OldRef *oldref = lru.next;
+      OldRef *oldref = evict_lru_OldRef();
 
-      OldRef_unchain(oldref);
-      oldref_ht = VG_(HT_gen_remove) (oldrefHT, oldref, cmp_oldref_tsw);
-      tl_assert (oldref == oldref_ht);
-      ctxt__rcdec( oldref->acc.rcec );
+      while (event_map_over_budget(RCEC_referenced) && lru.next != &mru) {
+         VG_(freeEltPA) ( oldref_pool_allocator, evict_lru_OldRef() );
+         oldrefHTN--;
+         stats__evm__budget_evictions++;
+      }
       return oldref;
    }
 }
@@ -5125,9 +5422,10 @@ static void event_map_init ( void )
    Word i;
 
    /* Context (RCEC) pool allocator */
+   rcec_szB = sizeof(RCEC) + HG_(clo_history_backtrace_size) * sizeof(UWord);
    rcec_pool_allocator 
       = VG_(newPA) (
-         sizeof(RCEC) + 2 * HG_(clo_history_backtrace_size) * sizeof(UWord),
+         rcec_szB,
          1000 /* RCECs per pool */,
          HG_(zalloc),
          "libhb.event_map_init.1 (RCEC pools)",
@@ -5155,6 +5453,7 @@ static void event_map_init ( void )
    oldrefHT = VG_(HT_construct) ("libhb.event_map_init.4 (oldref hashtable)");
 
    oldrefHTN = 0;
+   event_map_budget_szB = (SizeT)HG_(clo_history_budget) * 1024 * 1024;
    mru.prev = &lru;
    mru.next = NULL;
    lru.prev = NULL;
@@ -6124,7 +6423,7 @@ static void zsm_sset_range ( Addr a, SizeT len, SVal svNew )
       /* tag is 'a' with the in-line offset masked out, 
          eg a[31]..a[4] 0000 */
       Addr       tag = a & ~(N_LINE_ARANGE - 1);
-      UWord      wix = (a >> N_LINE_BITS) & (N_WAY_NENT - 1);
+      UWord      wix = (a >> N_LINE_BITS) & (cache_shmem.nent - 1);
       if (LIKELY(tag == cache_shmem.tags0[wix])) {
          n_New_in_cache++;
       } else {
@@ -6172,7 +6471,7 @@ static void zsm_sset_range ( Addr a, SizeT len, SVal svNew )
             break;
          tl_assert(get_cacheline_offset(aligned_start) == 0);
          tag = aligned_start & ~(N_LINE_ARANGE - 1);
-         wix = (aligned_start >> N_LINE_BITS) & (N_WAY_NENT - 1);
+         wix = (aligned_start >> N_LINE_BITS) & (cache_shmem.nent - 1);
          if (tag == cache_shmem.tags0[wix]) {
             UWord i;
             for (i = 0; i < N_LINE_ARANGE / 8; i++)
@@ -6562,6 +6861,19 @@ Thr* libhb_init (
    // We will have to have to store a large number of these,
    // so make sure they're the size we expect them to be.
    STATIC_ASSERT(sizeof(ScalarTS) == 8);
+   { ScalarTS st;
+     *(ULong*)&st = 0;
+     st.thrid = ThrID_MAX_VALID;
+     vts_thrid_mask = *(ULong*)&st;
+     tl_assert(vts_thrid_mask != 0);
+   }
+#  if defined(VTS_DENSE_AVX2)
+   { VexArch     arch;
+     VexArchInfo archinfo;
+     VG_(machine_get_VexArchInfo)( &arch, &archinfo );
+     vts_dense_avx2 = (archinfo.hwcaps & VEX_HWCAPS_AMD64_AVX2) != 0;
+   }
+#  endif
 
    /* because first 1024 unusable */
    STATIC_ASSERT(SCALARTS_N_THRBITS >= 11);
@@ -6678,16 +6990,31 @@ void libhb_shutdown ( Bool show_stats )
                   SecMap_freelist_length(),
                   stats__secmaps_scanGCed,
                   stats__secmaps_ssetGCed);
-      VG_(printf)(" secmaps: %'10lu searches (%'12lu slow)\n",
-                  stats__secmaps_search, stats__secmaps_search_slow);
+      VG_(printf)(" secmaps: %'10lu searches (%'12lu table, %'lu slow),"
+                  " %'lu table chunks\n",
+                  stats__secmaps_search, stats__secmaps_search_tab,
+                  stats__secmaps_search_slow, stats__secmaps_tab_l2);
 
       VG_(printf)("%s","\n");
-      VG_(printf)("   cache: %'lu totrefs (%'lu misses)\n",
-                  stats__cache_totrefs, stats__cache_totmisses );
+      VG_(printf)("   cache: %'lu totrefs (%'lu misses), 2^%u entries\n",
+                  stats__cache_totrefs, stats__cache_totmisses,
+                  N_WAY_BITS );
       VG_(printf)("   cache: %'14lu Z-fetch,    %'14lu F-fetch\n",
                   stats__cache_Z_fetches, stats__cache_F_fetches );
       VG_(printf)("   cache: %'14lu Z-wback,    %'14lu F-wback\n",
                   stats__cache_Z_wbacks, stats__cache_F_wbacks );
+      {
+         /* fetches and writebacks per 10000 refs */
+         UWord refs = stats__cache_totrefs > 0 ? stats__cache_totrefs : 1;
+         UWord fetches = ((stats__cache_Z_fetches + stats__cache_F_fetches)
+                          * 10000ULL) / refs;
+         UWord wbacks  = ((stats__cache_Z_wbacks + stats__cache_F_wbacks)
+                          * 10000ULL) / refs;
+         VG_(printf)("   cache: fetch rate %lu.%02lu%%,"
+                     " wback rate %lu.%02lu%%\n",
+                     fetches / 100, fetches % 100,
+                     wbacks / 100, wbacks % 100);
+      }
       VG_(printf)("   cache: %'14lu flushes_invals\n",
                   stats__cache_flushes_invals );
       VG_(printf)("   cache: %'14llu arange_New  %'14llu direct-to-Zreps\n",
@@ -6730,6 +7057,11 @@ void libhb_shutdown ( Bool show_stats )
 
       VG_(printf)("%s","\n");
 
+      VG_(printf)("   libhb: filter: %'lu clears (%'lu full),"
+                  " %'lu line evicts, %'lu grows, %'lu shrinks\n",
+                  stats__filter_clears, stats__filter_clears_full,
+                  stats__filter_evicts, stats__filter_grows,
+                  stats__filter_shrinks);
       VG_(printf)("   libhb: %'13llu msmcread  (%'llu dragovers)\n",
                   stats__msmcread, stats__msmcread_change);
       VG_(printf)("   libhb: %'13llu msmcwrite (%'llu dragovers)\n",
@@ -6742,6 +7074,14 @@ void libhb_shutdown ( Bool show_stats )
       VG_(printf)("%s","\n");
       VG_(printf)("   libhb: VTSops: tick %'lu,  join %'lu,  cmpLEQ %'lu\n",
                   stats__vts__tick, stats__vts__join,  stats__vts__cmpLEQ );
+      VG_(printf)("   libhb: VTSops: dense entries: join %'lu,  cmpLEQ %'lu%s\n",
+                  stats__vts__join_dense, stats__vts__cmpLEQ_dense,
+#                 if defined(VTS_DENSE_AVX2)
+                  vts_dense_avx2 ? " (avx2)" : ""
+#                 else
+                  ""
+#                 endif
+                  );
       VG_(printf)("   libhb: VTSops: cmp_structural %'lu (%'lu slow)\n",
                   stats__vts__cmp_structural, stats__vts__cmp_structural_slow);
       VG_(printf)("   libhb: VTSset: find__or__clone_and_add %'lu"
@@ -6801,6 +7141,12 @@ void libhb_shutdown ( Bool show_stats )
       tl_assert (oldrefHTN == VG_(HT_count_nodes) (oldrefHT));
       VG_(printf)( "   libhb: oldref lookup found=%lu notfound=%lu\n",
                    stats__evm__lookup_found, stats__evm__lookup_notfound);
+      if (event_map_budget_szB > 0)
+         VG_(printf)( "   libhb: event map %'lu bytes, budget %'lu bytes,"
+                      " %'lu oldref budget evictions\n",
+                      (UWord)event_map_szB(stats__ctxt_tab_curr),
+                      (UWord)event_map_budget_szB,
+                      stats__evm__budget_evictions);
       if (VG_(clo_verbosity) > 1)
          VG_(HT_print_stats) (oldrefHT, cmp_oldref_tsw);
       VG_(printf)( "   libhb: oldref bind tsw/rcec "
@@ -6907,7 +7253,7 @@ void libhb_async_exit ( Thr* thr )
    /* free up Filter and local_Kws_n_stacks (well, actually not the
       latter ..) */
    tl_assert(thr->filter);
-   HG_(free)(thr->filter);
+   Filter__delete(thr->filter);
    thr->filter = NULL;
 
    /* Tell the VTS mechanism this thread has exited, so it can
@@ -6967,6 +7313,9 @@ void libhb_so_send ( Thr* thr, SO* so, Bool strong_send )
    tl_assert(so);
    tl_assert(so->magic == SO_MAGIC);
 
+   /* Spread the work of an active VTS GC round over sync events. */
+   vts_tab__maybe_GC_step();
+
    /* stay sane .. a thread's read-clock must always lead or be the
       same as its write-clock */
    { Bool leq = VtsID__cmpLEQ(thr->viW, thr->viR);
@@ -7263,6 +7612,7 @@ static void zsm_sset_range_noaccess (Addr addr, SizeT len)
             stats__secmaps_in_map_shmem--;
             tl_assert (gaKey == sm_start);
             tl_assert (sm == fm_sm);
+            sm_tab_remove (gaKey, sm);
             stats__secmaps_ssetGCed++;
             push_SecMap_on_freelist (sm);
          }
@@ -7317,7 +7667,7 @@ UWord libhb_srange_get_abits (Addr a, UChar *abits, SizeT len)
       SVal       sv = SVal_INVALID;
       Addr       b = a + i;
       Addr       tag = b & ~(N_LINE_ARANGE - 1);
-      UWord      wix = (b >> N_LINE_BITS) & (N_WAY_NENT - 1);
+      UWord      wix = (b >> N_LINE_BITS) & (cache_shmem.nent - 1);
       UWord      cloff = get_cacheline_offset(b);
 
       /* Note: we do not use get_cacheline(b) to avoid creating cachelines
@@ -7412,18 +7762,24 @@ void libhb_maybe_GC ( void )
      and (3) the nr of referenced RCECs is less than 75% than total nr RCECs.
      Avoid growing too much the nr of RCEC keeps the memory use low,
      and avoids to have too many elements in the (fixed) contextTab hashtable.
+     With --history-budget, (1) and (2) are replaced by the unreferenced
+     RCECs making the event map go over budget.
    */
-   if (UNLIKELY(stats__ctxt_tab_curr > N_RCEC_TAB/2
-                && stats__ctxt_tab_curr + 1000 >= stats__ctxt_tab_max
+   if (UNLIKELY(((stats__ctxt_tab_curr > N_RCEC_TAB/2
+                  && stats__ctxt_tab_curr + 1000 >= stats__ctxt_tab_max)
+                 || event_map_over_budget(stats__ctxt_tab_curr))
                 && (stats__ctxt_tab_curr * 3)/4 > RCEC_referenced))
       do_RCEC_GC();
 
-   /* If there are still no entries available (all the table entries are full),
-      and we hit the threshold point, then do a GC */
-   Bool vts_tab_GC = vts_tab_freelist == VtsID_INVALID
+   /* Go on with the VTS GC round, if one is active.  Else, if there
+      are still no entries available (all the table entries are full),
+      and we hit the threshold point, then start a GC round */
+   vts_tab__maybe_GC_step();
+   Bool vts_tab_GC = vts_gc_next == vts_gc_end
+      && vts_tab_freelist == VtsID_INVALID
       && VG_(sizeXA)( vts_tab ) >= vts_next_GC_at;
    if (UNLIKELY (vts_tab_GC))
-      vts_tab__do_GC( False/*don't show stats*/ );
+      vts_tab__start_GC( False/*don't show stats*/ );
 
    /* scan GC the SecMaps when
           (1) no SecMap in the freelist
@@ -0,0 +1,54 @@
+/* With a tiny --history-budget, the oldest accesses are forgotten, but
+   races are still reported.  The child writes y, then enough other
+   memory from enough different stacks to go over the budget many times,
+   then x.  The parent then writes x and y: the race on x is reported
+   with both stacks, the race on y without the child's stack. */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include "../../helgrind/helgrind.h"
+
+#define N_WORDS (256 * 1024)
+
+static int x, y;
+static int* buf;
+static volatile int done;
+
+static void __attribute__((noinline)) fill ( int depth, int i )
+{
+   if (depth > 0) {
+      fill(depth - 1, i);
+      return;
+   }
+   buf[i] = i;
+}
+
+static void* child_fn ( void* arg )
+{
+   int i;
+
+   y = 1;
+   for (i = 0; i < N_WORDS; i++)
+      fill(i % 32, i);
+   x = 1;
+   done = 1;
+   return NULL;
+}
+
+int main ( void )
+{
+   pthread_t child;
+
+   buf = malloc(N_WORDS * sizeof(int));
+   /* Waiting for done does not order the accesses to x and y. */
+   VALGRIND_HG_DISABLE_CHECKING(&done, sizeof(done));
+   if (pthread_create(&child, NULL, child_fn, NULL))
+      return 1;
+   while (!done)
+      sched_yield();
+
+   x = 2;
+   y = 2;
+   return 0;
+}
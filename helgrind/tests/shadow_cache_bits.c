@@ -0,0 +1,41 @@
+/* With a small shadow cache (--shadow-cache-bits=10), writing a few MB
+   evicts most cache lines to their SecMaps, which are then found
+   through the direct-mapped SecMap table when the lines are fetched
+   again.  The races on the first and the last word of the buffer are
+   still reported. */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include "../../helgrind/helgrind.h"
+
+#define N_WORDS (1024 * 1024)
+
+static int* buf;
+static volatile int done;
+
+static void* child_fn ( void* arg )
+{
+   int i;
+   for (i = 0; i < N_WORDS; i++)
+      buf[i] = i;
+   done = 1;
+   return NULL;
+}
+
+int main ( void )
+{
+   pthread_t child;
+
+   buf = malloc(N_WORDS * sizeof(int));
+   /* Waiting for done does not order the accesses to buf. */
+   VALGRIND_HG_DISABLE_CHECKING(&done, sizeof(done));
+   if (pthread_create(&child, NULL, child_fn, NULL))
+      return 1;
+   while (!done)
+      sched_yield();
+
+   buf[0] = 0;
+   buf[N_WORDS - 1] = 0;
+   return 0;
+}
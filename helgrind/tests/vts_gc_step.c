@@ -0,0 +1,40 @@
+/* Create and join many short-lived threads, so that with
+   --vts-pruning=always --vts-gc-step=1 there are many VTS GC rounds,
+   each spread over many steps, that prune the very dead threads and
+   make pruned VTSs aliases of structurally identical ones. */
+
+#include <pthread.h>
+#include <stdio.h>
+
+#define N_ROUNDS  50
+#define N_THREADS 4
+#define N_ITERS   100
+
+static pthread_mutex_t mx = PTHREAD_MUTEX_INITIALIZER;
+static long counter;
+
+static void* child_fn ( void* arg )
+{
+   int i;
+   for (i = 0; i < N_ITERS; i++) {
+      pthread_mutex_lock(&mx);
+      counter++;
+      pthread_mutex_unlock(&mx);
+   }
+   return NULL;
+}
+
+int main ( void )
+{
+   pthread_t t[N_THREADS];
+   int r, i;
+
+   for (r = 0; r < N_ROUNDS; r++) {
+      for (i = 0; i < N_THREADS; i++)
+         pthread_create(&t[i], NULL, child_fn, NULL);
+      for (i = 0; i < N_THREADS; i++)
+         pthread_join(t[i], NULL);
+   }
+   printf("counter %ld\n", counter);
+   return 0;
+}
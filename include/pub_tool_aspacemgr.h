@@ -155,6 +155,21 @@ extern Bool VG_(am_is_valid_for_client) ( Addr start, SizeT len,
 /* Really just a wrapper around VG_(am_mmap_anon_float_valgrind). */
 extern void* VG_(am_shadow_alloc)(SizeT size);
 
+/* Size and alignment of the transparent huge pages asked for below. */
+#define VG_HUGEPAGE_SZB (2 * 1024 * 1024)
+
+/* Like VG_(am_shadow_alloc), but the memory is aligned to
+   VG_HUGEPAGE_SZB and, where the kernel supports it, advised to be
+   backed by transparent huge pages.  size must be a multiple of
+   VG_HUGEPAGE_SZB. */
+extern void* VG_(am_shadow_alloc_huge)(SizeT size);
+
+/* Advise the kernel to back the VG_HUGEPAGE_SZB aligned part of the
+   given range by transparent huge pages.  Returns False if the advice
+   could not be given, e.g. because the range contains no aligned huge
+   page, or the kernel does not support transparent huge pages. */
+extern Bool VG_(am_advise_hugepages)(Addr start, SizeT len);
+
 /* Unmap the given address range and update the segment array
    accordingly.  This fails if the range isn't valid for valgrind. */
 extern SysRes VG_(am_munmap_valgrind)( Addr start, SizeT length );
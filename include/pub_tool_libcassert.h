@@ -50,6 +50,11 @@
 __attribute__ ((__noreturn__))
 extern void VG_(exit)( Int status );
 
+/* Lightweight exit without any dependencies, e.g. for a helper process
+   created with VG_(fork). */
+__attribute__ ((__noreturn__))
+extern void VG_(exit_now)( Int status );
+
 /* Prints a panic message, appends newline and bug reporting info, aborts. */
 __attribute__ ((__noreturn__))
 extern void  VG_(tool_panic) ( const HChar* str );
@@ -254,6 +254,8 @@ enum {
    MCPE_STOREV32_SLOW2,
    MCPE_STOREV32_SLOW3,
    MCPE_STOREV32_SLOW4,
+   MCPE_STOREV_128_OR_256,
+   MCPE_STOREV_128_OR_256_SLOW,
    MCPE_STOREV64,
    MCPE_STOREV64_SLOW1,
    MCPE_STOREV64_SLOW2,
@@ -359,6 +361,11 @@ extern ULong MC_(event_ctr)[MCPE_LAST];
 #define SM_SIZE 65536            /* DO NOT CHANGE */
 #define SM_MASK (SM_SIZE-1)      /* DO NOT CHANGE */
 
+/* On 64-bit hosts, the primary map covers the addresses below
+   1 << MC_PRIMARY_MAP_ADDR_BITS.  Needed by the amd64 assembly helpers
+   in mc_main_asm.c; mc_main.c checks it agrees with N_PRIMARY_BITS. */
+#define MC_PRIMARY_MAP_ADDR_BITS 37
+
 #define V_BIT_DEFINED         0
 #define V_BIT_UNDEFINED       1
 
@@ -508,6 +515,13 @@ extern HChar * MC_(snprintf_delta) (HChar * buf, Int size,
 Bool MC_(is_valid_aligned_word)     ( Addr a );
 Bool MC_(is_within_valid_secondary) ( Addr a );
 
+// With --leak-check-incremental=yes, MC_(sm_dirty)[a / SM_SIZE] is set
+// when the memory at a might have been modified since the leak checker
+// cleared it.  Only valid for a / SM_SIZE < MC_(sm_dirty_n).  NULL if
+// not tracking modified memory.
+extern UChar* MC_(sm_dirty);
+extern UWord  MC_(sm_dirty_n);
+
 // Prints as user msg a description of the given loss record.
 void MC_(pp_LossRecord)(UInt n_this_record, UInt n_total_records,
                         LossRecord* l);
@@ -673,6 +687,28 @@ typedef
    Default : all heuristics. */
 extern UInt MC_(clo_leak_check_heuristics);
 
+/* Nr of helper processes scanning the heap blocks during a leak search.
+   Default : 0, i.e. the search is done by Valgrind itself. */
+#define MAX_LEAK_CHECK_HELPERS 64
+extern Int MC_(clo_leak_check_helpers);
+
+/* If True, a leak search only rescans the memory modified since the
+   previous leak search.  Default : False. */
+extern Bool MC_(clo_leak_check_incremental);
+
+/* If True, secondary maps with identical contents are periodically
+   replaced by a single read-only copy.  Default : False. */
+extern Bool MC_(clo_dedup_secmaps);
+
+/* If True, the secondary maps are allocated in arenas backed by
+   transparent huge pages.  Default : False. */
+extern Bool MC_(clo_shadow_huge_pages);
+
+/* Comma-separated soname patterns of the objects whose code is not
+   checked for the use of undefined values, and whose results are taken
+   to be defined.  Default : NULL, i.e. no such object. */
+extern const HChar* MC_(clo_trusted_objects);
+
 /* Assume accesses immediately below %esp are due to gcc-2.96 bugs.
  * default: NO */
 extern Bool MC_(clo_workaround_gcc296_bugs);
@@ -783,6 +819,10 @@ VG_REGPARM(2) void MC_(helperc_STOREV32le) ( Addr, UWord );
 VG_REGPARM(2) void MC_(helperc_STOREV16be) ( Addr, UWord );
 VG_REGPARM(2) void MC_(helperc_STOREV16le) ( Addr, UWord );
 VG_REGPARM(2) void MC_(helperc_STOREV8)    ( Addr, UWord );
+/* Only used on 64-bit little-endian hosts; V bits are passed as 64-bit
+   lanes, least significant first. */
+void MC_(helperc_STOREV256le) ( Addr, ULong, ULong, ULong, ULong );
+void MC_(helperc_STOREV128le) ( Addr, ULong, ULong );
 
 VG_REGPARM(2) void  MC_(helperc_LOADV256be) ( /*OUT*/V256*, Addr );
 VG_REGPARM(2) void  MC_(helperc_LOADV256le) ( /*OUT*/V256*, Addr );
@@ -34,7 +34,9 @@
 #include "pub_tool_hashtable.h"
 #include "pub_tool_libcbase.h"
 #include "pub_tool_libcassert.h"
+#include "pub_tool_libcfile.h"      // VG_(pipe), VG_(read), VG_(write)
 #include "pub_tool_libcprint.h"
+#include "pub_tool_libcproc.h"      // VG_(fork), VG_(waitpid)
 #include "pub_tool_libcsignal.h"
 #include "pub_tool_machine.h"
 #include "pub_tool_mallocfree.h"
@@ -519,6 +521,23 @@ static SizeT lc_scanned_szB;
 // caused a signal such as SIGSEGV.
 static SizeT lc_sig_skipped_szB;
 
+// With --leak-check-helpers=N, the contents of every block are scanned up
+// front by N helper processes (see lc_start_helpers), each of which records
+// the pointers to blocks found in its share of the blocks.  The mark phases
+// then walk these recorded pointers instead of rescanning the blocks.
+// The pointers found in block i are lc_edge_ptr[j] for lc_edge_first[i]
+// <= j < lc_edge_first[i+1], pointing into block lc_edge_ch[j], in the
+// order a scan of block i would have found them.  lc_edge_words[i] is the
+// number of words of block i that such a scan would have looked at.
+// All NULL if no helpers were used.
+static ULong* lc_edge_first;
+static UInt*  lc_edge_words;
+static Addr*  lc_edge_ptr;
+static UInt*  lc_edge_ch;
+// Set in a helper process only: the pointers found are appended here
+// instead of being pushed.
+static XArray* lc_helper_edges;
+
 
 SizeT MC_(bytes_leaked)     = 0;
 SizeT MC_(bytes_indirect)   = 0;
@@ -539,6 +558,129 @@ static SizeT MC_(bytes_heuristically_reachable)[N_LEAK_CHECK_HEURISTICS]
 static SizeT MC_(blocks_heuristically_reachable)[N_LEAK_CHECK_HEURISTICS]
                                                 = {0,0,0,0};
 
+// Page index of lc_chunks, used during a leak search to find the chunk
+// a scanned word points to.  Most scanned words are not pointers to a
+// chunk: with the index, such a word is rejected after at most two memory
+// accesses, instead of an address space lookup followed by a binary search
+// over all the chunks.
+// The address space is split in pages of LC_IDX_PAGE_SZB bytes.  For
+// each page overlapping at least one chunk, the index gives the range of
+// lc_chunks overlapping it.  The pages are grouped by 2nd level tables of
+// LC_IDX_L2_N pages, allocated only for the parts of the address space
+// containing chunks.
+#define LC_IDX_PAGE_BITS  12
+#define LC_IDX_PAGE_SZB   (1UL << LC_IDX_PAGE_BITS)
+#define LC_IDX_L2_BITS    16
+#define LC_IDX_L2_N       (1UL << LC_IDX_L2_BITS)
+// Limits on the size of the index: if the chunks are spread over more
+// of the address space, we rather do without it.  The nr of 2nd level
+// tables may be up to twice the nr of address ranges of LC_IDX_L2_N pages
+// needed to hold all the chunks' bytes, which keeps the index at well
+// under 1% of the heap size, but it is at least LC_IDX_MIN_MAX_L2.
+#define LC_IDX_MAX_L1_N   (1UL << 20)
+#define LC_IDX_MIN_MAX_L2 128
+
+typedef
+   struct {
+      UInt first;  // index in lc_chunks of the first chunk overlapping the page
+      UInt n;      // nr of chunks overlapping the page, 0 if none.
+   }
+   LC_IdxPage;
+
+// NULL if there is no index: lc_is_a_chunk_ptr then searches lc_chunks.
+static LC_IdxPage** lc_idx_l1;
+static UWord        lc_idx_l1_n;
+
+// Build the page index of the lc_n_chunks chunks in lc_chunks.  This must
+// only be called if lc_chunks does not contain overlapping blocks.
+static void lc_build_chunk_index(void)
+{
+   Int   i;
+   UWord p, p_last, n_l2, l1_prev, max_l2;
+   SizeT heap_szB;
+
+   tl_assert(lc_idx_l1 == NULL);
+   if (lc_n_chunks == 0)
+      return;
+
+   // First check the index would not be too big.
+   n_l2 = 0;
+   heap_szB = 0;
+   l1_prev = ~0UL;
+   for (i = 0; i < lc_n_chunks; i++) {
+      const MC_Chunk* ch = lc_chunks[i];
+      UWord l1 = (ch->data >> LC_IDX_PAGE_BITS) >> LC_IDX_L2_BITS;
+      UWord l1_last = ((ch->data + ch->szB + (ch->szB == 0 ? 1 : 0) - 1)
+                       >> LC_IDX_PAGE_BITS) >> LC_IDX_L2_BITS;
+      if (l1_last >= LC_IDX_MAX_L1_N)
+         return;
+      n_l2 += l1_last - l1 + (l1 == l1_prev ? 0 : 1);
+      heap_szB += ch->szB;
+      l1_prev = l1_last;
+   }
+   max_l2 = 2 * (heap_szB >> (LC_IDX_PAGE_BITS + LC_IDX_L2_BITS)) + 2;
+   if (max_l2 < LC_IDX_MIN_MAX_L2)
+      max_l2 = LC_IDX_MIN_MAX_L2;
+   if (n_l2 > max_l2) {
+      if (VG_(clo_verbosity) > 1 && !VG_(clo_xml))
+         VG_(umsg)("Blocks spread over %'lu MB, searching without an index\n",
+                   (n_l2 * LC_IDX_L2_N * LC_IDX_PAGE_SZB) >> 20);
+      return;
+   }
+   if (VG_(clo_verbosity) > 1 && !VG_(clo_xml))
+      VG_(umsg)("Indexing blocks spread over %'lu MB\n",
+                (n_l2 * LC_IDX_L2_N * LC_IDX_PAGE_SZB) >> 20);
+   lc_idx_l1_n = l1_prev + 1;
+   lc_idx_l1 = VG_(calloc)("mc.lbci.1", lc_idx_l1_n, sizeof(LC_IdxPage*));
+
+   for (i = 0; i < lc_n_chunks; i++) {
+      const MC_Chunk* ch = lc_chunks[i];
+      p_last = (ch->data + ch->szB + (ch->szB == 0 ? 1 : 0) - 1)
+               >> LC_IDX_PAGE_BITS;
+      for (p = ch->data >> LC_IDX_PAGE_BITS; p <= p_last; p++) {
+         LC_IdxPage** l2 = &lc_idx_l1[p >> LC_IDX_L2_BITS];
+         LC_IdxPage*  pg;
+         if (*l2 == NULL)
+            *l2 = VG_(calloc)("mc.lbci.2", LC_IDX_L2_N, sizeof(LC_IdxPage));
+         pg = &(*l2)[p & (LC_IDX_L2_N - 1)];
+         if (pg->n == 0)
+            pg->first = i;
+         pg->n = i - pg->first + 1;
+      }
+   }
+}
+
+static void lc_free_chunk_index(void)
+{
+   UWord l1;
+
+   if (lc_idx_l1 == NULL)
+      return;
+   for (l1 = 0; l1 < lc_idx_l1_n; l1++)
+      if (lc_idx_l1[l1] != NULL)
+         VG_(free)(lc_idx_l1[l1]);
+   VG_(free)(lc_idx_l1);
+   lc_idx_l1 = NULL;
+   lc_idx_l1_n = 0;
+}
+
+// Find the chunk containing ptr using the page index.  Return -1 if none.
+static inline Int lc_find_chunk_in_index(Addr ptr)
+{
+   const UWord  p = ptr >> LC_IDX_PAGE_BITS;
+   const UWord  l1 = p >> LC_IDX_L2_BITS;
+   const LC_IdxPage* pg;
+   Int ch_no;
+
+   if (l1 >= lc_idx_l1_n || lc_idx_l1[l1] == NULL)
+      return -1;
+   pg = &lc_idx_l1[l1][p & (LC_IDX_L2_N - 1)];
+   if (pg->n == 0)
+      return -1;
+   ch_no = find_chunk_for(ptr, lc_chunks + pg->first, pg->n);
+   return ch_no == -1 ? -1 : (Int)pg->first + ch_no;
+}
+
 // Determines if a pointer is to a chunk.  Returns the chunk number et al
 // via call-by-reference.
 static Bool
@@ -548,37 +690,42 @@ lc_is_a_chunk_ptr(Addr ptr, Int* pch_no, MC_Chunk** pch, LC_Extra** pex)
    MC_Chunk* ch;
    LC_Extra* ex;
 
-   // Quick filter. Note: implemented with am, not with get_vabits2
-   // as ptr might be random data pointing anywhere. On 64 bit
-   // platforms, getting va bits for random data can be quite costly
-   // due to the secondary map.
-   if (!VG_(am_is_valid_for_client)(ptr, 1, VKI_PROT_READ)) {
-      return False;
+   if (LIKELY(lc_idx_l1 != NULL)) {
+      // The index rejects most non pointers cheaply, so the (more costly)
+      // am check is only done for the words pointing inside a chunk.
+      ch_no = lc_find_chunk_in_index(ptr);
+      if (ch_no != -1 && !VG_(am_is_valid_for_client)(ptr, 1, VKI_PROT_READ))
+         ch_no = -1;
    } else {
+      // Quick filter. Note: implemented with am, not with get_vabits2
+      // as ptr might be random data pointing anywhere. On 64 bit
+      // platforms, getting va bits for random data can be quite costly
+      // due to the secondary map.
+      if (!VG_(am_is_valid_for_client)(ptr, 1, VKI_PROT_READ))
+         return False;
       ch_no = find_chunk_for(ptr, lc_chunks, lc_n_chunks);
-      tl_assert(ch_no >= -1 && ch_no < lc_n_chunks);
+   }
+   tl_assert(ch_no >= -1 && ch_no < lc_n_chunks);
 
-      if (ch_no == -1) {
-         return False;
-      } else {
-         // Ok, we've found a pointer to a chunk.  Get the MC_Chunk and its
-         // LC_Extra.
-         ch = lc_chunks[ch_no];
-         ex = &(lc_extras[ch_no]);
+   if (ch_no == -1)
+      return False;
 
-         tl_assert(ptr >= ch->data);
-         tl_assert(ptr < ch->data + ch->szB + (ch->szB==0  ? 1  : 0));
+   // Ok, we've found a pointer to a chunk.  Get the MC_Chunk and its
+   // LC_Extra.
+   ch = lc_chunks[ch_no];
+   ex = &(lc_extras[ch_no]);
 
-         if (VG_DEBUG_LEAKCHECK)
-            VG_(printf)("ptr=%#lx -> block %d\n", ptr, ch_no);
+   tl_assert(ptr >= ch->data);
+   tl_assert(ptr < ch->data + ch->szB + (ch->szB==0  ? 1  : 0));
 
-         *pch_no = ch_no;
-         *pch    = ch;
-         *pex    = ex;
+   if (VG_DEBUG_LEAKCHECK)
+      VG_(printf)("ptr=%#lx -> block %d\n", ptr, ch_no);
 
-         return True;
-      }
-   }
+   *pch_no = ch_no;
+   *pch    = ch;
+   *pex    = ex;
+
+   return True;
 }
 
 // Push a chunk (well, just its index) onto the mark stack.
@@ -900,19 +1047,15 @@ static LeakCheckHeuristic heuristic_reachedness (Addr ptr,
 }
 
 
-// If 'ptr' is pointing to a heap-allocated block which hasn't been seen
+// 'ptr' is pointing into block ch_no.  If the block hasn't been seen
 // before, push it onto the mark stack.
 static void
-lc_push_without_clique_if_a_chunk_ptr(Addr ptr, Bool is_prior_definite)
+lc_push_without_clique(Addr ptr, Int ch_no, Bool is_prior_definite)
 {
-   Int ch_no;
-   MC_Chunk* ch;
-   LC_Extra* ex;
+   MC_Chunk* ch = lc_chunks[ch_no];
+   LC_Extra* ex = &(lc_extras[ch_no]);
    Reachedness ch_via_ptr; // Is ch reachable via ptr, and how ?
 
-   if ( ! lc_is_a_chunk_ptr(ptr, &ch_no, &ch, &ex) )
-      return;
-
    if (ex->state == Reachable) {
       if (ex->heuristic && ptr == ch->data)
          // If block was considered reachable via an heuristic, and it is now
@@ -960,27 +1103,38 @@ lc_push_without_clique_if_a_chunk_ptr(Addr ptr, Bool is_prior_definite)
    }
 }
 
+// If 'ptr' is pointing to a heap-allocated block which hasn't been seen
+// before, push it onto the mark stack.
+static void
+lc_push_without_clique_if_a_chunk_ptr(Addr ptr, Bool is_prior_definite)
+{
+   Int ch_no;
+   MC_Chunk* ch;
+   LC_Extra* ex;
+
+   if ( ! lc_is_a_chunk_ptr(ptr, &ch_no, &ch, &ex) )
+      return;
+
+   lc_push_without_clique(ptr, ch_no, is_prior_definite);
+}
+
 static void
 lc_push_if_a_chunk_ptr_register(ThreadId tid, const HChar* regname, Addr ptr)
 {
    lc_push_without_clique_if_a_chunk_ptr(ptr, /*is_prior_definite*/True);
 }
 
-// If ptr is pointing to a heap-allocated block which hasn't been seen
-// before, push it onto the mark stack.  Clique is the index of the
-// clique leader.
+// Block ch_no is pointed to by a block of the clique.  If it hasn't
+// been seen before, push it onto the mark stack.  Clique is the index of
+// the clique leader.
 static void
-lc_push_with_clique_if_a_chunk_ptr(Addr ptr, Int clique, Int cur_clique)
+lc_push_with_clique(Int ch_no, Int clique, Int cur_clique)
 {
-   Int ch_no;
-   MC_Chunk* ch;
-   LC_Extra* ex;
+   MC_Chunk* ch = lc_chunks[ch_no];
+   LC_Extra* ex = &(lc_extras[ch_no]);
 
    tl_assert(0 <= clique && clique < lc_n_chunks);
 
-   if ( ! lc_is_a_chunk_ptr(ptr, &ch_no, &ch, &ex) )
-      return;
-
    // If it's not Unreached, it's already been handled so ignore it.
    // If ch_no==clique, it's the clique leader, which means this is a cyclic
    // structure;  again ignore it because it's already been handled.
@@ -1010,6 +1164,22 @@ lc_push_with_clique_if_a_chunk_ptr(Addr ptr, Int clique, Int cur_clique)
    }
 }
 
+// If ptr is pointing to a heap-allocated block which hasn't been seen
+// before, push it onto the mark stack.  Clique is the index of the
+// clique leader.
+static void
+lc_push_with_clique_if_a_chunk_ptr(Addr ptr, Int clique, Int cur_clique)
+{
+   Int ch_no;
+   MC_Chunk* ch;
+   LC_Extra* ex;
+
+   if ( ! lc_is_a_chunk_ptr(ptr, &ch_no, &ch, &ex) )
+      return;
+
+   lc_push_with_clique(ch_no, clique, cur_clique);
+}
+
 static void
 lc_push_if_a_chunk_ptr(Addr ptr,
                        Int clique, Int cur_clique, Bool is_prior_definite)
@@ -1020,6 +1190,95 @@ lc_push_if_a_chunk_ptr(Addr ptr,
       lc_push_with_clique_if_a_chunk_ptr(ptr, clique, cur_clique);
 }
 
+// Same as lc_push_if_a_chunk_ptr, for a ptr already known to point
+// into block ch_no.
+static void
+lc_push_chunk(Addr ptr, Int ch_no,
+              Int clique, Int cur_clique, Bool is_prior_definite)
+{
+   if (-1 == clique) 
+      lc_push_without_clique(ptr, ch_no, is_prior_definite);
+   else
+      lc_push_with_clique(ch_no, clique, cur_clique);
+}
+
+
+// A pointer found by a helper process: 'ptr' points into block ch_no.
+typedef
+   struct {
+      Addr ptr;
+      UInt ch_no;
+   }
+   LC_Edge;
+
+static void lc_helper_record_edge(Addr ptr)
+{
+   Int ch_no;
+   MC_Chunk* ch;
+   LC_Extra* ex;
+   LC_Edge e;
+
+   if ( ! lc_is_a_chunk_ptr(ptr, &ch_no, &ch, &ex) )
+      return;
+
+   e.ptr = ptr;
+   e.ch_no = ch_no;
+   VG_(addToXA)(lc_helper_edges, &e);
+}
+
+
+// With --leak-check-incremental=yes, the results of scanning memory are
+// kept from one leak search to the next, per granule of SM_SIZE bytes
+// (the memory covered by one secondary map).  For each granule, we keep
+// which words are valid for the scan, and the value of the valid words
+// which are not zero.
+// Memcheck marks the granules modified after their scan in MC_(sm_dirty).
+// Scanning memory in a granule that was not modified then only walks the
+// kept words, instead of reading the memory and its V+A bits again.
+// Because the pointer values are kept rather than the blocks they point
+// to, the kept words stay valid when blocks are freed or allocated, or
+// when memory is mapped or unmapped: whether a kept value points into a
+// readable block is checked by lc_is_a_chunk_ptr when the words are
+// replayed, as for a full scan.
+#define LC_GRANULE_WORDS (SM_SIZE / sizeof(Addr))
+#define LC_BITS_PER_UWORD (8 * sizeof(UWord))
+
+typedef
+   struct _LC_Granule {
+      struct _LC_Granule* next;
+      UWord   key;       // granule number: granule address / SM_SIZE
+      UInt    n_ptrs;    // nr of words kept in ptr_off and ptr_val
+      UShort* ptr_off;   // word offset in the granule of the kept words,
+      Addr*   ptr_val;   // and their value.  Sorted by offset.
+      UWord   valid[LC_GRANULE_WORDS / LC_BITS_PER_UWORD];
+   }
+   LC_Granule;
+
+// The granules kept, NULL if not doing incremental leak searches.
+static VgHashTable* lc_granules;
+// The granule being scanned by lc_fill_granule, NULL if none.
+static LC_Granule* lc_granule_fill;
+static UShort lc_fill_off[LC_GRANULE_WORDS];
+static Addr   lc_fill_val[LC_GRANULE_WORDS];
+// Nr of granules scanned, and nr of bytes for which a kept scan was
+// used, during the current leak search.
+static UWord lc_granules_scanned;
+static SizeT lc_granules_reused_szB;
+
+// Records in lc_granule_fill that the word at ptr, containing val, is
+// valid.  Zero is the only value that can never point into a block.
+static void lc_granule_record(Addr ptr, Addr val)
+{
+   LC_Granule* gr = lc_granule_fill;
+   const UWord w = (ptr - gr->key * SM_SIZE) / sizeof(Addr);
+
+   gr->valid[w / LC_BITS_PER_UWORD] |= (UWord)1 << (w % LC_BITS_PER_UWORD);
+   if (val != 0) {
+      lc_fill_off[gr->n_ptrs] = w;
+      lc_fill_val[gr->n_ptrs] = val;
+      gr->n_ptrs++;
+   }
+}
 
 static VG_MINIMAL_JMP_BUF(lc_scan_memory_jmpbuf);
 static
@@ -1030,7 +1289,7 @@ void lc_scan_memory_fault_catcher ( Int sigNo, Addr addr )
                               lc_scan_memory_jmpbuf);
 }
 
-// lc_scan_memory has 2 modes:
+// lc_scan_memory_direct has 2 modes:
 //
 // 1. Leak check mode (searched == 0).
 // -----------------------------------
@@ -1056,13 +1315,13 @@ void lc_scan_memory_fault_catcher ( Int sigNo, Addr addr )
 // 2. Search ptr mode (searched != 0).
 // -----------------------------------
 // In this mode, searches for pointers to a specific address range 
-// In such a case, lc_scan_memory just scans [start..start+len[ for pointers
-// to searched and outputs the places where searched is found.
+// In such a case, lc_scan_memory_direct just scans [start..start+len[ for
+// pointers to searched and outputs the places where searched is found.
 // It does not recursively scans the found memory.
 static void
-lc_scan_memory(Addr start, SizeT len, Bool is_prior_definite,
-               Int clique, Int cur_clique,
-               Addr searched, SizeT szB)
+lc_scan_memory_direct(Addr start, SizeT len, Bool is_prior_definite,
+                      Int clique, Int cur_clique,
+                      Addr searched, SizeT szB)
 {
    /* memory scan is based on the assumption that valid pointers are aligned
       on a multiple of sizeof(Addr). So, we can (and must) skip the begin and
@@ -1184,6 +1443,10 @@ lc_scan_memory(Addr start, SizeT len, Bool is_prior_definite,
                   }
                }
             }
+         } else if (UNLIKELY(lc_granule_fill)) {
+            lc_granule_record(ptr, addr);
+         } else if (UNLIKELY(lc_helper_edges)) {
+            lc_helper_record_edge(addr);
          } else {
             lc_push_if_a_chunk_ptr(addr, clique, cur_clique, is_prior_definite);
          }
@@ -1196,6 +1459,203 @@ lc_scan_memory(Addr start, SizeT len, Bool is_prior_definite,
    VG_(set_fault_catcher)(prev_catcher);
 }
 
+static void lc_free_granule(void* gr_v)
+{
+   LC_Granule* gr = gr_v;
+   if (gr->n_ptrs > 0) {
+      VG_(free)(gr->ptr_off);
+      VG_(free)(gr->ptr_val);
+   }
+   VG_(free)(gr);
+}
+
+// Scans granule g, and keeps the result in lc_granules.  Returns NULL
+// if the result of the scan cannot be kept.
+static LC_Granule* lc_fill_granule(UWord g)
+{
+   const Addr  start = g * SM_SIZE;
+   const SizeT scanned_szB = lc_scanned_szB;
+   const SizeT sig_skipped_szB = lc_sig_skipped_szB;
+   LC_Granule* gr;
+   Addr a;
+
+   // The whole granule is scanned, so we have to check it contains
+   // no device mapping (see scan_memory_root_set).
+   for (a = start; a < start + SM_SIZE; ) {
+      NSegment const* seg = VG_(am_find_nsegment)(a);
+      if (seg == NULL)
+         break;
+      if (seg->kind == SkFileC
+          && (VKI_S_ISCHR(seg->mode) || VKI_S_ISBLK(seg->mode)))
+         return NULL;
+      if (seg->end >= start + SM_SIZE - 1)
+         break;
+      a = seg->end + 1;
+   }
+
+   gr = VG_(calloc)("mc.lfg.1", 1, sizeof(LC_Granule));
+   gr->key = g;
+   lc_granule_fill = gr;
+   lc_scan_memory_direct(start, SM_SIZE, /*is_prior_definite*/True,
+                         /*clique*/-1, /*cur_clique*/-1,
+                         /*searched*/0, 0);
+   lc_granule_fill = NULL;
+   lc_scanned_szB = scanned_szB;
+   if (lc_sig_skipped_szB != sig_skipped_szB) {
+      // Read errors: let lc_scan_memory_direct report them.
+      lc_sig_skipped_szB = sig_skipped_szB;
+      lc_free_granule(gr);
+      return NULL;
+   }
+
+   if (gr->n_ptrs > 0) {
+      gr->ptr_off = VG_(malloc)("mc.lfg.2", gr->n_ptrs * sizeof(UShort));
+      gr->ptr_val = VG_(malloc)("mc.lfg.3", gr->n_ptrs * sizeof(Addr));
+      VG_(memcpy)(gr->ptr_off, lc_fill_off, gr->n_ptrs * sizeof(UShort));
+      VG_(memcpy)(gr->ptr_val, lc_fill_val, gr->n_ptrs * sizeof(Addr));
+   }
+   MC_(sm_dirty)[g] = 0;
+   VG_(HT_add_node)(lc_granules, gr);
+   lc_granules_scanned++;
+   return gr;
+}
+
+static UInt lc_count_bits(UWord w)
+{
+   UInt n = 0;
+   while (w) {
+      w &= w - 1;
+      n++;
+   }
+   return n;
+}
+
+// Does the same as lc_scan_memory_direct for the words [w_lo, w_hi[ of
+// granule gr, using the kept words.
+static void lc_replay_granule(const LC_Granule* gr, UWord w_lo, UWord w_hi,
+                              Bool is_prior_definite,
+                              Int clique, Int cur_clique)
+{
+   UWord w, lo, hi, mid;
+   UWord n_valid = 0;
+
+   for (w = w_lo; w < w_hi; ) {
+      const UWord bits = gr->valid[w / LC_BITS_PER_UWORD];
+      const UWord b = w % LC_BITS_PER_UWORD;
+      const UWord n = w_hi - w < LC_BITS_PER_UWORD - b
+                      ? w_hi - w : LC_BITS_PER_UWORD - b;
+      const UWord mask = n == LC_BITS_PER_UWORD
+                         ? ~(UWord)0 : (((UWord)1 << n) - 1) << b;
+      n_valid += lc_count_bits(bits & mask);
+      w += n;
+   }
+   lc_scanned_szB += n_valid * sizeof(Addr);
+
+   // Find the first kept word at or after w_lo.
+   lo = 0;
+   hi = gr->n_ptrs;
+   while (lo < hi) {
+      mid = (lo + hi) / 2;
+      if (gr->ptr_off[mid] < w_lo)
+         lo = mid + 1;
+      else
+         hi = mid;
+   }
+   for (; lo < gr->n_ptrs && gr->ptr_off[lo] < w_hi; lo++) {
+      if (UNLIKELY(lc_helper_edges))
+         lc_helper_record_edge(gr->ptr_val[lo]);
+      else
+         lc_push_if_a_chunk_ptr(gr->ptr_val[lo], clique, cur_clique,
+                                is_prior_definite);
+   }
+}
+
+// Same as lc_scan_memory_direct, but reusing the results of the
+// previous leak search for the granules not modified since.
+static void
+lc_scan_memory(Addr start, SizeT len, Bool is_prior_definite,
+               Int clique, Int cur_clique,
+               Addr searched, SizeT szB)
+{
+   Addr lo = VG_ROUNDUP(start, sizeof(Addr));
+   const Addr end = VG_ROUNDDN(start+len, sizeof(Addr));
+
+   if (lc_granules == NULL || searched != 0) {
+      lc_scan_memory_direct(start, len, is_prior_definite,
+                            clique, cur_clique, searched, szB);
+      return;
+   }
+
+   while (lo < end) {
+      const UWord g = lo / SM_SIZE;
+      Addr hi;
+      LC_Granule* gr;
+
+      if (g >= MC_(sm_dirty_n)) {
+         lc_scan_memory_direct(lo, end - lo, is_prior_definite,
+                               clique, cur_clique, 0, 0);
+         return;
+      }
+      hi = (g + 1) * SM_SIZE;
+      if (hi > end || hi < lo)
+         hi = end;
+
+      gr = VG_(HT_lookup)(lc_granules, g);
+      if (gr != NULL && MC_(sm_dirty)[g]) {
+         VG_(HT_remove)(lc_granules, g);
+         lc_free_granule(gr);
+         gr = NULL;
+      }
+      if (gr == NULL)
+         gr = lc_fill_granule(g);
+      else
+         lc_granules_reused_szB += hi - lo;
+
+      if (gr != NULL)
+         lc_replay_granule(gr, (lo - g * SM_SIZE) / sizeof(Addr),
+                           (hi - g * SM_SIZE) / sizeof(Addr),
+                           is_prior_definite, clique, cur_clique);
+      else
+         lc_scan_memory_direct(lo, hi - lo, is_prior_definite,
+                               clique, cur_clique, 0, 0);
+      lo = hi;
+   }
+}
+
+// Prepares lc_granules for a new leak search: forgets the granules
+// modified since the previous one.
+static void lc_prepare_granules(void)
+{
+   LC_Granule* gr;
+
+   lc_granules_scanned = 0;
+   lc_granules_reused_szB = 0;
+   if (lc_granules == NULL) {
+      lc_granules = VG_(HT_construct)("mc.lpg.1");
+      return;
+   }
+   VG_(HT_ResetIter)(lc_granules);
+   while ((gr = VG_(HT_Next)(lc_granules))) {
+      if (MC_(sm_dirty)[gr->key]) {
+         VG_(HT_remove_at_Iter)(lc_granules);
+         lc_free_granule(gr);
+      }
+   }
+}
+
+
+// Does the same as lc_scan_memory for block ch_no, using the pointers
+// recorded by the helper processes.
+static void
+lc_scan_edges(Int ch_no, Bool is_prior_definite, Int clique, Int cur_clique)
+{
+   ULong e;
+
+   lc_scanned_szB += (SizeT)lc_edge_words[ch_no] * sizeof(Addr);
+   for (e = lc_edge_first[ch_no]; e < lc_edge_first[ch_no+1]; e++)
+      lc_push_chunk(lc_edge_ptr[e], lc_edge_ch[e],
+                    clique, cur_clique, is_prior_definite);
+}
 
 // Process the mark stack until empty.
 static void lc_process_markstack(Int clique)
@@ -1209,9 +1669,254 @@ static void lc_process_markstack(Int clique)
       // See comment about 'is_prior_definite' at the top to understand this.
       is_prior_definite = ( Possible != lc_extras[top].state );
 
-      lc_scan_memory(lc_chunks[top]->data, lc_chunks[top]->szB,
-                     is_prior_definite, clique, (clique == -1 ? -1 : top),
-                     /*searched*/ 0, 0);
+      if (lc_edge_first)
+         lc_scan_edges(top, is_prior_definite,
+                       clique, (clique == -1 ? -1 : top));
+      else
+         lc_scan_memory(lc_chunks[top]->data, lc_chunks[top]->szB,
+                        is_prior_definite, clique, (clique == -1 ? -1 : top),
+                        /*searched*/ 0, 0);
+   }
+}
+
+/*------------------------------------------------------------*/
+/*--- Scanning the blocks in helper processes.             ---*/
+/*------------------------------------------------------------*/
+
+// Valgrind runs on one host thread at a time and nothing in memcheck is
+// thread-safe, so to put more than one CPU to work on a leak search we fork
+// helper processes instead.  Each helper has a copy-on-write snapshot of
+// the whole address space.  It scans its share of the blocks, recording the
+// pointers to blocks it finds, and sends them back through a pipe.  The
+// mark phases in the parent then only follow these pointers.  Every block
+// is scanned at least once by the mark phases (either when reached from the
+// root set, or when gathering cliques), so no work is wasted.  As the
+// pointers are recorded in the order a scan would have found them, the
+// result of the search is exactly the same as without helpers.
+
+typedef
+   struct {
+      UWord ok;        // False if the helper could not do its share.
+      UWord n_edges;   // Nr of LC_Edges found.
+   }
+   LC_HelperHeader;
+
+static Bool lc_write_fully(Int fd, const void* buf, SizeT szB)
+{
+   const HChar* p = buf;
+   while (szB > 0) {
+      Int n = VG_(write)(fd, p, szB > 0x40000000 ? 0x40000000 : (Int)szB);
+      if (n <= 0)
+         return False;
+      p += n;
+      szB -= n;
+   }
+   return True;
+}
+
+static Bool lc_read_fully(Int fd, void* buf, SizeT szB)
+{
+   HChar* p = buf;
+   while (szB > 0) {
+      Int n = VG_(read)(fd, p, szB > 0x40000000 ? 0x40000000 : (Int)szB);
+      if (n <= 0)
+         return False;
+      p += n;
+      szB -= n;
+   }
+   return True;
+}
+
+// Runs in a helper process: scan blocks lo .. hi-1 and write the result
+// to fd, in this order: an LC_HelperHeader, the nr of edges and the nr of
+// words scanned for each block (as UInts), the ptr of each edge, and the
+// ch_no of each edge.
+__attribute__((noreturn))
+static void lc_helper_NORETURN(Int fd, Int lo, Int hi)
+{
+   UInt* n_edges = VG_(malloc)("mc.lhN.1", (hi - lo) * sizeof(UInt));
+   UInt* n_words = VG_(malloc)("mc.lhN.2", (hi - lo) * sizeof(UInt));
+   LC_HelperHeader hdr;
+   vki_sigset_t mask;
+   Word n, j, k;
+   Int i;
+   Bool ok = True;
+
+   // Block everything but the faults lc_scan_memory catches.  In
+   // particular, if the parent gives up on us, writing to the pipe fails
+   // instead of raising SIGPIPE.
+   VG_(memset)(&mask, 0xFF, sizeof(mask));
+   VG_(sigdelset)(&mask, VKI_SIGSEGV);
+   VG_(sigdelset)(&mask, VKI_SIGBUS);
+   VG_(sigprocmask)(VKI_SIG_SETMASK, &mask, NULL);
+
+   lc_helper_edges = VG_(newXA)(VG_(malloc), "mc.lhN.3", VG_(free),
+                                sizeof(LC_Edge));
+   lc_scanned_szB = 0;
+   lc_sig_skipped_szB = 0;
+   for (i = lo; i < hi; i++) {
+      const SizeT scanned = lc_scanned_szB;
+      const Word  found   = VG_(sizeXA)(lc_helper_edges);
+
+      if (lc_chunks[i]->szB / sizeof(Addr) > 0xFFFFFFFFUL) {
+         ok = False;
+         break;
+      }
+      lc_scan_memory(lc_chunks[i]->data, lc_chunks[i]->szB,
+                     /*is_prior_definite*/True, /*clique*/-1,
+                     /*cur_clique*/-1, /*searched*/0, 0);
+      n_words[i - lo] = (lc_scanned_szB - scanned) / sizeof(Addr);
+      n_edges[i - lo] = VG_(sizeXA)(lc_helper_edges) - found;
+   }
+   // Bytes skipped due to read errors are reported per scan, which we
+   // can't reproduce: leave such searches to the parent.
+   if (lc_sig_skipped_szB > 0)
+      ok = False;
+
+   n = VG_(sizeXA)(lc_helper_edges);
+   hdr.ok      = ok;
+   hdr.n_edges = ok ? n : 0;
+   if (lc_write_fully(fd, &hdr, sizeof(hdr)) && ok
+       && lc_write_fully(fd, n_edges, (hi - lo) * sizeof(UInt))
+       && lc_write_fully(fd, n_words, (hi - lo) * sizeof(UInt))) {
+      Addr ptrs[1024];
+      UInt ch_nos[1024];
+      for (j = 0; j < n; j += k) {
+         for (k = 0; k < 1024 && j + k < n; k++)
+            ptrs[k] = ((LC_Edge*)VG_(indexXA)(lc_helper_edges, j + k))->ptr;
+         if (!lc_write_fully(fd, ptrs, k * sizeof(Addr)))
+            break;
+      }
+      for (j = 0; j < n; j += k) {
+         for (k = 0; k < 1024 && j + k < n; k++)
+            ch_nos[k] = ((LC_Edge*)VG_(indexXA)(lc_helper_edges, j + k))->ch_no;
+         if (!lc_write_fully(fd, ch_nos, k * sizeof(UInt)))
+            break;
+      }
+   }
+   VG_(exit_now)(0);
+}
+
+static void lc_free_edges(void)
+{
+   if (lc_edge_first) VG_(free)(lc_edge_first);
+   if (lc_edge_words) VG_(free)(lc_edge_words);
+   if (lc_edge_ptr)   VG_(free)(lc_edge_ptr);
+   if (lc_edge_ch)    VG_(free)(lc_edge_ch);
+   lc_edge_first = NULL;
+   lc_edge_words = NULL;
+   lc_edge_ptr   = NULL;
+   lc_edge_ch    = NULL;
+}
+
+// Fork n_helpers helper processes, each one scanning a share of the blocks
+// of roughly equal size.  Returns the nr of helpers started: their pids and
+// the read end of their pipes are in pids[] and fds[].
+static Int lc_start_helpers(Int n_helpers, Int* pids, Int* fds, Int* los)
+{
+   SizeT total_szB = 0, share_szB, cur_szB;
+   Int h, i;
+
+   for (i = 0; i < lc_n_chunks; i++)
+      total_szB += lc_chunks[i]->szB;
+   share_szB = total_szB / n_helpers + 1;
+
+   i = 0;
+   for (h = 0; h < n_helpers; h++) {
+      // Leave at least one block to each of the helpers after this one.
+      const Int max_i = lc_n_chunks - (n_helpers - 1 - h);
+      Int pipe_fds[2];
+      Int lo = i;
+      Int pid;
+
+      cur_szB = 0;
+      if (h == n_helpers - 1) {
+         i = lc_n_chunks;
+      } else {
+         while (i < max_i && (i == lo || cur_szB < share_szB))
+            cur_szB += lc_chunks[i++]->szB;
+      }
+      los[h] = lo;
+      los[h+1] = i;
+
+      if (VG_(pipe)(pipe_fds) != 0)
+         return h;
+      pid = VG_(fork)();
+      if (pid == 0) {
+         VG_(close)(pipe_fds[0]);
+         lc_helper_NORETURN(pipe_fds[1], lo, i);
+      }
+      VG_(close)(pipe_fds[1]);
+      if (pid < 0) {
+         VG_(close)(pipe_fds[0]);
+         return h;
+      }
+      pids[h] = pid;
+      fds[h] = pipe_fds[0];
+   }
+   return n_helpers;
+}
+
+// Collect the results of the n_started helpers started by
+// lc_start_helpers, and wait for them.  If all n_helpers were started and
+// all did their share, set up lc_edge_* from their results.
+static void lc_finish_helpers(Int n_helpers, Int n_started,
+                              const Int* pids, const Int* fds, const Int* los)
+{
+   Bool ok = n_started == n_helpers;
+   ULong n_edges = 0;
+   Int h, i, status;
+
+   if (ok) {
+      lc_edge_first = VG_(malloc)("mc.lfh.1",
+                                  (lc_n_chunks + 1) * sizeof(ULong));
+      lc_edge_words = VG_(malloc)("mc.lfh.2", lc_n_chunks * sizeof(UInt));
+      lc_edge_ptr   = VG_(malloc)("mc.lfh.3", sizeof(Addr));
+      lc_edge_ch    = VG_(malloc)("mc.lfh.4", sizeof(UInt));
+   }
+
+   for (h = 0; h < n_started; h++) {
+      const Int lo = los[h], hi = los[h+1];
+      LC_HelperHeader hdr;
+
+      if (ok && lc_read_fully(fds[h], &hdr, sizeof(hdr)) && hdr.ok) {
+         UInt* counts = VG_(malloc)("mc.lfh.5", (hi - lo) * sizeof(UInt));
+         ok = lc_read_fully(fds[h], counts, (hi - lo) * sizeof(UInt))
+              && lc_read_fully(fds[h], &lc_edge_words[lo],
+                               (hi - lo) * sizeof(UInt));
+         if (ok) {
+            const ULong first = n_edges;
+            for (i = lo; i < hi; i++) {
+               lc_edge_first[i] = n_edges;
+               n_edges += counts[i - lo];
+            }
+            tl_assert(n_edges - first == hdr.n_edges);
+            lc_edge_ptr = VG_(realloc)("mc.lfh.3", lc_edge_ptr,
+                                       (n_edges + 1) * sizeof(Addr));
+            lc_edge_ch  = VG_(realloc)("mc.lfh.4", lc_edge_ch,
+                                       (n_edges + 1) * sizeof(UInt));
+            ok = lc_read_fully(fds[h], &lc_edge_ptr[first],
+                               hdr.n_edges * sizeof(Addr))
+                 && lc_read_fully(fds[h], &lc_edge_ch[first],
+                                  hdr.n_edges * sizeof(UInt));
+         }
+         VG_(free)(counts);
+      } else {
+         ok = False;
+      }
+      VG_(close)(fds[h]);
+      VG_(waitpid)(pids[h], &status, 0);
+   }
+
+   if (ok) {
+      lc_edge_first[lc_n_chunks] = n_edges;
+      if (VG_(clo_verbosity) > 1 && !VG_(clo_xml))
+         VG_(umsg)("Leak check helpers: %d processes scanned %'d blocks\n",
+                   n_helpers, lc_n_chunks);
+   } else {
+      lc_free_edges();
+      if (VG_(clo_verbosity) > 1 && !VG_(clo_xml))
+         VG_(umsg)("Leak check helpers failed, scanning without them\n");
    }
 }
 
@@ -2019,6 +2724,11 @@ static MC_Mempool *find_mp_of_chunk (MC_Chunk* mc_search)
 void MC_(detect_memory_leaks) ( ThreadId tid, LeakCheckParams* lcp)
 {
    Int i, j;
+   Int n_helpers, n_started = 0;
+   Int helper_pids[MAX_LEAK_CHECK_HELPERS];
+   Int helper_fds[MAX_LEAK_CHECK_HELPERS];
+   Int helper_los[MAX_LEAK_CHECK_HELPERS + 1];
+   Bool chunks_overlap = False;
    
    tl_assert(lcp->mode != LC_Off);
 
@@ -2156,6 +2866,7 @@ void MC_(detect_memory_leaks) ( ThreadId tid, LeakCheckParams* lcp)
             VG_(umsg)("VALGRIND_MALLOCLIKE_BLOCK in an inappropriate way.\n");
             tl_assert (0);
          }
+         chunks_overlap = True;
       }
    }
 
@@ -2185,6 +2896,24 @@ void MC_(detect_memory_leaks) ( ThreadId tid, LeakCheckParams* lcp)
                  lc_n_chunks );
    }
 
+   // Index the chunks, to speed up finding the chunk a word points to.
+   // The index cannot represent overlapping (metapool) blocks.
+   if (!chunks_overlap)
+      lc_build_chunk_index();
+
+   if (MC_(sm_dirty) != NULL)
+      lc_prepare_granules();
+
+   // Start the helpers, if any: they scan the blocks while we scan the
+   // root-set.  Incremental searches rescan too little to need them.
+   n_helpers = MC_(clo_leak_check_helpers) < lc_n_chunks
+               ? MC_(clo_leak_check_helpers) : lc_n_chunks;
+   if (lc_granules != NULL)
+      n_helpers = 0;
+   if (n_helpers > 0)
+      n_started = lc_start_helpers(n_helpers, helper_pids, helper_fds,
+                                   helper_los);
+
    // Scan the memory root-set, pushing onto the mark stack any blocks
    // pointed to.
    scan_memory_root_set(/*searched*/0, 0);
@@ -2192,6 +2921,10 @@ void MC_(detect_memory_leaks) ( ThreadId tid, LeakCheckParams* lcp)
    // Scan GP registers for chunk pointers.
    VG_(apply_to_GP_regs)(lc_push_if_a_chunk_ptr_register);
 
+   if (n_helpers > 0)
+      lc_finish_helpers(n_helpers, n_started, helper_pids, helper_fds,
+                        helper_los);
+
    // Process the pushed blocks.  After this, every block that is reachable
    // from the root-set has been traced.
    lc_process_markstack(/*clique*/-1);
@@ -2234,6 +2967,15 @@ void MC_(detect_memory_leaks) ( ThreadId tid, LeakCheckParams* lcp)
       }
    }
 
+   lc_free_edges();
+   lc_free_chunk_index();
+
+   if (lc_granules != NULL && VG_(clo_verbosity) > 1 && !VG_(clo_xml)) {
+      VG_(umsg)("Rescanned %'lu bytes, reused the scan of %'lu bytes\n",
+                lc_granules_scanned * SM_SIZE, lc_granules_reused_szB);
+      VG_(umsg)( "\n" );
+   }
+
    print_results( tid, lcp);
 
    VG_(free) ( lc_markstack );
@@ -45,6 +45,7 @@
 #include "pub_tool_replacemalloc.h"
 #include "pub_tool_tooliface.h"
 #include "pub_tool_threadstate.h"
+#include "pub_tool_vki.h"         // VKI_PAGE_SIZE
 #include "pub_tool_xarray.h"
 #include "pub_tool_xtree.h"
 #include "pub_tool_xtmemory.h"
@@ -292,27 +293,102 @@ typedef
 
 static SecMap sm_distinguished[3];
 
-static INLINE Bool is_distinguished_sm ( SecMap* sm ) {
+// With --dedup-secmaps=yes, secondary maps found to have identical
+// contents are replaced by a single shared copy (see dedup_secmaps).
+// Like the distinguished ones, shared secondaries may never be modified.
+// They all live in the sm_shared array, so that checking whether a
+// secondary is writable stays cheap.  sm_shared_refs[i] is the nr of
+// primary map entries pointing at sm_shared[i]; free slots have 0 refs
+// and are kept in sm_shared_free.
+static SecMap* sm_shared       = NULL;
+static UWord   sm_shared_szB   = 0;
+static UInt*   sm_shared_refs  = NULL;
+static UInt*   sm_shared_free  = NULL;
+static UInt    sm_shared_nfree = 0;
+
+static INLINE Bool is_shared_sm ( const SecMap* sm ) {
+   return (UWord)((Addr)sm - (Addr)sm_shared) < sm_shared_szB;
+}
+
+/* One of the three distinguished secondaries, all of whose bytes have
+   the same V+A bits.  Unlike shared ones, which can hold any contents. */
+static INLINE Bool is_uniform_sm ( const SecMap* sm ) {
    return sm >= &sm_distinguished[0] && sm <= &sm_distinguished[2];
 }
 
+/* Distinguished or shared, i.e. read-only. */
+static INLINE Bool is_distinguished_sm ( SecMap* sm ) {
+   return is_uniform_sm(sm) || is_shared_sm(sm);
+}
+
 // Forward declaration
 static void update_SM_counts(SecMap* oldSM, SecMap* newSM);
 
-/* dist_sm points to one of our three distinguished secondaries.  Make
-   a copy of it so that we can write to it.
+/* With --shadow-huge-pages=yes, secondaries are carved out of arenas
+   backed by transparent huge pages, so that the shadow of a big heap
+   needs few TLB entries.  A freed secondary is kept for reuse in
+   sm_arena_free, linked through its first word: unlike with small
+   pages, the memory of freed secondaries is never unmapped. */
+#define SM_ARENA_SZB (16 * VG_HUGEPAGE_SZB)
+STATIC_ASSERT(SM_ARENA_SZB % sizeof(SecMap) == 0);
+
+static Addr    sm_arena_next  = 0;
+static Addr    sm_arena_end   = 0;
+static SecMap* sm_arena_free  = NULL;
+static Int     n_sm_arenas    = 0;
+static Int     n_sm_arena_free = 0;
+
+static SecMap* alloc_secmap ( void )
+{
+   SecMap* sm;
+
+   if (!MC_(clo_shadow_huge_pages)) {
+      sm = VG_(am_shadow_alloc)(sizeof(SecMap));
+      if (sm == NULL)
+         VG_(out_of_memory_NORETURN)( "memcheck:allocate new SecMap",
+                                      sizeof(SecMap) );
+      return sm;
+   }
+   if (sm_arena_free != NULL) {
+      sm = sm_arena_free;
+      sm_arena_free = *(SecMap**)sm;
+      n_sm_arena_free--;
+      return sm;
+   }
+   if (sm_arena_next == sm_arena_end) {
+      sm_arena_next = (Addr)VG_(am_shadow_alloc_huge)(SM_ARENA_SZB);
+      if (sm_arena_next == 0)
+         VG_(out_of_memory_NORETURN)( "memcheck:allocate SecMap arena",
+                                      SM_ARENA_SZB );
+      sm_arena_end = sm_arena_next + SM_ARENA_SZB;
+      n_sm_arenas++;
+   }
+   sm = (SecMap*)sm_arena_next;
+   sm_arena_next += sizeof(SecMap);
+   return sm;
+}
+
+static void free_secmap ( SecMap* sm )
+{
+   if (!MC_(clo_shadow_huge_pages)) {
+      SysRes sres = VG_(am_munmap_valgrind)((Addr)sm, sizeof(SecMap));
+      tl_assert2(! sr_isError(sres), "SecMap valgrind munmap failure\n");
+      return;
+   }
+   *(SecMap**)sm = sm_arena_free;
+   sm_arena_free = sm;
+   n_sm_arena_free++;
+}
+
+/* dist_sm points to one of our three distinguished secondaries, or to
+   a shared one.  Make a copy of it so that we can write to it.
 */
 static SecMap* copy_for_writing ( SecMap* dist_sm )
 {
    SecMap* new_sm;
-   tl_assert(dist_sm == &sm_distinguished[0]
-          || dist_sm == &sm_distinguished[1]
-          || dist_sm == &sm_distinguished[2]);
-
-   new_sm = VG_(am_shadow_alloc)(sizeof(SecMap));
-   if (new_sm == NULL)
-      VG_(out_of_memory_NORETURN)( "memcheck:allocate new SecMap",
-                                   sizeof(SecMap) );
+   tl_assert(is_distinguished_sm(dist_sm));
+
+   new_sm = alloc_secmap();
    VG_(memcpy)(new_sm, dist_sm, sizeof(SecMap));
    update_SM_counts(dist_sm, new_sm);
    return new_sm;
@@ -345,24 +421,58 @@ static Int   n_sanity_expensive = 0;
 static Int   n_secVBit_nodes   = 0;
 static Int   max_secVBit_nodes = 0;
 
+/* # of shared SMs in use, and # of primary map entries pointing to them.
+   The difference is the nr of SMs saved by the sharing. */
+static Int   n_shared_SMs      = 0;
+static Int   n_shared_refs     = 0;
+static Int   max_shared_SMs    = 0;
+static Int   max_SMs_saved     = 0;
+static Int   n_dedup_passes    = 0;
+static Int   n_dedup_to_DSM    = 0; // # SMs found equal to a DSM
+static Int   n_dedup_unshared  = 0; // # copies of a shared SM made for writing
+
+/* Also maintains the reference counts of the shared SMs: a shared SM
+   no longer referenced goes back to the free slots. */
 static void update_SM_counts(SecMap* oldSM, SecMap* newSM)
 {
    if      (oldSM == &sm_distinguished[SM_DIST_NOACCESS ]) n_noaccess_SMs --;
    else if (oldSM == &sm_distinguished[SM_DIST_UNDEFINED]) n_undefined_SMs--;
    else if (oldSM == &sm_distinguished[SM_DIST_DEFINED  ]) n_defined_SMs  --;
+   else if (is_shared_sm(oldSM)) {
+      UInt slot = oldSM - sm_shared;
+      tl_assert(sm_shared_refs[slot] > 0);
+      n_shared_refs--;
+      if (--sm_shared_refs[slot] == 0) {
+         sm_shared_free[sm_shared_nfree++] = slot;
+         n_shared_SMs--;
+      }
+   }
    else                                                  { n_non_DSM_SMs  --;
                                                            n_deissued_SMs ++; }
 
    if      (newSM == &sm_distinguished[SM_DIST_NOACCESS ]) n_noaccess_SMs ++;
    else if (newSM == &sm_distinguished[SM_DIST_UNDEFINED]) n_undefined_SMs++;
    else if (newSM == &sm_distinguished[SM_DIST_DEFINED  ]) n_defined_SMs  ++;
+   else if (is_shared_sm(newSM)) {
+      /* The slot was taken from the free slots by alloc_shared_sm. */
+      UInt slot = newSM - sm_shared;
+      if (sm_shared_refs[slot]++ == 0)
+         n_shared_SMs++;
+      n_shared_refs++;
+   }
    else                                                  { n_non_DSM_SMs  ++;
                                                            n_issued_SMs   ++; }
 
+   if (is_shared_sm(oldSM) && !is_distinguished_sm(newSM))
+      n_dedup_unshared++;
+
    if (n_noaccess_SMs  > max_noaccess_SMs ) max_noaccess_SMs  = n_noaccess_SMs;
    if (n_undefined_SMs > max_undefined_SMs) max_undefined_SMs = n_undefined_SMs;
    if (n_defined_SMs   > max_defined_SMs  ) max_defined_SMs   = n_defined_SMs;
    if (n_non_DSM_SMs   > max_non_DSM_SMs  ) max_non_DSM_SMs   = n_non_DSM_SMs;
+   if (n_shared_SMs    > max_shared_SMs   ) max_shared_SMs    = n_shared_SMs;
+   if (n_shared_refs - n_shared_SMs > max_SMs_saved)
+      max_SMs_saved = n_shared_refs - n_shared_SMs;
 }
 
 /* --------------- Primary maps --------------- */
@@ -373,7 +483,8 @@ static void update_SM_counts(SecMap* oldSM, SecMap* newSM)
 */
 #if ENABLE_ASSEMBLY_HELPERS && defined(PERF_FAST_LOADV) \
     && (defined(VGP_arm_linux) \
-        || defined(VGP_x86_linux) || defined(VGP_x86_solaris) || defined(VGP_x86_freebsd))
+        || defined(VGP_x86_linux) || defined(VGP_x86_solaris) || defined(VGP_x86_freebsd) \
+        || defined(VGP_amd64_linux) || defined(VGP_amd64_freebsd))
 /* mc_main_asm.c needs visibility on a few things declared in this file.
    MC_MAIN_STATIC allows to define them static if ok, i.e. on
    platforms that are not using hand-coded asm statements. */
@@ -650,9 +761,41 @@ static INLINE SecMap* get_secmap_for_reading_high ( Addr a )
    return *get_secmap_high_ptr(a);
 }
 
+/* --------------- Dirty secondary maps --------------- */
+
+/* With --leak-check-incremental=yes, MC_(sm_dirty)[i] is set whenever
+   the contents or the V+A bits of the memory covered by primary_map[i]
+   may have changed.  The leak checker uses this to rescan only the
+   memory changed since the previous leak search.  Memory above
+   MAX_PRIMARY_ADDRESS is not tracked, and always rescanned.
+   NULL when not tracking. */
+UChar* MC_(sm_dirty)   = NULL;
+UWord  MC_(sm_dirty_n) = 0;
+
+static INLINE void mark_sm_dirty_low ( Addr a )
+{
+   if (UNLIKELY(MC_(sm_dirty) != NULL))
+      MC_(sm_dirty)[get_primary_map_low_offset(a)] = 1;
+}
+
+static void mark_sm_dirty_range ( Addr a, SizeT len )
+{
+   Addr last;
+
+   if (LIKELY(MC_(sm_dirty) == NULL) || len == 0 || a > MAX_PRIMARY_ADDRESS)
+      return;
+   last = a + len - 1;
+   if (last > MAX_PRIMARY_ADDRESS || last < a)
+      last = MAX_PRIMARY_ADDRESS;
+   VG_(memset)(&MC_(sm_dirty)[get_primary_map_low_offset(a)], 1,
+               get_primary_map_low_offset(last)
+               - get_primary_map_low_offset(a) + 1);
+}
+
 static INLINE SecMap* get_secmap_for_writing_low(Addr a)
 {
    SecMap** p = get_secmap_low_ptr(a);
+   mark_sm_dirty_low(a);
    if (UNLIKELY(is_distinguished_sm(*p)))
       *p = copy_for_writing(*p);
    return *p;
@@ -706,6 +849,185 @@ static SecMap* maybe_get_secmap_for ( Addr a )
    }
 }
 
+/* --------------- Sharing identical secondary maps --------------- */
+
+/* Big heaps often have many secondaries with identical contents, e.g.
+   arrays of structs with padding or with some uninitialised fields.
+   With --dedup-secmaps=yes, dedup_secmaps hashes all the private
+   secondaries, and replaces those having identical contents by a single
+   read-only copy in sm_shared (or by a distinguished secondary, if
+   equal to one).  The first write to a shared secondary makes a
+   private copy again, via copy_for_writing.
+
+   Tools cannot run work in the background, so the pass runs at the
+   start of a thread's time slice, when no secondary map pointers are
+   held.  It runs when the nr of private secondaries has grown by half
+   the nr of secondaries in use (private or shared) after the previous
+   pass, so that its cost stays proportional to the secondaries
+   allocated. */
+
+/* Max nr of shared secondaries.  The slots only use memory once
+   touched. */
+#if VG_WORDSIZE == 8
+#  define N_SHARED_SMS  16384
+#else
+#  define N_SHARED_SMS  1024
+#endif
+
+/* Don't bother running a pass for fewer private secondaries. */
+#define DEDUP_MIN_SMS  64
+
+static Int dedup_next_at = DEDUP_MIN_SMS;
+
+typedef
+   struct {
+      VgHashNode* next;
+      UWord       key;    // hash of *sm
+      SecMap*     sm;
+      SecMap**    owner;  // primary map entry of sm if private, else NULL
+   }
+   DedupNode;
+
+static void init_shared_SMs ( void )
+{
+   UInt i;
+
+   if (MC_(clo_shadow_huge_pages))
+      sm_shared = VG_(am_shadow_alloc_huge)(N_SHARED_SMS * sizeof(SecMap));
+   else
+      sm_shared = VG_(am_shadow_alloc)(N_SHARED_SMS * sizeof(SecMap));
+   if (sm_shared == NULL)
+      VG_(out_of_memory_NORETURN)( "memcheck:allocate shared SecMaps",
+                                   N_SHARED_SMS * sizeof(SecMap) );
+   sm_shared_szB  = N_SHARED_SMS * sizeof(SecMap);
+   sm_shared_refs = VG_(calloc)("mc.iss.1", N_SHARED_SMS, sizeof(UInt));
+   sm_shared_free = VG_(malloc)("mc.iss.2", N_SHARED_SMS * sizeof(UInt));
+   /* Hand out the lowest slots first. */
+   for (i = 0; i < N_SHARED_SMS; i++)
+      sm_shared_free[i] = N_SHARED_SMS - 1 - i;
+   sm_shared_nfree = N_SHARED_SMS;
+}
+
+/* Returns a free shared secondary, or NULL if all are in use.  Its
+   reference count is raised by update_SM_counts when it is installed. */
+static SecMap* alloc_shared_sm ( void )
+{
+   if (sm_shared_nfree == 0)
+      return NULL;
+   return &sm_shared[sm_shared_free[--sm_shared_nfree]];
+}
+
+static UWord hash_secmap ( const SecMap* sm )
+{
+#  if VG_WORDSIZE == 8
+   const UWord mult = 0x9E3779B97F4A7C15ULL;
+#  else
+   const UWord mult = 0x9E3779B9;
+#  endif
+   const UWord* w = (const UWord*)sm;
+   UWord h = 0;
+   UWord i;
+
+   for (i = 0; i < sizeof(SecMap) / sizeof(UWord); i++)
+      h = (h + w[i]) * mult;
+   return h ^ (h >> (4 * sizeof(UWord)));
+}
+
+static void dedup_add_node ( VgHashTable* ht, SecMap* sm, SecMap** owner )
+{
+   DedupNode* n = VG_(malloc)("mc.dan.1", sizeof(DedupNode));
+   n->key   = hash_secmap(sm);
+   n->sm    = sm;
+   n->owner = owner;
+   VG_(HT_add_node)(ht, n);
+}
+
+/* Make *owner point to new_sm, which has the same contents, and free
+   the private secondary *owner was pointing to. */
+static void dedup_replace ( SecMap** owner, SecMap* new_sm )
+{
+   SecMap* old_sm = *owner;
+
+   tl_assert(!is_distinguished_sm(old_sm));
+   update_SM_counts(old_sm, new_sm);
+   *owner = new_sm;
+   free_secmap(old_sm);
+}
+
+static void dedup_one_sm ( VgHashTable* ht, SecMap** owner )
+{
+   SecMap*    sm = *owner;
+   DedupNode* n;
+
+   if (is_distinguished_sm(sm))
+      return;
+
+   n = VG_(HT_lookup)(ht, hash_secmap(sm));
+   if (n == NULL) {
+      dedup_add_node(ht, sm, owner);
+      return;
+   }
+   // A hash collision: just keep this one private.
+   if (VG_(memcmp)(n->sm, sm, sizeof(SecMap)) != 0)
+      return;
+
+   if (n->owner != NULL) {
+      // First duplicate of a private secondary: both will share a copy.
+      SecMap* shared = alloc_shared_sm();
+      if (shared == NULL)
+         return;
+      VG_(memcpy)(shared, n->sm, sizeof(SecMap));
+      dedup_replace(n->owner, shared);
+      n->sm    = shared;
+      n->owner = NULL;
+   } else if (!is_shared_sm(n->sm)) {
+      n_dedup_to_DSM++;
+   }
+   dedup_replace(owner, n->sm);
+}
+
+static void dedup_secmaps ( void )
+{
+   VgHashTable* ht;
+   AuxMapEnt*   elem;
+   UWord        i;
+   Int          n_private_before = n_non_DSM_SMs;
+
+   n_dedup_passes++;
+   ht = VG_(HT_construct)("mc.ds.1");
+
+   /* Secondaries equal to an existing read-only one join it. */
+   for (i = 0; i < 3; i++)
+      dedup_add_node(ht, &sm_distinguished[i], NULL);
+   for (i = 0; i < N_SHARED_SMS; i++)
+      if (sm_shared_refs[i] > 0)
+         dedup_add_node(ht, &sm_shared[i], NULL);
+
+   for (i = 0; i < N_PRIMARY_MAP; i++)
+      dedup_one_sm(ht, &primary_map[i]);
+   VG_(OSetGen_ResetIter)(auxmap_L2);
+   while ( (elem = VG_(OSetGen_Next)(auxmap_L2)) )
+      dedup_one_sm(ht, &elem->sm);
+
+   VG_(HT_destruct)(ht, VG_(free));
+
+   dedup_next_at = n_non_DSM_SMs
+                   + VG_MAX(DEDUP_MIN_SMS, (n_non_DSM_SMs + n_shared_refs) / 2);
+
+   if (VG_(clo_verbosity) > 2)
+      VG_(message)(Vg_DebugMsg,
+                   "memcheck: dedup pass %d: %d private SMs -> %d, "
+                   "%d shared SMs used by %d entries\n",
+                   n_dedup_passes, n_private_before, n_non_DSM_SMs,
+                   n_shared_SMs, n_shared_refs);
+}
+
+static void mc_start_client_code ( ThreadId tid, ULong bbs_done )
+{
+   if (UNLIKELY(n_non_DSM_SMs >= dedup_next_at))
+      dedup_secmaps();
+}
+
 /* --------------- Fundamental functions --------------- */
 
 static INLINE
@@ -1225,6 +1547,8 @@ static Bool modify_ignore_ranges ( Bool addRange, Addr start, Addr len )
    if (len == 0) {
       return False;
    }
+   /* The leak checker skips ignored ranges. */
+   mark_sm_dirty_range(start, len);
    if (addRange) {
       VG_(bindRangeMap)(gIgnoredAddressRanges,
                         start, start+len-1, IAR_ClientReq);
@@ -1576,6 +1900,8 @@ void mc_STOREVn_slow ( Addr a, SizeT nBits, ULong vbytes, Bool bigendian )
 
    PROF_EVENT(MCPE_STOREVN_SLOW);
 
+   mark_sm_dirty_range(a, szB);
+
    /* ------------ BEGIN semi-fast cases ------------ */
    /* These deal quickly-ish with the common auxiliary primary map
       cases on 64-bit platforms.  Are merely a speedup hack; can be
@@ -1688,6 +2014,8 @@ static void set_address_range_perms ( Addr a, SizeT lenT, UWord vabits16,
    if (lenT == 0)
       return;
 
+   mark_sm_dirty_range(a, lenT);
+
    if (lenT > 256 * 1024 * 1024) {
       if (VG_(clo_verbosity) > 0 && !VG_(clo_xml)) {
          const HChar* s = "unknown???";
@@ -1801,14 +2129,14 @@ static void set_address_range_perms ( Addr a, SizeT lenT, UWord vabits16,
       a    += 1;
       lenA -= 1;
    }
-   // 8-aligned, 8 byte steps
-   while (True) {
-      if (lenA < 8) break;
+   // 8-aligned, 8 byte steps, done at once
+   if (lenA >= 8) {
       PROF_EVENT(MCPE_SET_ADDRESS_RANGE_PERMS_LOOP8A);
       sm_off16 = SM_OFF_16(a);
-      sm->vabits16[sm_off16] = vabits16;
-      a    += 8;
-      lenA -= 8;
+      VG_(memset)(&sm->vabits16[sm_off16], vabits16 & 0xFF,
+                  (lenA / 8) * sizeof(UShort));
+      a    += lenA & ~(SizeT)7;
+      lenA &= 7;
    }
    // 1 byte steps
    while (True) {
@@ -1840,8 +2168,7 @@ static void set_address_range_perms ( Addr a, SizeT lenT, UWord vabits16,
          PROF_EVENT(MCPE_SET_ADDRESS_RANGE_PERMS_LOOP64K_FREE_DIST_SM);
          // Free the non-distinguished sec-map that we're replacing.  This
          // case happens moderately often, enough to be worthwhile.
-         SysRes sres = VG_(am_munmap_valgrind)((Addr)*sm_ptr, sizeof(SecMap));
-         tl_assert2(! sr_isError(sres), "SecMap valgrind munmap failure\n");
+         free_secmap(*sm_ptr);
       }
       update_SM_counts(*sm_ptr, example_dsm);
       // Make the sec-map entry point to the example DSM
@@ -1874,14 +2201,14 @@ static void set_address_range_perms ( Addr a, SizeT lenT, UWord vabits16,
    }
    sm = *sm_ptr;
 
-   // 8-aligned, 8 byte steps
-   while (True) {
-      if (lenB < 8) break;
+   // 8-aligned, 8 byte steps, done at once
+   if (lenB >= 8) {
       PROF_EVENT(MCPE_SET_ADDRESS_RANGE_PERMS_LOOP8B);
       sm_off16 = SM_OFF_16(a);
-      sm->vabits16[sm_off16] = vabits16;
-      a    += 8;
-      lenB -= 8;
+      VG_(memset)(&sm->vabits16[sm_off16], vabits16 & 0xFF,
+                  (lenB / 8) * sizeof(UShort));
+      a    += lenB & ~(SizeT)7;
+      lenB &= 7;
    }
    // 1 byte steps
    while (True) {
@@ -2023,28 +2350,36 @@ void MC_(copy_address_range_state) ( Addr src, Addr dst, SizeT len )
    if (nooverlap && aligned) {
 
       /* Vectorised fast case, when no overlap and suitably aligned */
-      /* vector loop */
+      /* vector loop: copies the vabits8 up to the end of the src or dst
+         sec-map at once. */
       i = 0;
       while (len >= 4) {
-         vabits8 = get_vabits8_for_aligned_word32( src+i );
-         set_vabits8_for_aligned_word32( dst+i, vabits8 );
-         if (LIKELY(VA_BITS8_DEFINED == vabits8
-                            || VA_BITS8_UNDEFINED == vabits8
-                            || VA_BITS8_NOACCESS == vabits8)) {
-            /* do nothing */
-         } else {
-            /* have to copy secondary map info */
-            if (VA_BITS2_PARTDEFINED == get_vabits2( src+i+0 ))
-               set_sec_vbits8( dst+i+0, get_sec_vbits8( src+i+0 ) );
-            if (VA_BITS2_PARTDEFINED == get_vabits2( src+i+1 ))
-               set_sec_vbits8( dst+i+1, get_sec_vbits8( src+i+1 ) );
-            if (VA_BITS2_PARTDEFINED == get_vabits2( src+i+2 ))
-               set_sec_vbits8( dst+i+2, get_sec_vbits8( src+i+2 ) );
-            if (VA_BITS2_PARTDEFINED == get_vabits2( src+i+3 ))
-               set_sec_vbits8( dst+i+3, get_sec_vbits8( src+i+3 ) );
+         const SecMap* src_sm  = get_secmap_for_reading( src+i );
+         SecMap*       dst_sm  = get_secmap_for_writing( dst+i );
+         const UWord   src_off = SM_OFF( src+i );
+         const UWord   dst_off = SM_OFF( dst+i );
+         SizeT n = SM_CHUNKS - (src_off > dst_off ? src_off : dst_off);
+         SizeT k;
+
+         if (n > len / 4)
+            n = len / 4;
+         VG_(memcpy)( &dst_sm->vabits8[dst_off], &src_sm->vabits8[src_off],
+                      n );
+         for (k = 0; k < n; k++) {
+            vabits8 = src_sm->vabits8[src_off + k];
+            if (LIKELY((vabits8 & (vabits8 >> 1) & 0x55) == 0)) {
+               /* no partially defined byte: do nothing */
+            } else {
+               /* have to copy secondary map info */
+               for (j = 0; j < 4; j++) {
+                  if (VA_BITS2_PARTDEFINED == get_vabits2( src+i+4*k+j ))
+                     set_sec_vbits8( dst+i+4*k+j,
+                                     get_sec_vbits8( src+i+4*k+j ) );
+               }
+            }
          }
-         i += 4;
-         len -= 4;
+         i += 4 * n;
+         len -= 4 * n;
       }
       /* fixup loop */
       while (len >= 1) {
@@ -2181,10 +2516,11 @@ void MC_(copy_address_range_state) ( Addr src, Addr dst, SizeT len )
    zeroes to be installed.  However, ejecting a line containing
    nonzeroes risks losing origin information permanently.  In order to
    prevent such lossage, ejected nonzero lines are placed in a
-   secondary cache (ocacheL2), which is an OSet (AVL tree) of cache
-   lines.  This can grow arbitrarily large, and so should ensure that
-   Memcheck runs out of memory in preference to losing useful origin
-   info due to cache size limitations.
+   secondary cache (ocacheL2), which is a hash table of cache lines.
+   This can grow arbitrarily large, and so should ensure that Memcheck
+   runs out of memory in preference to losing useful origin info due to
+   cache size limitations.  ocacheL1 starts small, and grows when too
+   many references miss it.
 
    Shadowing registers is a bit tricky, because the shadow values are
    32 bits, regardless of the size of the register.  That gives a
@@ -2406,11 +2742,15 @@ static UWord stats_ocacheL1_misses         = 0;
 static UWord stats_ocacheL1_lossage        = 0;
 static UWord stats_ocacheL1_movefwds       = 0;
 
+static UWord stats_ocacheL1_resizes        = 0;
+
 static UWord stats__ocacheL2_finds         = 0;
 static UWord stats__ocacheL2_adds          = 0;
 static UWord stats__ocacheL2_dels          = 0;
 static UWord stats__ocacheL2_misses        = 0;
 static UWord stats__ocacheL2_n_nodes_max   = 0;
+static UWord stats__ocacheL2_probes        = 0;
+static UWord stats__ocacheL2_resizes       = 0;
 
 /* Cache of 32-bit values, one every 32 bits of address space */
 
@@ -2426,13 +2766,24 @@ static INLINE Bool is_valid_oc_tag ( Addr tag ) {
 
 #define OC_LINES_PER_SET 2
 
-#define OC_N_SET_BITS    20
-#define OC_N_SETS        (1 << OC_N_SET_BITS)
-
-/* These settings give:
+/* ocacheL1 starts with 2^OC_MIN_SET_BITS sets.  It is checked every
+   OC_RESIZE_CHECK_MISSES misses, and made 4 times bigger, up to
+   2^OC_MAX_SET_BITS sets, when more than 1 in OC_MISS_RATIO_TO_GROW
+   references since the previous check missed a line that ocacheL2 then
+   supplied.  Misses on lines that were never cached (typically fresh
+   heap memory) would not go away with a bigger L1, so they don't count.
+   With 2^20 sets:
    64 bit host: ocache:  100,663,296 sizeB    67,108,864 useful
    32 bit host: ocache:   92,274,688 sizeB    67,108,864 useful
 */
+#define OC_MIN_SET_BITS  18
+#if VG_WORDSIZE == 8
+#  define OC_MAX_SET_BITS  22
+#else
+#  define OC_MAX_SET_BITS  20
+#endif
+#define OC_MISS_RATIO_TO_GROW   32
+#define OC_RESIZE_CHECK_MISSES  (1 << 20)
 
 #define OC_MOVE_FORWARDS_EVERY_BITS 7
 
@@ -2528,32 +2879,42 @@ typedef
    }
    OCacheSet;
 
-typedef
-   struct {
-      OCacheSet set[OC_N_SETS];
-   }
-   OCache;
+/* ocacheL1 is an array of ocacheL1_n_sets sets. */
+static OCacheSet* ocacheL1 = NULL;
+static UWord      ocacheL1_n_sets = 0;
+static UWord      ocacheL1_event_ctr = 0;
+
+/* Refs, L1 misses and L2 misses at the last check for resizing
+   ocacheL1. */
+static UWord      ocacheL1_check_refs = 0;
+static UWord      ocacheL1_check_misses = 0;
+static UWord      ocacheL1_check_L2_misses = 0;
 
-static OCache* ocacheL1 = NULL;
-static UWord   ocacheL1_event_ctr = 0;
+static OCacheSet* alloc_ocacheL1 ( UWord n_sets )
+{
+   OCacheSet* sets;
+   UWord      line, set;
+   SizeT      szB = n_sets * sizeof(OCacheSet);
+
+   sets = VG_(am_shadow_alloc)(szB);
+   if (sets == NULL)
+      VG_(out_of_memory_NORETURN)( "memcheck:allocating ocacheL1", szB );
+   for (set = 0; set < n_sets; set++) {
+      for (line = 0; line < OC_LINES_PER_SET; line++) {
+         sets[set].line[line].tag = 1/*invalid*/;
+      }
+   }
+   return sets;
+}
 
 static void init_ocacheL2 ( void ); /* fwds */
 static void init_OCache ( void )
 {
-   UWord line, set;
    tl_assert(MC_(clo_mc_level) >= 3);
    tl_assert(ocacheL1 == NULL);
-   ocacheL1 = VG_(am_shadow_alloc)(sizeof(OCache));
-   if (ocacheL1 == NULL) {
-      VG_(out_of_memory_NORETURN)( "memcheck:allocating ocacheL1",
-                                   sizeof(OCache) );
-   }
+   ocacheL1_n_sets = 1 << OC_MIN_SET_BITS;
+   ocacheL1 = alloc_ocacheL1(ocacheL1_n_sets);
    tl_assert(ocacheL1 != NULL);
-   for (set = 0; set < OC_N_SETS; set++) {
-      for (line = 0; line < OC_LINES_PER_SET; line++) {
-         ocacheL1->set[set].line[line].tag = 1/*invalid*/;
-      }
-   }
    init_ocacheL2();
 }
 
@@ -2591,105 +2952,232 @@ static inline void zeroise_OCacheLine ( OCacheLine* line, Addr tag ) {
 //////////////////////////////////////////////////////////////
 //// OCache backing store
 
-// The backing store for ocacheL1 is, conceptually, an AVL tree of lines that
-// got ejected from the L1 (a "victim cache"), and which actually contain
-// useful info -- that is, for which classify_OCacheLine would return 'n' and
-// no other value.  However, the tree can grow large, and searching/updating
-// it can be hot paths.  Hence we "take out" 12 significant bits of the key by
-// having 4096 trees, and select one using HASH_OCACHE_TAG.
-//
-// What that hash function returns isn't important so long as it is a pure
-// function of the tag values, and is < 4096.  However, it is critical for
-// performance of long SARPs.  Hence the extra shift of 11 bits.  This means
-// each tree conceptually is assigned to contiguous sequences of 2048 lines in
-// the "line address space", giving some locality of reference when scanning
-// linearly through address space, as is done by a SARP.  Changing that 11 to
-// 0 gives terrible performance on long SARPs, presumably because each new
-// line is in a different tree, hence we wind up thrashing the (CPU's) caches.
-//
-// On 32-bit targets, we have to be a bit careful not to shift out so many
-// bits that not all 2^12 trees get used.  That leads to the constraint
-// (OC_BITS_PER_LINE + 11 + 12) < 32.  Note that the 11 is the only thing we
-// can change here.  In this case we have OC_BITS_PER_LINE == 5, hence the
-// inequality is (28 < 32) and so we're good.
+// The backing store for ocacheL1 holds the lines that got ejected from the
+// L1 (a "victim cache"), and which actually contain useful info -- that is,
+// for which classify_OCacheLine would return 'n' and no other value.  It
+// can grow large, and searching/updating it can be hot paths.  Hence it is
+// an open-addressed hash table with linear probing, in shadow memory,
+// doubled in size when half full.  Free slots have the invalid tag 1.
+// Deleting a line moves back the lines following it in the same probe
+// sequence, so that there is no need for tombstones.
 //
-// The value 11 was determined empirically from various Firefox runs.  10 or
-// 12 also work pretty well.
-
-static OSet* ocachesL2[4096];
+// The hash function keeps runs of 2^OC_L2_RUN_BITS consecutive lines in
+// consecutive slots, and scatters the runs over the table.  This gives
+// some locality of reference when scanning linearly through address
+// space, as is done by a SARP, while keeping the probe sequences short.
+
+#define OC_L2_MIN_SLOT_BITS  16
+#define OC_L2_RUN_BITS        2
+
+/* The tags of the lines are kept apart from the lines themselves, so
+   that probing, which mostly fails, looks at few cache lines.  A free
+   slot has an invalid tag. */
+static Addr*       ocacheL2_tags = NULL;
+static OCacheLine* ocacheL2 = NULL;
+static UWord       ocacheL2_n_slots = 0;
+
+/* Stats: # lines currently in the table */
+static UWord stats__ocacheL2_n_nodes = 0;
 
-STATIC_ASSERT((OC_BITS_PER_LINE + 11 + 12) < 32);
-static inline UInt HASH_OCACHE_TAG ( Addr tag ) {
-   return (UInt)((tag >> (OC_BITS_PER_LINE + 11)) & 0xFFF);
+static inline UWord ocacheL2_hash ( Addr tag )
+{
+#  if VG_WORDSIZE == 8
+   const UWord mult = 0x9E3779B97F4A7C15ULL;
+#  else
+   const UWord mult = 0x9E3779B9;
+#  endif
+   UWord lineno = tag >> OC_BITS_PER_LINE;
+   UWord run    = (lineno >> OC_L2_RUN_BITS) * mult;
+   run ^= run >> (4 * sizeof(UWord));
+   return ((run << OC_L2_RUN_BITS)
+           | (lineno & ((1 << OC_L2_RUN_BITS) - 1)))
+          & (ocacheL2_n_slots - 1);
 }
 
-static void* ocacheL2_malloc ( const HChar* cc, SizeT szB ) {
-   return VG_(malloc)(cc, szB);
-}
-static void ocacheL2_free ( void* v ) {
-   VG_(free)( v );
-}
+static void alloc_ocacheL2 ( UWord n_slots )
+{
+   UWord i;
+   SizeT szB = n_slots * (sizeof(Addr) + sizeof(OCacheLine));
 
-/* Stats: # nodes currently in tree */
-static UWord stats__ocacheL2_n_nodes = 0;
+   ocacheL2_tags = VG_(am_shadow_alloc)(szB);
+   if (ocacheL2_tags == NULL)
+      VG_(out_of_memory_NORETURN)( "memcheck:allocating ocacheL2", szB );
+   ocacheL2 = (OCacheLine*)&ocacheL2_tags[n_slots];
+   ocacheL2_n_slots = n_slots;
+   for (i = 0; i < n_slots; i++)
+      ocacheL2_tags[i] = 1/*invalid*/;
+}
 
 static void init_ocacheL2 ( void )
 {
    tl_assert(sizeof(Word) == sizeof(Addr)); /* since OCacheLine.tag :: Addr */
-   tl_assert(0 == offsetof(OCacheLine,tag));
-   for (UInt i = 0; i < 4096; i++) {
-      tl_assert(!ocachesL2[i]);
-      ocachesL2[i]
-         = VG_(OSetGen_Create)( offsetof(OCacheLine,tag),
-                                NULL, /* fast cmp */
-                                ocacheL2_malloc, "mc.ioL2", ocacheL2_free);
-   }
+   tl_assert(ocacheL2 == NULL);
+   alloc_ocacheL2(1 << OC_L2_MIN_SLOT_BITS);
    stats__ocacheL2_n_nodes = 0;
 }
 
-/* Find line with the given tag in the tree, or NULL if not found. */
+/* Return the slot holding the given tag, or else the free slot ending
+   its probe sequence. */
+static inline UWord ocacheL2_find_slot ( Addr tag )
+{
+   UWord i = ocacheL2_hash(tag);
+   while (True) {
+      stats__ocacheL2_probes++;
+      if (ocacheL2_tags[i] == tag || ocacheL2_tags[i] == 1/*invalid*/)
+         return i;
+      i = (i + 1) & (ocacheL2_n_slots - 1);
+   }
+}
+
+/* Double the size of the table. */
+static void ocacheL2_grow ( void )
+{
+   Addr*       old_tags    = ocacheL2_tags;
+   OCacheLine* old_slots   = ocacheL2;
+   UWord       old_n_slots = ocacheL2_n_slots;
+   UWord       i;
+   SysRes      sres;
+
+   stats__ocacheL2_resizes++;
+   alloc_ocacheL2(2 * old_n_slots);
+   for (i = 0; i < old_n_slots; i++) {
+      if (old_tags[i] != 1/*invalid*/) {
+         UWord j = ocacheL2_find_slot(old_tags[i]);
+         ocacheL2_tags[j] = old_tags[i];
+         ocacheL2[j]      = old_slots[i];
+      }
+   }
+   sres = VG_(am_munmap_valgrind)((Addr)old_tags,
+                                  old_n_slots
+                                  * (sizeof(Addr) + sizeof(OCacheLine)));
+   tl_assert2(! sr_isError(sres), "ocacheL2 valgrind munmap failure\n");
+}
+
+/* Find line with the given tag in the table, or NULL if not found. */
 static inline OCacheLine* ocacheL2_find_tag ( Addr tag )
 {
-   OCacheLine* line;
+   UWord i;
    tl_assert(is_valid_oc_tag(tag));
    stats__ocacheL2_finds++;
-   OSet* oset = ocachesL2[HASH_OCACHE_TAG(tag)];
-   line = VG_(OSetGen_Lookup)( oset, &tag );
-   return line;
+   i = ocacheL2_find_slot(tag);
+   return ocacheL2_tags[i] == tag ? &ocacheL2[i] : NULL;
 }
 
-/* Delete the line with the given tag from the tree, if it is present, and
-   free up the associated memory. */
+/* Delete the line with the given tag from the table, if it is present. */
 static void ocacheL2_del_tag ( Addr tag )
 {
-   OCacheLine* line;
+   UWord       i, j, k;
+   const UWord mask = ocacheL2_n_slots - 1;
+
    tl_assert(is_valid_oc_tag(tag));
    stats__ocacheL2_dels++;
-   OSet* oset = ocachesL2[HASH_OCACHE_TAG(tag)];
-   line = VG_(OSetGen_Remove)( oset, &tag );
-   if (line) {
-      VG_(OSetGen_FreeNode)(oset, line);
-      tl_assert(stats__ocacheL2_n_nodes > 0);
-      stats__ocacheL2_n_nodes--;
+   i = ocacheL2_find_slot(tag);
+   if (ocacheL2_tags[i] != tag)
+      return;
+
+   /* Free slot i, moving back the lines after it that could not be found
+      anymore once it is free. */
+   j = i;
+   while (True) {
+      j = (j + 1) & mask;
+      if (ocacheL2_tags[j] == 1/*invalid*/)
+         break;
+      /* The line in j can stay if its home k is cyclically in (i, j]. */
+      k = ocacheL2_hash(ocacheL2_tags[j]);
+      if (i <= j ? (i < k && k <= j) : (i < k || k <= j))
+         continue;
+      ocacheL2_tags[i] = ocacheL2_tags[j];
+      ocacheL2[i]      = ocacheL2[j];
+      i = j;
    }
+   ocacheL2_tags[i] = 1/*invalid*/;
+   tl_assert(stats__ocacheL2_n_nodes > 0);
+   stats__ocacheL2_n_nodes--;
 }
 
-/* Add a copy of the given line to the tree.  It must not already be
-   present. */
-static void ocacheL2_add_line ( OCacheLine* line )
+/* Store a copy of the given line in the table, replacing the line with
+   the same tag if there is one. */
+static void ocacheL2_put_line ( OCacheLine* line )
 {
-   OCacheLine* copy;
+   UWord i;
    tl_assert(is_valid_oc_tag(line->tag));
-   OSet* oset = ocachesL2[HASH_OCACHE_TAG(line->tag)];
-   copy = VG_(OSetGen_AllocNode)( oset, sizeof(OCacheLine) );
-   *copy = *line;
+   i = ocacheL2_find_slot(line->tag);
+   if (ocacheL2_tags[i] == line->tag) {
+      ocacheL2[i] = *line;
+      return;
+   }
+   if (2 * (stats__ocacheL2_n_nodes + 1) > ocacheL2_n_slots) {
+      ocacheL2_grow();
+      i = ocacheL2_find_slot(line->tag);
+   }
+   ocacheL2_tags[i] = line->tag;
+   ocacheL2[i]      = *line;
    stats__ocacheL2_adds++;
-   VG_(OSetGen_Insert)( oset, copy );
    stats__ocacheL2_n_nodes++;
    if (stats__ocacheL2_n_nodes > stats__ocacheL2_n_nodes_max)
       stats__ocacheL2_n_nodes_max = stats__ocacheL2_n_nodes;
 }
 
+/* Update the backing store with a line ejected from ocacheL1. */
+static void ocacheL1_eject_line ( OCacheLine* victim )
+{
+   switch (classify_OCacheLine(victim)) {
+      case 'e':
+         /* the line is empty (has invalid tag); ignore it. */
+         break;
+      case 'z':
+         /* line contains zeroes.  We must ensure the backing store is
+            updated accordingly, either by copying the line there
+            verbatim, or by ensuring it isn't present there.  We
+            choose the latter on the basis that it reduces the size of
+            the backing store. */
+         ocacheL2_del_tag( victim->tag );
+         break;
+      case 'n':
+         /* line contains at least one real, useful origin.  Copy it
+            to the backing store. */
+         stats_ocacheL1_lossage++;
+         ocacheL2_put_line( victim );
+         break;
+      default:
+         tl_assert(0);
+   }
+}
+
+/* Make ocacheL1 4 times bigger if too many references since the last
+   check missed it but hit in ocacheL2.  The lines of the old L1 go to
+   the backing store, from where they get reloaded on demand. */
+static void ocacheL1_maybe_grow ( void )
+{
+   UWord      refs       = stats_ocacheL1_find - ocacheL1_check_refs;
+   UWord      reloads    = (stats_ocacheL1_misses - ocacheL1_check_misses)
+                            - (stats__ocacheL2_misses
+                               - ocacheL1_check_L2_misses);
+   OCacheSet* old_sets   = ocacheL1;
+   UWord      old_n_sets = ocacheL1_n_sets;
+   UWord      line, set;
+   SysRes     sres;
+
+   ocacheL1_check_refs   = stats_ocacheL1_find;
+   ocacheL1_check_misses = stats_ocacheL1_misses;
+   ocacheL1_check_L2_misses = stats__ocacheL2_misses;
+   if (reloads * OC_MISS_RATIO_TO_GROW <= refs
+       || old_n_sets >= (1 << OC_MAX_SET_BITS))
+      return;
+
+   stats_ocacheL1_resizes++;
+   for (set = 0; set < old_n_sets; set++) {
+      for (line = 0; line < OC_LINES_PER_SET; line++) {
+         ocacheL1_eject_line( &old_sets[set].line[line] );
+      }
+   }
+   ocacheL1_n_sets = 4 * old_n_sets;
+   ocacheL1 = alloc_ocacheL1(ocacheL1_n_sets);
+   sres = VG_(am_munmap_valgrind)((Addr)old_sets,
+                                  old_n_sets * sizeof(OCacheSet));
+   tl_assert2(! sr_isError(sres), "ocacheL1 valgrind munmap failure\n");
+}
+
 ////
 //////////////////////////////////////////////////////////////
 
@@ -2697,16 +3185,15 @@ __attribute__((noinline))
 static OCacheLine* find_OCacheLine_SLOW ( Addr a )
 {
    OCacheLine *victim, *inL2;
-   UChar c;
    UWord line;
-   UWord setno   = (a >> OC_BITS_PER_LINE) & (OC_N_SETS - 1);
+   UWord setno   = (a >> OC_BITS_PER_LINE) & (ocacheL1_n_sets - 1);
    UWord tagmask = ~((1 << OC_BITS_PER_LINE) - 1);
    UWord tag     = a & tagmask;
-   tl_assert(setno >= 0 && setno < OC_N_SETS);
+   tl_assert(setno >= 0 && setno < ocacheL1_n_sets);
 
    /* we already tried line == 0; skip therefore. */
    for (line = 1; line < OC_LINES_PER_SET; line++) {
-      if (ocacheL1->set[setno].line[line].tag == tag) {
+      if (ocacheL1[setno].line[line].tag == tag) {
          if (line == 1) {
             stats_ocacheL1_found_at_1++;
          } else {
@@ -2714,49 +3201,28 @@ static OCacheLine* find_OCacheLine_SLOW ( Addr a )
          }
          if (UNLIKELY(0 == (ocacheL1_event_ctr++
                             & ((1<<OC_MOVE_FORWARDS_EVERY_BITS)-1)))) {
-            moveLineForwards( &ocacheL1->set[setno], line );
+            moveLineForwards( &ocacheL1[setno], line );
             line--;
          }
-         return &ocacheL1->set[setno].line[line];
+         return &ocacheL1[setno].line[line];
       }
    }
 
    /* A miss.  Use the last slot.  Implicitly this means we're
       ejecting the line in the last slot. */
    stats_ocacheL1_misses++;
+   if (UNLIKELY(stats_ocacheL1_misses - ocacheL1_check_misses
+                >= OC_RESIZE_CHECK_MISSES)) {
+      ocacheL1_maybe_grow();
+      setno = (a >> OC_BITS_PER_LINE) & (ocacheL1_n_sets - 1);
+   }
    tl_assert(line == OC_LINES_PER_SET);
    line--;
    tl_assert(line > 0);
 
    /* First, move the to-be-ejected line to the L2 cache. */
-   victim = &ocacheL1->set[setno].line[line];
-   c = classify_OCacheLine(victim);
-   switch (c) {
-      case 'e':
-         /* the line is empty (has invalid tag); ignore it. */
-         break;
-      case 'z':
-         /* line contains zeroes.  We must ensure the backing store is
-            updated accordingly, either by copying the line there
-            verbatim, or by ensuring it isn't present there.  We
-            choose the latter on the basis that it reduces the size of
-            the backing store. */
-         ocacheL2_del_tag( victim->tag );
-         break;
-      case 'n':
-         /* line contains at least one real, useful origin.  Copy it
-            to the backing store. */
-         stats_ocacheL1_lossage++;
-         inL2 = ocacheL2_find_tag( victim->tag );
-         if (inL2) {
-            *inL2 = *victim;
-         } else {
-            ocacheL2_add_line( victim );
-         }
-         break;
-      default:
-         tl_assert(0);
-   }
+   victim = &ocacheL1[setno].line[line];
+   ocacheL1_eject_line(victim);
 
    /* Now we must reload the L1 cache from the backing tree, if
       possible. */
@@ -2764,36 +3230,36 @@ static OCacheLine* find_OCacheLine_SLOW ( Addr a )
    inL2 = ocacheL2_find_tag( tag );
    if (inL2) {
       /* We're in luck.  It's in the L2. */
-      ocacheL1->set[setno].line[line] = *inL2;
+      ocacheL1[setno].line[line] = *inL2;
    } else {
       /* Missed at both levels of the cache hierarchy.  We have to
          declare it as full of zeroes (unknown origins). */
       stats__ocacheL2_misses++;
-      zeroise_OCacheLine( &ocacheL1->set[setno].line[line], tag );
+      zeroise_OCacheLine( &ocacheL1[setno].line[line], tag );
    }
 
    /* Move it one forwards */
-   moveLineForwards( &ocacheL1->set[setno], line );
+   moveLineForwards( &ocacheL1[setno], line );
    line--;
 
-   return &ocacheL1->set[setno].line[line];
+   return &ocacheL1[setno].line[line];
 }
 
 static INLINE OCacheLine* find_OCacheLine ( Addr a )
 {
-   UWord setno   = (a >> OC_BITS_PER_LINE) & (OC_N_SETS - 1);
+   UWord setno   = (a >> OC_BITS_PER_LINE) & (ocacheL1_n_sets - 1);
    UWord tagmask = ~((1 << OC_BITS_PER_LINE) - 1);
    UWord tag     = a & tagmask;
 
    stats_ocacheL1_find++;
 
    if (OC_ENABLE_ASSERTIONS) {
-      tl_assert(setno >= 0 && setno < OC_N_SETS);
+      tl_assert(setno >= 0 && setno < ocacheL1_n_sets);
       tl_assert(0 == (tag & (4 * OC_W32S_PER_LINE - 1)));
    }
 
-   if (LIKELY(ocacheL1->set[setno].line[0].tag == tag)) {
-      return &ocacheL1->set[setno].line[0];
+   if (LIKELY(ocacheL1[setno].line[0].tag == tag)) {
+      return &ocacheL1[setno].line[0];
    }
 
    return find_OCacheLine_SLOW( a );
@@ -4227,6 +4693,72 @@ typedef
    MC_ReadResult;
 
 
+/* Returns the offset from a of the first byte of [a .. a+len) whose V+A
+   bits are (if equal) or are not (if !equal) vabits2, or len if there is
+   no such byte.  When possible, looks at a whole distinguished sec-map
+   or at a whole word of V+A bits at once, rather than at each byte. */
+static INLINE
+SizeT find_vabits2 ( Addr a, SizeT len, UWord vabits2, Bool equal )
+{
+   const UWord lows    = ~(UWord)0 / 3;     // low bit of each 2-bit field
+   const UWord pattern = vabits2 * lows;    // vabits2 in each 2-bit field
+   const SizeT step    = 4 * sizeof(UWord); // memory described by a UWord
+   SizeT i = 0;
+
+   while (i < len) {
+      const Addr   ai = a + i;
+      SecMap*      sm;
+      const UWord* words;
+      UWord        j, n;
+
+      if ((ai & (step - 1)) != 0 || len - i < step) {
+         if ((get_vabits2(ai) == vabits2) == equal)
+            return i;
+         i++;
+         continue;
+      }
+
+      sm = get_secmap_for_reading(ai);
+      n  = SM_SIZE - (ai & SM_MASK);      // nr of bytes till the next sec-map
+      if (is_uniform_sm(sm)) {
+         // All the bytes covered by sm have the same V+A bits.
+         if ((sm->vabits8[0] == (UChar)pattern) == equal)
+            return i;
+         i += n < len - i ? n : len - i;
+         continue;
+      }
+
+      n /= step;
+      if (n > (len - i) / step)
+         n = (len - i) / step;
+      words = (const UWord*)&sm->vabits8[SM_OFF(ai)];
+      j = 0;
+      if (!equal) {
+         // The common case is a long run of identical V+A bits, so check
+         // 4 words at once.
+         for (; j + 4 <= n; j += 4) {
+            if (((words[j]   ^ pattern) | (words[j+1] ^ pattern)
+                 | (words[j+2] ^ pattern) | (words[j+3] ^ pattern)) != 0)
+               break;
+         }
+      }
+      for (; j < n; j++) {
+         // x has 00 in the fields equal to vabits2.
+         const UWord x = words[j] ^ pattern;
+         if (equal ? (~(x | (x >> 1)) & lows) != 0 : x != 0)
+            break;
+      }
+      i += j * step;
+      if (j < n) {
+         // The byte we look for is described by words[j].
+         while ((get_vabits2(a + i) == vabits2) != equal)
+            i++;
+         return i;
+      }
+   }
+   return len;
+}
+
 /* Check permissions for address range.  If inadequate permissions
    exist, *bad_addr is set to the offending address, so the caller can
    know what it is. */
@@ -4238,17 +4770,12 @@ typedef
 Bool MC_(check_mem_is_noaccess) ( Addr a, SizeT len, Addr* bad_addr )
 {
    SizeT i;
-   UWord vabits2;
 
    PROF_EVENT(MCPE_CHECK_MEM_IS_NOACCESS);
-   for (i = 0; i < len; i++) {
-      PROF_EVENT(MCPE_CHECK_MEM_IS_NOACCESS_LOOP);
-      vabits2 = get_vabits2(a);
-      if (VA_BITS2_NOACCESS != vabits2) {
-         if (bad_addr != NULL) *bad_addr = a;
-         return False;
-      }
-      a++;
+   i = find_vabits2(a, len, VA_BITS2_NOACCESS, /*equal*/False);
+   if (i < len) {
+      if (bad_addr != NULL) *bad_addr = a + i;
+      return False;
    }
    return True;
 }
@@ -4257,17 +4784,12 @@ static Bool is_mem_addressable ( Addr a, SizeT len,
                                  /*OUT*/Addr* bad_addr )
 {
    SizeT i;
-   UWord vabits2;
 
    PROF_EVENT(MCPE_IS_MEM_ADDRESSABLE);
-   for (i = 0; i < len; i++) {
-      PROF_EVENT(MCPE_IS_MEM_ADDRESSABLE_LOOP);
-      vabits2 = get_vabits2(a);
-      if (VA_BITS2_NOACCESS == vabits2) {
-         if (bad_addr != NULL) *bad_addr = a;
-         return False;
-      }
-      a++;
+   i = find_vabits2(a, len, VA_BITS2_NOACCESS, /*equal*/True);
+   if (i < len) {
+      if (bad_addr != NULL) *bad_addr = a + i;
+      return False;
    }
    return True;
 }
@@ -4284,29 +4806,33 @@ static MC_ReadResult is_mem_defined ( Addr a, SizeT len,
 
    if (otag)     *otag = 0;
    if (bad_addr) *bad_addr = 0;
-   for (i = 0; i < len; i++) {
-      PROF_EVENT(MCPE_IS_MEM_DEFINED_LOOP);
-      vabits2 = get_vabits2(a);
-      if (VA_BITS2_DEFINED != vabits2) {
-         // Error!  Nb: Report addressability errors in preference to
-         // definedness errors.  And don't report definedeness errors unless
-         // --undef-value-errors=yes.
-         if (bad_addr) {
-            *bad_addr = a;
-         }
-         if (VA_BITS2_NOACCESS == vabits2) {
-            return MC_AddrErr;
-         }
-         if (MC_(clo_mc_level) >= 2) {
-            if (otag && MC_(clo_mc_level) == 3) {
-               *otag = MC_(helperc_b_load1)( a );
-            }
-            return MC_ValueErr;
-         }
-      }
-      a++;
+   if (MC_(clo_mc_level) < 2) {
+      // Don't report definedness errors unless --undef-value-errors=yes,
+      // so only unaddressable bytes matter.
+      i = find_vabits2(a, len, VA_BITS2_NOACCESS, /*equal*/True);
+      if (i == len)
+         return MC_Ok;
+      if (bad_addr) *bad_addr = a + i;
+      return MC_AddrErr;
+   }
+
+   i = find_vabits2(a, len, VA_BITS2_DEFINED, /*equal*/False);
+   if (i == len)
+      return MC_Ok;
+   // Error!  Nb: Report addressability errors in preference to
+   // definedness errors.
+   a += i;
+   vabits2 = get_vabits2(a);
+   if (bad_addr) {
+      *bad_addr = a;
+   }
+   if (VA_BITS2_NOACCESS == vabits2) {
+      return MC_AddrErr;
    }
-   return MC_Ok;
+   if (otag && MC_(clo_mc_level) == 3) {
+      *otag = MC_(helperc_b_load1)( a );
+   }
+   return MC_ValueErr;
 }
 
 
@@ -4330,42 +4856,33 @@ static void is_mem_defined_comprehensive (
 {
    SizeT i;
    UWord vabits2;
-   Bool  already_saw_errV = False;
 
    PROF_EVENT(MCPE_IS_MEM_DEFINED_COMPREHENSIVE);
    DEBUG("is_mem_defined_comprehensive\n");
 
    tl_assert(!(*errorV || *errorA));
 
-   for (i = 0; i < len; i++) {
-      PROF_EVENT(MCPE_IS_MEM_DEFINED_COMPREHENSIVE_LOOP);
-      vabits2 = get_vabits2(a);
-      switch (vabits2) {
-         case VA_BITS2_DEFINED:
-            a++;
-            break;
-         case VA_BITS2_UNDEFINED:
-         case VA_BITS2_PARTDEFINED:
-            if (!already_saw_errV) {
-               *errorV    = True;
-               *bad_addrV = a;
-               if (MC_(clo_mc_level) == 3) {
-                  *otagV = MC_(helperc_b_load1)( a );
-               } else {
-                  *otagV = 0;
-               }
-               already_saw_errV = True;
-            }
-            a++; /* keep going */
-            break;
-         case VA_BITS2_NOACCESS:
-            *errorA    = True;
-            *bad_addrA = a;
-            return; /* give up now. */
-         default:
-            tl_assert(0);
+   i = find_vabits2(a, len, VA_BITS2_DEFINED, /*equal*/False);
+   if (i == len)
+      return;
+   vabits2 = get_vabits2(a + i);
+   if (VA_BITS2_NOACCESS != vabits2) {
+      // Undefined or partially defined: note the first such byte, and
+      // keep going.
+      *errorV    = True;
+      *bad_addrV = a + i;
+      if (MC_(clo_mc_level) == 3) {
+         *otagV = MC_(helperc_b_load1)( a + i );
+      } else {
+         *otagV = 0;
       }
+      i++;
+      i += find_vabits2(a + i, len - i, VA_BITS2_NOACCESS, /*equal*/True);
+      if (i == len)
+         return;
    }
+   *errorA    = True;
+   *bad_addrA = a + i;
 }
 
 
@@ -4559,6 +5076,8 @@ void mc_new_mem_mmap ( Addr a, SizeT len, Bool rr, Bool ww, Bool xx,
 static
 void mc_new_mem_mprotect ( Addr a, SizeT len, Bool rr, Bool ww, Bool xx )
 {
+   /* The leak checker skips unreadable pages. */
+   mark_sm_dirty_range(a, len);
    if (rr || ww || xx) {
       /* (4) mprotect other  ->  change any "noaccess" to "defined" */
       make_mem_defined_if_noaccess(a, len);
@@ -4800,6 +5319,13 @@ static void mc_copy_reg_to_mem ( CorePart part, ThreadId tid,
 
 STATIC_ASSERT(SM_CHUNKS * 4 == 65536);
 
+/* The amd64 128 and 256 bit helpers index the primary map with a >> 16
+   and check a >> MC_PRIMARY_MAP_ADDR_BITS is zero. */
+STATIC_ASSERT(SM_SIZE == 1 << 16);
+#if VG_WORDSIZE == 8
+STATIC_ASSERT(MC_PRIMARY_MAP_ADDR_BITS == 16 + N_PRIMARY_BITS);
+#endif
+
 STATIC_ASSERT(VA_BITS8_DEFINED   == 0xAA);
 STATIC_ASSERT(VA_BITS8_UNDEFINED == 0x55);
 
@@ -4965,19 +5491,43 @@ VG_REGPARM(2) void MC_(helperc_LOADV256be) ( /*OUT*/V256* res, Addr a )
 {
    mc_LOADV_128_or_256(&res->w64[0], a, 256, True);
 }
-VG_REGPARM(2) void MC_(helperc_LOADV256le) ( /*OUT*/V256* res, Addr a )
+VG_REGPARM(2) void MC_(helperc_LOADV128be) ( /*OUT*/V128* res, Addr a )
 {
-   mc_LOADV_128_or_256(&res->w64[0], a, 256, False);
+   mc_LOADV_128_or_256(&res->w64[0], a, 128, True);
 }
 
-VG_REGPARM(2) void MC_(helperc_LOADV128be) ( /*OUT*/V128* res, Addr a )
+// Non-generic assembly for amd64-{linux,freebsd}
+#if ENABLE_ASSEMBLY_HELPERS && defined(PERF_FAST_LOADV) \
+    && (defined(VGP_amd64_linux) || defined(VGP_amd64_freebsd))
+/* See mc_main_asm.c.  The hand-written helpers only handle an aligned
+   load whose shadow is all defined or all undefined, and jump here for
+   everything else. */
+MC_MAIN_STATIC
+__attribute__((noinline))
+__attribute__((used))
+void mc_LOADV_128_or_256le_fallback ( /*OUT*/ULong* res,
+                                      Addr a, SizeT nBits );
+
+MC_MAIN_STATIC
+__attribute__((noinline))
+__attribute__((used))
+void mc_LOADV_128_or_256le_fallback ( /*OUT*/ULong* res,
+                                      Addr a, SizeT nBits )
 {
-   mc_LOADV_128_or_256(&res->w64[0], a, 128, True);
+   mc_LOADV_128_or_256(res, a, nBits, False);
+}
+
+#else
+// Generic for all platforms except amd64-{linux,freebsd}
+VG_REGPARM(2) void MC_(helperc_LOADV256le) ( /*OUT*/V256* res, Addr a )
+{
+   mc_LOADV_128_or_256(&res->w64[0], a, 256, False);
 }
 VG_REGPARM(2) void MC_(helperc_LOADV128le) ( /*OUT*/V128* res, Addr a )
 {
    mc_LOADV_128_or_256(&res->w64[0], a, 128, False);
 }
+#endif
 
 /*------------------------------------------------------------*/
 /*--- LOADV64                                              ---*/
@@ -5067,6 +5617,8 @@ void mc_STOREV64 ( Addr a, ULong vbits64, Bool isBigEndian )
          return;
       }
 
+      mark_sm_dirty_low(a);
+
       sm       = get_secmap_for_reading_low(a);
       sm_off16 = SM_OFF_16(a);
       vabits16 = sm->vabits16[sm_off16];
@@ -5113,6 +5665,101 @@ VG_REGPARM(1) void MC_(helperc_STOREV64le) ( Addr a, ULong vbits64 )
    mc_STOREV64(a, vbits64, False);
 }
 
+/*------------------------------------------------------------*/
+/*--- STOREV256 and STOREV128                              ---*/
+/*------------------------------------------------------------*/
+
+/* Little-endian 128 and 256 bit stores on 64-bit hosts.  The V bits
+   arrive as 64-bit lanes, least significant first, so that storing a
+   vector costs a single helper call instead of one STOREV64 per lane.
+   The lane-by-lane versions are also where the hand-written helpers in
+   mc_main_asm.c go when their fast case does not apply. */
+
+MC_MAIN_STATIC
+__attribute__((noinline))
+__attribute__((used))
+void mc_STOREV128le_lanes ( Addr a, ULong q0, ULong q1 );
+
+MC_MAIN_STATIC
+__attribute__((noinline))
+__attribute__((used))
+void mc_STOREV128le_lanes ( Addr a, ULong q0, ULong q1 )
+{
+   PROF_EVENT(MCPE_STOREV_128_OR_256_SLOW);
+   mc_STOREV64(a,     q0, False);
+   mc_STOREV64(a + 8, q1, False);
+}
+
+MC_MAIN_STATIC
+__attribute__((noinline))
+__attribute__((used))
+void mc_STOREV256le_lanes ( Addr a, ULong q0, ULong q1, ULong q2, ULong q3 );
+
+MC_MAIN_STATIC
+__attribute__((noinline))
+__attribute__((used))
+void mc_STOREV256le_lanes ( Addr a, ULong q0, ULong q1, ULong q2, ULong q3 )
+{
+   PROF_EVENT(MCPE_STOREV_128_OR_256_SLOW);
+   mc_STOREV64(a,      q0, False);
+   mc_STOREV64(a + 8,  q1, False);
+   mc_STOREV64(a + 16, q2, False);
+   mc_STOREV64(a + 24, q3, False);
+}
+
+/* Is the naturally aligned nBits at 'a' already all defined, so that
+   storing defined V bits there changes nothing?  The 2 or 4 vabits16
+   covering it are adjacent in one secondary map, and are compared in
+   one go. */
+static INLINE
+Bool mc_STOREV_128_or_256_is_noop ( Addr a, SizeT nBits )
+{
+#ifndef PERF_FAST_STOREV
+   return False;
+#else
+   SecMap* sm;
+   UShort* p;
+
+   if (UNLIKELY( UNALIGNED_OR_HIGH(a,nBits) ) || MC_(sm_dirty) != NULL)
+      return False;
+   sm = get_secmap_for_reading_low(a);
+   p  = &sm->vabits16[SM_OFF_16(a)];
+   if (nBits == 128)
+      return *(UInt*)p == (UInt)((VA_BITS16_DEFINED << 16)
+                                 | VA_BITS16_DEFINED);
+   return *(ULong*)p == (((ULong)VA_BITS16_DEFINED << 48)
+                         | ((ULong)VA_BITS16_DEFINED << 32)
+                         | ((ULong)VA_BITS16_DEFINED << 16)
+                         | VA_BITS16_DEFINED);
+#endif
+}
+
+// Non-generic assembly for amd64-{linux,freebsd}
+#if ENABLE_ASSEMBLY_HELPERS && defined(PERF_FAST_LOADV) \
+    && (defined(VGP_amd64_linux) || defined(VGP_amd64_freebsd))
+/* See mc_main_asm.c */
+
+#else
+// Generic for all platforms except amd64-{linux,freebsd}
+void MC_(helperc_STOREV128le) ( Addr a, ULong q0, ULong q1 )
+{
+   PROF_EVENT(MCPE_STOREV_128_OR_256);
+   if (LIKELY( (q0 | q1) == V_BITS64_DEFINED
+               && mc_STOREV_128_or_256_is_noop(a, 128) ))
+      return;
+   mc_STOREV128le_lanes(a, q0, q1);
+}
+void MC_(helperc_STOREV256le) ( Addr a, ULong q0, ULong q1,
+                                        ULong q2, ULong q3 )
+{
+   PROF_EVENT(MCPE_STOREV_128_OR_256);
+   if (LIKELY( (q0 | q1 | q2 | q3) == V_BITS64_DEFINED
+               && mc_STOREV_128_or_256_is_noop(a, 256) ))
+      return;
+   mc_STOREV256le_lanes(a, q0, q1, q2, q3);
+}
+#endif
+
 /*------------------------------------------------------------*/
 /*--- LOADV32                                              ---*/
 /*------------------------------------------------------------*/
@@ -5201,6 +5848,8 @@ void mc_STOREV32 ( Addr a, UWord vbits32, Bool isBigEndian )
          return;
       }
 
+      mark_sm_dirty_low(a);
+
       sm      = get_secmap_for_reading_low(a);
       sm_off  = SM_OFF(a);
       vabits8 = sm->vabits8[sm_off];
@@ -5439,6 +6088,8 @@ void mc_STOREV16 ( Addr a, UWord vbits16, Bool isBigEndian )
          return;
       }
 
+      mark_sm_dirty_low(a);
+
       sm      = get_secmap_for_reading_low(a);
       sm_off  = SM_OFF(a);
       vabits8 = sm->vabits8[sm_off];
@@ -5653,6 +6304,8 @@ void MC_(helperc_STOREV8) ( Addr a, UWord vbits8 )
          return;
       }
 
+      mark_sm_dirty_low(a);
+
       sm      = get_secmap_for_reading_low(a);
       sm_off  = SM_OFF(a);
       vabits8 = sm->vabits8[sm_off];
@@ -6056,6 +6709,11 @@ UInt          MC_(clo_leak_check_heuristics)  =   H2S(LchStdString)
                                                 | H2S( LchLength64)
                                                 | H2S( LchNewArray)
                                                 | H2S( LchMultipleInheritance);
+Int           MC_(clo_leak_check_helpers)     = 0;
+Bool          MC_(clo_leak_check_incremental) = False;
+Bool          MC_(clo_dedup_secmaps)          = False;
+Bool          MC_(clo_shadow_huge_pages)      = False;
+const HChar*  MC_(clo_trusted_objects)        = NULL;
 Bool          MC_(clo_xtree_leak)             = False;
 const HChar*  MC_(clo_xtree_leak_file) = "xtleak.kcg.%p";
 Bool          MC_(clo_workaround_gcc296_bugs) = False;
@@ -6129,6 +6787,16 @@ static Bool mc_process_cmd_line_options(const HChar* arg)
    else if VG_USET_CLOM(cloPD, arg, "--leak-check-heuristics",
                         MC_(parse_leak_heuristics_tokens),
                         MC_(clo_leak_check_heuristics)) {}
+   else if VG_BINT_CLOM(cloPD, arg, "--leak-check-helpers",
+                        MC_(clo_leak_check_helpers),
+                        0, MAX_LEAK_CHECK_HELPERS) {}
+   else if VG_BOOL_CLOM(cloPD, arg, "--leak-check-incremental",
+                        MC_(clo_leak_check_incremental)) {}
+   else if VG_BOOL_CLO(arg, "--dedup-secmaps", MC_(clo_dedup_secmaps)) {}
+   else if VG_BOOL_CLO(arg, "--shadow-huge-pages",
+                       MC_(clo_shadow_huge_pages)) {}
+   else if VG_STR_CLO (arg, "--trusted-objects",
+                       MC_(clo_trusted_objects)) {}
    else if (VG_BOOL_CLOM(cloPD, arg, "--show-reachable", tmp_show)) {
       if (tmp_show) {
          MC_(clo_show_leak_kinds) = MC_(all_Reachedness)();
@@ -6299,6 +6967,10 @@ static void mc_print_usage(void)
 "        improving leak search false positive [all]\n"
 "        where heur is one of:\n"
 "          stdstring length64 newarray multipleinheritance all none\n"
+"    --leak-check-helpers=<number>    nr of helper processes used to scan\n"
+"        the heap during leak searches [0]\n"
+"    --leak-check-incremental=no|yes  only rescan the memory modified since\n"
+"        the previous leak search [no]\n"
 "    --show-reachable=yes             same as --show-leak-kinds=all\n"
 "    --show-reachable=no --show-possibly-lost=yes\n"
 "                                     same as --show-leak-kinds=definite,possible\n"
@@ -6324,6 +6996,11 @@ static void mc_print_usage(void)
 "        stack trace(s) to keep for malloc'd/free'd areas       [alloc-and-free]\n"
 "    --show-mismatched-frees=no|yes   show frees that don't match the allocator? [yes]\n"
 "    --show-realloc-size-zero=no|yes  show realocs with a size of zero? [yes]\n"
+"    --dedup-secmaps=no|yes           share identical shadow memory pages [no]\n"
+"    --shadow-huge-pages=no|yes       use huge pages for shadow memory; freed\n"
+"                                     shadow memory is kept for reuse [no]\n"
+"    --trusted-objects=<pattern>[,<pattern>...]  do not check definedness in\n"
+"                                     objects with a matching soname [none]\n"
    );
 }
 
@@ -7395,6 +8072,8 @@ static const HChar* MC_(event_ctr_name)[MCPE_LAST] = {
    [MCPE_LOADV64]        = "LOADV64",
    [MCPE_LOADV64_SLOW1]  = "LOADV64-slow1",
    [MCPE_LOADV64_SLOW2]  = "LOADV64-slow2",
+   [MCPE_STOREV_128_OR_256]      = "STOREV_128_or_256",
+   [MCPE_STOREV_128_OR_256_SLOW] = "STOREV_128_or_256-slow",
    [MCPE_STOREV64]       = "STOREV64",
    [MCPE_STOREV64_SLOW1] = "STOREV64-slow1",
    [MCPE_STOREV64_SLOW2] = "STOREV64-slow2",
@@ -8039,6 +8718,28 @@ static void mc_post_clo_init ( void )
 
    tl_assert( MC_(clo_mc_level) >= 1 && MC_(clo_mc_level) <= 3 );
 
+   if (MC_(clo_leak_check_incremental)) {
+      /* Everything is dirty till the first leak search. */
+      MC_(sm_dirty_n) = N_PRIMARY_MAP;
+      MC_(sm_dirty) = VG_(malloc)("mc.pci.1", MC_(sm_dirty_n));
+      VG_(memset)(MC_(sm_dirty), 1, MC_(sm_dirty_n));
+   }
+
+   if (MC_(clo_shadow_huge_pages)) {
+      /* The primary map is already in use, with small pages.  They are
+         only replaced when the kernel collapses them. */
+      if (!VG_(am_advise_hugepages)( (Addr)primary_map, sizeof(primary_map) )
+          && VG_(clo_verbosity) > 1)
+         VG_(message)(Vg_DebugMsg,
+                      "memcheck: no transparent huge pages for shadow "
+                      "memory\n");
+   }
+
+   if (MC_(clo_dedup_secmaps)) {
+      init_shared_SMs();
+      VG_(track_start_client_code)( mc_start_client_code );
+   }
+
    if (MC_(clo_mc_level) == 3) {
       /* We're doing origin tracking. */
 #     ifdef PERF_FAST_STACK
@@ -8137,14 +8838,10 @@ static void mc_post_clo_init ( void )
    if (MC_(clo_mc_level) >= 3) {
       init_OCache();
       tl_assert(ocacheL1 != NULL);
-      for (UInt i = 0; i < 4096; i++ ) {
-         tl_assert(ocachesL2[i] != NULL);
-      }
+      tl_assert(ocacheL2 != NULL);
    } else {
       tl_assert(ocacheL1 == NULL);
-      for (UInt i = 0; i < 4096; i++ ) {
-         tl_assert(ocachesL2[i] == NULL);
-      }
+      tl_assert(ocacheL2 == NULL);
    }
 
    MC_(chunk_poolalloc) = VG_(newPA)
@@ -8211,9 +8908,32 @@ static void mc_print_stats (void)
    print_SM_info("max_undefined", max_undefined_SMs);
    print_SM_info("max_defined  ", max_defined_SMs);
    print_SM_info("max_non_DSM  ", max_non_DSM_SMs);
+   if (MC_(clo_dedup_secmaps)) {
+      print_SM_info("n_shared     ", n_shared_SMs);
+      print_SM_info("max_shared   ", max_shared_SMs);
+      print_SM_info("saved        ", n_shared_refs - n_shared_SMs);
+      print_SM_info("max_saved    ", max_SMs_saved);
+      VG_(message)(Vg_DebugMsg,
+         " memcheck: SMs: dedup: %d passes, %d shared by %d entries, "
+         "%d made a DSM, %d unshared\n",
+         n_dedup_passes, n_shared_SMs, n_shared_refs,
+         n_dedup_to_DSM, n_dedup_unshared);
+   }
+   if (MC_(clo_shadow_huge_pages)) {
+      /* How much of the arenas has been handed out.  Whether the kernel
+         actually backs them with huge pages is up to it: see
+         AnonHugePages in /proc/<pid>/smaps. */
+      SizeT used_szB = n_sm_arenas * SM_ARENA_SZB
+                       - (sm_arena_end - sm_arena_next);
+      VG_(message)(Vg_DebugMsg,
+         " memcheck: SMs: %d arenas advised for huge pages (%luM),"
+         " %luK handed out, %d SMs free for reuse\n",
+         n_sm_arenas, n_sm_arenas * SM_ARENA_SZB / (1024 * 1024UL),
+         used_szB / 1024, n_sm_arena_free);
+   }
 
-   // Three DSMs, plus the non-DSM ones
-   max_SMs_szB = (3 + max_non_DSM_SMs) * sizeof(SecMap);
+   // Three DSMs, plus the non-DSM ones, plus the shared ones
+   max_SMs_szB = (3 + max_non_DSM_SMs + max_shared_SMs) * sizeof(SecMap);
    // The 3*sizeof(Word) bytes is the AVL node metadata size.
    // The VG_ROUNDUP is because the OSet pool allocator will/must align
    // the elements on pointer size.
@@ -8253,9 +8973,12 @@ static void mc_print_stats (void)
                    stats_ocacheL1_found_at_N,
                    stats_ocacheL1_movefwds );
       VG_(message)(Vg_DebugMsg,
-                   " ocacheL1: %'14lu sizeB  %'14d useful\n",
-                   (SizeT)sizeof(OCache),
-                   4 * OC_W32S_PER_LINE * OC_LINES_PER_SET * OC_N_SETS );
+                   " ocacheL1: %'14lu sizeB  %'14lu useful\n",
+                   ocacheL1_n_sets * sizeof(OCacheSet),
+                   4 * OC_W32S_PER_LINE * OC_LINES_PER_SET * ocacheL1_n_sets );
+      VG_(message)(Vg_DebugMsg,
+                   " ocacheL1: %'14lu resizes\n",
+                   stats_ocacheL1_resizes );
       VG_(message)(Vg_DebugMsg,
                    " ocacheL2: %'14lu finds  %'14lu misses\n",
                    stats__ocacheL2_finds,
@@ -8268,14 +8991,17 @@ static void mc_print_stats (void)
                    " ocacheL2:    %'9lu max nodes %'9lu curr nodes\n",
                    stats__ocacheL2_n_nodes_max,
                    stats__ocacheL2_n_nodes );
+      VG_(message)(Vg_DebugMsg,
+                   " ocacheL2: %'14lu slots  %'14lu probes (%'lu resizes)\n",
+                   ocacheL2_n_slots,
+                   stats__ocacheL2_probes,
+                   stats__ocacheL2_resizes );
       VG_(message)(Vg_DebugMsg,
                    " niacache: %'12lu refs   %'12lu misses\n",
                    stats__nia_cache_queries, stats__nia_cache_misses);
    } else {
       tl_assert(ocacheL1 == NULL);
-      for (UInt i = 0; i < 4096; i++ ) {
-         tl_assert(ocachesL2[1] == NULL);
-      }
+      tl_assert(ocacheL2 == NULL);
    }
 }
 
@@ -8517,9 +9243,7 @@ static void mc_pre_clo_init(void)
       if we need to, since the command line args haven't been
       processed yet.  Hence defer it to mc_post_clo_init. */
    tl_assert(ocacheL1 == NULL);
-   for (UInt i = 0; i < 4096; i++ ) {
-      tl_assert(ocachesL2[i] == NULL);
-   }
+   tl_assert(ocacheL2 == NULL);
 
    /* Check some important stuff.  See extensive comments above
       re UNALIGNED_OR_HIGH for background. */
@@ -197,6 +197,167 @@ __asm__(
 // is in mc_main.c
 #endif
 
+// Non-generic assembly for amd64-{linux,freebsd}
+#if ENABLE_ASSEMBLY_HELPERS && defined(PERF_FAST_LOADV) \
+    && (defined(VGP_amd64_linux) || defined(VGP_amd64_freebsd))
+/* 128 and 256 bit little-endian loads and stores.  The address must be
+   naturally aligned and below the top of the primary map, which on a
+   64-bit host covers 1 << MC_PRIMARY_MAP_ADDR_BITS bytes.  The
+   2 or 4 vabits16 of the access are then adjacent in one secondary,
+   and are compared in one go against all defined or all undefined.
+   The result is written with SSE2 stores: AVX cannot be assumed of the
+   host, and VEX treats all vector registers as trashed by a helper
+   call anyway.  Anything else goes to the C code in mc_main.c. */
+__asm__(
+".text\n"
+".align 16\n"
+".global vgMemCheck_helperc_LOADV256le\n"
+".type   vgMemCheck_helperc_LOADV256le, @function\n"
+"vgMemCheck_helperc_LOADV256le:\n"     /* %rdi = res, %rsi = a */
+"      mov    %rsi,  %rax\n"
+"      shr    $" VG_STRINGIFY(MC_PRIMARY_MAP_ADDR_BITS) ", %rax\n"
+"      jnz    .LLV256LE2\n"            /* jump if above the primary map */
+"      test   $0x1f, %sil\n"
+"      jnz    .LLV256LE2\n"            /* jump if misaligned */
+"      mov    %rsi,  %rax\n"
+"      shr    $16,   %rax\n"
+"      lea    primary_map(%rip), %rcx\n"
+"      mov    (%rcx,%rax,8), %rcx\n"
+"      movzwl %si,   %eax\n"
+"      shr    $2,    %eax\n"           /* byte offset of vabits16[SM_OFF_16(a)] */
+"      mov    (%rcx,%rax,1), %rax\n"
+"      movabs $0xaaaaaaaaaaaaaaaa, %rdx\n"
+"      cmp    %rdx,  %rax\n"           /* compare to 4 x VA_BITS16_DEFINED */
+"      jne    .LLV256LE1\n"            /* jump if not all defined */
+"      pxor   %xmm0, %xmm0\n"          /* else return V_BITS64_DEFINED x 4 */
+"      movups %xmm0, (%rdi)\n"
+"      movups %xmm0, 16(%rdi)\n"
+"      ret\n"
+".LLV256LE1:\n"
+"      movabs $0x5555555555555555, %rdx\n"
+"      cmp    %rdx,  %rax\n"           /* compare to 4 x VA_BITS16_UNDEFINED */
+"      jne    .LLV256LE2\n"            /* jump if not all undefined */
+"      pcmpeqd %xmm0, %xmm0\n"         /* else return V_BITS64_UNDEFINED x 4 */
+"      movups %xmm0, (%rdi)\n"
+"      movups %xmm0, 16(%rdi)\n"
+"      ret\n"
+".LLV256LE2:\n"
+"      mov    $256,  %edx\n"   /* tail call mc_LOADV_128_or_256le_fallback(res, a, 256) */
+"      jmp    mc_LOADV_128_or_256le_fallback\n"
+".size vgMemCheck_helperc_LOADV256le, .-vgMemCheck_helperc_LOADV256le\n"
+".previous\n"
+);
+
+__asm__(
+".text\n"
+".align 16\n"
+".global vgMemCheck_helperc_LOADV128le\n"
+".type   vgMemCheck_helperc_LOADV128le, @function\n"
+"vgMemCheck_helperc_LOADV128le:\n"     /* %rdi = res, %rsi = a */
+"      mov    %rsi,  %rax\n"
+"      shr    $" VG_STRINGIFY(MC_PRIMARY_MAP_ADDR_BITS) ", %rax\n"
+"      jnz    .LLV128LE2\n"            /* jump if above the primary map */
+"      test   $0xf,  %sil\n"
+"      jnz    .LLV128LE2\n"            /* jump if misaligned */
+"      mov    %rsi,  %rax\n"
+"      shr    $16,   %rax\n"
+"      lea    primary_map(%rip), %rcx\n"
+"      mov    (%rcx,%rax,8), %rcx\n"
+"      movzwl %si,   %eax\n"
+"      shr    $2,    %eax\n"           /* byte offset of vabits16[SM_OFF_16(a)] */
+"      mov    (%rcx,%rax,1), %eax\n"
+"      cmp    $0xaaaaaaaa, %eax\n"     /* compare to 2 x VA_BITS16_DEFINED */
+"      jne    .LLV128LE1\n"            /* jump if not all defined */
+"      pxor   %xmm0, %xmm0\n"          /* else return V_BITS64_DEFINED x 2 */
+"      movups %xmm0, (%rdi)\n"
+"      ret\n"
+".LLV128LE1:\n"
+"      cmp    $0x55555555, %eax\n"     /* compare to 2 x VA_BITS16_UNDEFINED */
+"      jne    .LLV128LE2\n"            /* jump if not all undefined */
+"      pcmpeqd %xmm0, %xmm0\n"         /* else return V_BITS64_UNDEFINED x 2 */
+"      movups %xmm0, (%rdi)\n"
+"      ret\n"
+".LLV128LE2:\n"
+"      mov    $128,  %edx\n"   /* tail call mc_LOADV_128_or_256le_fallback(res, a, 128) */
+"      jmp    mc_LOADV_128_or_256le_fallback\n"
+".size vgMemCheck_helperc_LOADV128le, .-vgMemCheck_helperc_LOADV128le\n"
+".previous\n"
+);
+
+/* Storing all defined V bits over memory that is already all defined
+   changes nothing, and is by far the most common vector store.  Unless
+   --leak-check-incremental wants to hear about the write, return
+   straight away; else store lane by lane. */
+__asm__(
+".text\n"
+".align 16\n"
+".global vgMemCheck_helperc_STOREV256le\n"
+".type   vgMemCheck_helperc_STOREV256le, @function\n"
+"vgMemCheck_helperc_STOREV256le:\n"    /* %rdi = a, %rsi %rdx %rcx %r8 = lanes */
+"      mov    %rsi,  %rax\n"
+"      or     %rdx,  %rax\n"
+"      or     %rcx,  %rax\n"
+"      or     %r8,   %rax\n"
+"      jnz    .LSV256LE1\n"            /* jump if not storing all defined */
+"      cmpq   $0,    vgMemCheck_sm_dirty(%rip)\n"
+"      jne    .LSV256LE1\n"            /* jump if tracking dirty secondaries */
+"      mov    %rdi,  %rax\n"
+"      shr    $" VG_STRINGIFY(MC_PRIMARY_MAP_ADDR_BITS) ", %rax\n"
+"      jnz    .LSV256LE1\n"            /* jump if above the primary map */
+"      test   $0x1f, %dil\n"
+"      jnz    .LSV256LE1\n"            /* jump if misaligned */
+"      mov    %rdi,  %rax\n"
+"      shr    $16,   %rax\n"
+"      lea    primary_map(%rip), %r9\n"
+"      mov    (%r9,%rax,8), %r9\n"
+"      movzwl %di,   %eax\n"
+"      shr    $2,    %eax\n"           /* byte offset of vabits16[SM_OFF_16(a)] */
+"      movabs $0xaaaaaaaaaaaaaaaa, %r10\n"
+"      cmp    %r10,  (%r9,%rax,1)\n"   /* compare to 4 x VA_BITS16_DEFINED */
+"      jne    .LSV256LE1\n"            /* jump if not all defined */
+"      ret\n"
+".LSV256LE1:\n"
+"      jmp    mc_STOREV256le_lanes\n"  /* tail call, same arguments */
+".size vgMemCheck_helperc_STOREV256le, .-vgMemCheck_helperc_STOREV256le\n"
+".previous\n"
+);
+
+__asm__(
+".text\n"
+".align 16\n"
+".global vgMemCheck_helperc_STOREV128le\n"
+".type   vgMemCheck_helperc_STOREV128le, @function\n"
+"vgMemCheck_helperc_STOREV128le:\n"    /* %rdi = a, %rsi %rdx = lanes */
+"      mov    %rsi,  %rax\n"
+"      or     %rdx,  %rax\n"
+"      jnz    .LSV128LE1\n"            /* jump if not storing all defined */
+"      cmpq   $0,    vgMemCheck_sm_dirty(%rip)\n"
+"      jne    .LSV128LE1\n"            /* jump if tracking dirty secondaries */
+"      mov    %rdi,  %rax\n"
+"      shr    $" VG_STRINGIFY(MC_PRIMARY_MAP_ADDR_BITS) ", %rax\n"
+"      jnz    .LSV128LE1\n"            /* jump if above the primary map */
+"      test   $0xf,  %dil\n"
+"      jnz    .LSV128LE1\n"            /* jump if misaligned */
+"      mov    %rdi,  %rax\n"
+"      shr    $16,   %rax\n"
+"      lea    primary_map(%rip), %rcx\n"
+"      mov    (%rcx,%rax,8), %rcx\n"
+"      movzwl %di,   %eax\n"
+"      shr    $2,    %eax\n"           /* byte offset of vabits16[SM_OFF_16(a)] */
+"      cmpl   $0xaaaaaaaa, (%rcx,%rax,1)\n" /* compare to 2 x VA_BITS16_DEFINED */
+"      jne    .LSV128LE1\n"            /* jump if not all defined */
+"      ret\n"
+".LSV128LE1:\n"
+"      jmp    mc_STOREV128le_lanes\n"  /* tail call, same arguments */
+".size vgMemCheck_helperc_STOREV128le, .-vgMemCheck_helperc_STOREV128le\n"
+".previous\n"
+);
+
+#else
+// Generic for all platforms except amd64-{linux,freebsd}
+// is in mc_main.c
+#endif
+
 /*--------------------------------------------------------------------*/
 /*--- end                                                          ---*/
 /*--------------------------------------------------------------------*/
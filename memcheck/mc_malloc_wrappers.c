@@ -37,6 +37,7 @@
 #include "pub_tool_libcproc.h"
 #include "pub_tool_mallocfree.h"
 #include "pub_tool_options.h"
+#include "pub_tool_oset.h"
 #include "pub_tool_replacemalloc.h"
 #include "pub_tool_threadstate.h"
 #include "pub_tool_tooliface.h"     // Needed for mc_include.h
@@ -96,6 +97,121 @@ void delete_MC_Chunk (MC_Chunk* mc);
 static MC_Chunk* freed_list_start[2]  = {NULL, NULL};
 static MC_Chunk* freed_list_end[2]    = {NULL, NULL};
 
+/* With a big --freelist-vol, the freed lists can hold millions of
+   blocks, too many to be searched linearly for each error needing an
+   address description.  So the queued blocks are also indexed by
+   address, in one OSet per size class: class k holds the blocks with
+   a size in [2^k, 2^(k+1)[ (class 0 also holds the empty blocks).
+   The blocks of a class bracketing a given address start in a window
+   just below it, no bigger than twice their size, which contains few
+   blocks of that class.  A freed block can be bracketed by several
+   queued blocks (custom blocks can overlap, and redzones do), so each
+   node records the position of its block in the queue: the block
+   found is the one a walk of the freed lists would find first.
+   Maintaining the index has a cost for each free, so it is only built
+   when the first address description needs it. */
+#define N_FREED_CLASSES (8 * sizeof(SizeT))
+
+typedef
+   struct {
+      Addr      data;  /* == mc->data */
+      MC_Chunk* mc;    /* makes the key unique */
+   }
+   FreedKey;
+
+typedef
+   struct {
+      FreedKey key;
+      Int      list;   /* index in freed_list_start */
+      Long     seq;    /* smaller for blocks nearer the list start */
+   }
+   FreedNode;
+
+static OSet* freed_index[N_FREED_CLASSES];
+static Bool  freed_index_active = False;
+
+/* Sequence numbers of the blocks queued at the start and at the end of
+   the freed lists. */
+static Long freed_seq_start = 0;
+static Long freed_seq_end   = 0;
+
+static Word cmp_FreedKey ( const void* key, const void* elem )
+{
+   const FreedKey* k = key;
+   const FreedKey* e = &((const FreedNode*)elem)->key;
+   if (k->data < e->data) return -1;
+   if (k->data > e->data) return 1;
+   if ((Addr)k->mc < (Addr)e->mc) return -1;
+   if ((Addr)k->mc > (Addr)e->mc) return 1;
+   return 0;
+}
+
+static UInt freed_class ( SizeT szB )
+{
+   UInt k = 0;
+   while (szB > 1) {
+      szB >>= 1;
+      k++;
+   }
+   return k;
+}
+
+static void add_to_freed_index ( MC_Chunk* mc, Int list, Long seq )
+{
+   FreedNode* n;
+   UInt       k;
+
+   if (!freed_index_active)
+      return;
+   k = freed_class(mc->szB);
+   n = VG_(OSetGen_AllocNode)(freed_index[k], sizeof(FreedNode));
+   n->key.data = mc->data;
+   n->key.mc   = mc;
+   n->list     = list;
+   n->seq      = seq;
+   VG_(OSetGen_Insert)(freed_index[k], n);
+}
+
+static void remove_from_freed_index ( MC_Chunk* mc )
+{
+   UInt       k = freed_class(mc->szB);
+   FreedKey   key;
+   FreedNode* n;
+
+   if (!freed_index_active)
+      return;
+   key.data = mc->data;
+   key.mc   = mc;
+   n = VG_(OSetGen_Remove)(freed_index[k], &key);
+   tl_assert(n != NULL);
+   VG_(OSetGen_FreeNode)(freed_index[k], n);
+}
+
+/* Index the blocks already in the freed lists. */
+static void activate_freed_index ( void )
+{
+   UInt      k;
+   Int       l;
+   Long      seq;
+   MC_Chunk* mc;
+
+   tl_assert(!freed_index_active);
+   freed_index[0] = VG_(OSetGen_Create_With_Pool)
+      ( offsetof(FreedNode, key), cmp_FreedKey,
+        VG_(malloc), "mc.afi.1", VG_(free), 1000, sizeof(FreedNode) );
+   for (k = 1; k < N_FREED_CLASSES; k++)
+      freed_index[k] = VG_(OSetGen_EmptyClone)(freed_index[0]);
+   freed_index_active = True;
+
+   freed_seq_start = 0;
+   seq = 0;
+   for (l = 0; l < 2; l++) {
+      for (mc = freed_list_start[l]; mc != NULL; mc = mc->next)
+         add_to_freed_index(mc, l, seq++);
+   }
+   freed_seq_end = seq;
+}
+
 /* Put a shadow chunk on the freed blocks queue, possibly freeing up
    some of the oldest blocks in the queue at the same time. */
 static void add_to_freed_queue ( MC_Chunk* mc )
@@ -110,15 +226,18 @@ static void add_to_freed_queue ( MC_Chunk* mc )
       tl_assert(freed_list_start[l] == NULL);
       mc->next = NULL;
       freed_list_end[l]    = freed_list_start[l] = mc;
+      add_to_freed_index(mc, l, freed_seq_end++);
    } else {
       tl_assert(freed_list_end[l]->next == NULL);
       if (mc->szB >= MC_(clo_freelist_vol)) {
          mc->next = freed_list_start[l];
          freed_list_start[l] = mc;
+         add_to_freed_index(mc, l, --freed_seq_start);
       } else {
          mc->next = NULL;
          freed_list_end[l]->next = mc;
          freed_list_end[l]       = mc;
+         add_to_freed_index(mc, l, freed_seq_end++);
       }
    }
    VG_(free_queue_volume) += (Long)mc->szB;
@@ -161,6 +280,7 @@ static void release_oldest_block(void)
             freed_list_start[i] = mc1->next;
          }
          mc1->next = NULL; /* just paranoia */
+         remove_from_freed_index(mc1);
 
          /* free MC_Chunk */
          if (MC_AllocCustom != mc1->allockind)
@@ -172,18 +292,37 @@ static void release_oldest_block(void)
 
 MC_Chunk* MC_(get_freed_block_bracketting) (Addr a)
 {
-   int i;
-   for (i = 0; i < 2; i++) {
-      MC_Chunk*  mc;
-      mc = freed_list_start[i];
-      while (mc) {
-         if (VG_(addr_is_in_block)( a, mc->data, mc->szB,
-                                    MC_(Malloc_Redzone_SzB) ))
-            return mc;
-         mc = mc->next;
+   const SizeT rz = MC_(Malloc_Redzone_SzB);
+   FreedNode* best = NULL;
+   UInt       k;
+
+   if (!freed_index_active)
+      activate_freed_index();
+
+   for (k = 0; k < N_FREED_CLASSES; k++) {
+      /* A block of class k bracketing a starts in [lo, hi]. */
+      SizeT      max_szB = k + 1 < N_FREED_CLASSES
+                              ? ((SizeT)1 << (k + 1)) - 1 : ~(SizeT)0;
+      Addr       lo = a >= rz + max_szB ? a - rz - max_szB : 0;
+      Addr       hi = a + rz >= a ? a + rz : ~(Addr)0;
+      FreedKey   key;
+      FreedNode* n;
+
+      if (VG_(OSetGen_Size)(freed_index[k]) == 0)
+         continue;
+      key.data = lo;
+      key.mc   = NULL;
+      VG_(OSetGen_ResetIterAt)(freed_index[k], &key);
+      while ((n = VG_(OSetGen_Next)(freed_index[k])) != NULL
+             && n->key.data <= hi) {
+         if (!VG_(addr_is_in_block)( a, n->key.data, n->key.mc->szB, rz ))
+            continue;
+         if (best == NULL || n->list < best->list
+             || (n->list == best->list && n->seq < best->seq))
+            best = n;
       }
    }
-   return NULL;
+   return best ? best->key.mc : NULL;
 }
 
 /* Allocate a shadow chunk, put it on the appropriate list.
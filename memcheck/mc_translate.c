@@ -37,6 +37,8 @@
 #include "pub_tool_xarray.h"
 #include "pub_tool_mallocfree.h"
 #include "pub_tool_libcbase.h"
+#include "pub_tool_debuginfo.h"     // VG_(find_DebugInfo)
+#include "pub_tool_seqmatch.h"      // VG_(string_match)
 
 #include "mc_include.h"
 
@@ -330,6 +332,13 @@ typedef
          arguments of type 'HWord' to be passed to helper functions.
          Ity_I32 or Ity_I64 only. */
       IRType hWordTy;
+
+      /* True if the guest instruction being instrumented is in an
+         object matching --trusted-objects; updated at each IMark.
+         Such code gets no definedness checks, and all the values it
+         computes are taken to be defined.  Its memory accesses are
+         still checked for addressability. */
+      Bool trusted;
    }
    MCEnv;
 
@@ -1491,6 +1500,10 @@ static void complainIfUndefined ( MCEnv* mce, IRAtom* atom, IRExpr *guard )
    if (MC_(clo_mc_level) == 1)
       return;
 
+   // Nor in trusted code.
+   if (mce->trusted)
+      return;
+
    if (guard)
       tl_assert(isOriginalAtom(mce, guard));
 
@@ -5997,7 +6010,55 @@ void do_shadow_Store ( MCEnv* mce,
       }
    }
 
-   if (UNLIKELY(ty == Ity_V256)) {
+   if (end == Iend_LE && tyAddr == Ity_I64
+       && (ty == Ity_V256 || ty == Ity_V128 || ty == Ity_I128)) {
+
+      /* 64-bit little-endian host: one call to a helper that takes the
+         V bits as 64-bit lanes, least significant first, rather than
+         one STOREV64 per lane.  The helper can then see in one go that
+         an all-defined vector is being stored over all-defined memory,
+         which is the common case. */
+      IRDirty  *di;
+      IRAtom   *addrAct;
+      IRExpr  **args;
+
+      if (bias == 0) {
+         addrAct = addr;
+      } else {
+         addrAct = assignNew('V', mce, tyAddr,
+                             binop(mkAdd, addr, mkU64(bias)));
+      }
+
+      if (ty == Ity_V256) {
+         helper = &MC_(helperc_STOREV256le);
+         hname  = "MC_(helperc_STOREV256le)";
+         args   = mkIRExprVec_5(
+                     addrAct,
+                     assignNew('V', mce, Ity_I64, unop(Iop_V256to64_0, vdata)),
+                     assignNew('V', mce, Ity_I64, unop(Iop_V256to64_1, vdata)),
+                     assignNew('V', mce, Ity_I64, unop(Iop_V256to64_2, vdata)),
+                     assignNew('V', mce, Ity_I64, unop(Iop_V256to64_3, vdata))
+                  );
+      } else {
+         IROp opGetLO64 = ty == Ity_V128 ? Iop_V128to64   : Iop_128to64;
+         IROp opGetHI64 = ty == Ity_V128 ? Iop_V128HIto64 : Iop_128HIto64;
+         helper = &MC_(helperc_STOREV128le);
+         hname  = "MC_(helperc_STOREV128le)";
+         args   = mkIRExprVec_3(
+                     addrAct,
+                     assignNew('V', mce, Ity_I64, unop(opGetLO64, vdata)),
+                     assignNew('V', mce, Ity_I64, unop(opGetHI64, vdata))
+                  );
+      }
+      di = unsafeIRDirty_0_N( 0/*regparms*/,
+                              hname, VG_(fnptr_to_fnentry)( helper ),
+                              args );
+      if (guard) di->guard = guard;
+      setHelperAnns( mce, di );
+      stmt( 'V', mce, IRStmt_Dirty(di) );
+
+   }
+   else if (UNLIKELY(ty == Ity_V256)) {
 
       /* V256-bit case -- phrased in terms of 64 bit units (Qs), with
          Q3 being the most significant lane. */
@@ -6273,7 +6334,8 @@ void do_shadow_Dirty ( MCEnv* mce, IRDirty* d )
       tl_assert(tyAddr == mce->hWordTy); /* not really right */
    }
 
-   /* Deal with memory inputs (reads or modifies) */
+   /* Deal with memory inputs (reads or modifies).  Also done for
+      trusted code, since the loads check the addressability. */
    if (d->mFx == Ifx_Read || d->mFx == Ifx_Modify) {
       toDo   = d->mSize;
       /* chew off 32-bit chunks.  We don't care about the endianness
@@ -6314,7 +6376,10 @@ void do_shadow_Dirty ( MCEnv* mce, IRDirty* d )
 
    /* Whew!  So curr is a 32-bit V-value summarising pessimistically
       all the inputs to the helper.  Now we need to re-distribute the
-      results to all destinations. */
+      results to all destinations.  The results of trusted code are
+      defined, whatever its inputs. */
+   if (mce->trusted)
+      curr = definedOfType(Ity_I32);
 
    /* Outputs: the destination temporary, if there is one. */
    if (d->tmp != IRTemp_INVALID) {
@@ -7000,6 +7065,11 @@ static void do_shadow_LoadG ( MCEnv* mce, IRLoadG* lg )
       = expr2vbits_Load_guarded_General(mce, lg->end, loadedTy,
                                         lg->addr, 0/*addr bias*/,
                                         lg->guard, vwiden, vbits_alt );
+   /* Trusted code only wants the addressability check done by the
+      load. */
+   if (mce->trusted)
+      vbits_final = definedOfType(typeOfIRTemp(mce->sb->tyenv, lg->dst));
+
    /* And finally, bind the V bits to the destination temporary. */
    assign( 'V', mce, findShadowTmpV(mce, lg->dst), vbits_final );
 }
@@ -8062,6 +8132,8 @@ void MC_(do_instrumentation_startup_checks)( void )
    CHECK(False, "MC_(helperc_STOREV16le)");
    CHECK(False, "MC_(helperc_STOREV32le)");
    CHECK(False, "MC_(helperc_STOREV64le)");
+   CHECK(False, "MC_(helperc_STOREV128le)");
+   CHECK(False, "MC_(helperc_STOREV256le)");
    CHECK(False, "MC_(helperc_STOREV8)");
    CHECK(False, "track_die_mem_stack_8");
    CHECK(False, "track_new_mem_stack_8_w_ECU");
@@ -8555,6 +8627,59 @@ static void preInstrumentationAnalysis ( /*OUT*/HowUsed** useEnvP,
 }
 
 
+/* Is the guest code at |a| in an object whose soname matches one of the
+   comma-separated patterns of --trusted-objects ?  This is asked for
+   each guest instruction, so the answer for the text segment of the
+   last object looked up is cached, until the DebugInfo epoch changes. */
+static Bool is_trusted_code ( Addr a )
+{
+   static XArray* /* of HChar* */ patterns = NULL;
+   static DiEpoch cached_ep   = { 0 };
+   static Addr    cached_lo   = 0;
+   static Addr    cached_hi   = 0;   // exclusive; empty cache if lo == hi
+   static Bool    cached_res  = False;
+   const DebugInfo* di;
+   const HChar* soname;
+   DiEpoch ep;
+   Bool res;
+   Word i;
+
+   if (MC_(clo_trusted_objects) == NULL)
+      return False;
+
+   ep = VG_(current_DiEpoch)();
+   if (ep.n == cached_ep.n && cached_lo <= a && a < cached_hi)
+      return cached_res;
+
+   if (patterns == NULL) {
+      HChar* str = VG_(strdup)("mc.itc.1", MC_(clo_trusted_objects));
+      HChar* saveptr;
+      HChar* pat;
+      patterns = VG_(newXA)(VG_(malloc), "mc.itc.2", VG_(free),
+                            sizeof(HChar*));
+      for (pat = VG_(strtok_r)(str, ",", &saveptr); pat != NULL;
+           pat = VG_(strtok_r)(NULL, ",", &saveptr))
+         VG_(addToXA)(patterns, &pat);
+   }
+
+   di = VG_(find_DebugInfo)(ep, a);
+   if (di == NULL)
+      return False;
+   res = False;
+   soname = VG_(DebugInfo_get_soname)(di);
+   for (i = 0; soname != NULL && i < VG_(sizeXA)(patterns); i++) {
+      if (VG_(string_match)(*(HChar**)VG_(indexXA)(patterns, i), soname)) {
+         res = True;
+         break;
+      }
+   }
+   cached_ep  = ep;
+   cached_lo  = VG_(DebugInfo_get_text_avma)(di);
+   cached_hi  = cached_lo + VG_(DebugInfo_get_text_size)(di);
+   cached_res = res;
+   return res;
+}
+
 IRSB* MC_(instrument) ( VgCallbackClosure* closure,
                         IRSB* sb_in, 
                         const VexGuestLayout* layout, 
@@ -8597,6 +8722,7 @@ IRSB* MC_(instrument) ( VgCallbackClosure* closure,
    mce.layout         = layout;
    mce.hWordTy        = hWordTy;
    mce.tmpHowUsed     = NULL;
+   mce.trusted        = is_trusted_code(vge->base[0]);
 
    /* BEGIN decide on expense levels for instrumentation. */
 
@@ -8784,9 +8910,22 @@ IRSB* MC_(instrument) ( VgCallbackClosure* closure,
          VG_(printf)("\n");
       }
 
+      if (st->tag == Ist_IMark)
+         mce.trusted = is_trusted_code(st->Ist.IMark.addr);
+
       if (MC_(clo_mc_level) == 3) {
-         /* See comments on case Ist_CAS below. */
-         if (st->tag != Ist_CAS) 
+         /* See comments on case Ist_CAS below.  Trusted code computes
+            only defined values, so the origins of its tmps never
+            matter.  They are still bound, as untrusted code later in
+            the superblock may use them. */
+         if (mce.trusted && st->tag == Ist_WrTmp)
+            assign( 'B', &mce, findShadowTmpB(&mce, st->Ist.WrTmp.tmp),
+                    mkU32(0) );
+         else if (mce.trusted && st->tag == Ist_LoadG)
+            assign( 'B', &mce,
+                    findShadowTmpB(&mce, st->Ist.LoadG.details->dst),
+                    mkU32(0) );
+         else if (st->tag != Ist_CAS)
             schemeS( &mce, st );
       }
 
@@ -8797,6 +8936,22 @@ IRSB* MC_(instrument) ( VgCallbackClosure* closure,
          case Ist_WrTmp: {
             IRTemp dst = st->Ist.WrTmp.tmp;
             tl_assert(dst < (UInt)sb_in->tyenv->types_used);
+            if (mce.trusted) {
+               /* No V bit propagation: the value is defined.  Stores and
+                  Puts of it then mark their destination as defined.
+                  Loads still call the LOADV helpers, for their
+                  addressability check. */
+               IRExpr* data  = st->Ist.WrTmp.data;
+               IRTemp  tmp_v = findShadowTmpV(&mce, dst);
+               if (data->tag == Iex_Load)
+                  (void)expr2vbits_Load( &mce, data->Iex.Load.end,
+                                         data->Iex.Load.ty,
+                                         data->Iex.Load.addr, 0/*bias*/,
+                                         NULL/*guard*/ );
+               assign( 'V', &mce, tmp_v,
+                       definedOfType( typeOfIRTemp(sb_out->tyenv, tmp_v) ));
+               break;
+            }
             HowUsed hu = mce.tmpHowUsed ? mce.tmpHowUsed[dst]
                                         : HuOth/*we don't know, so play safe*/;
             assign( 'V', &mce, findShadowTmpV(&mce, st->Ist.WrTmp.tmp), 
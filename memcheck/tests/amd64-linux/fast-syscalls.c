@@ -0,0 +1,94 @@
+/* The syscalls that --fast-syscalls=yes runs in place from generated
+   code must report the same errors, and give the same results, as when
+   they go through the scheduler: with unaddressable and undefined
+   arguments, and with NULL pointers.  The syscalls are made with
+   syscall(), as the vDSO is hidden from the client anyway. */
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/time.h>
+#include "../../memcheck.h"
+
+static void report(const char* what, long res)
+{
+   fprintf(stderr, "%s: %s\n", what,
+           res == 0 ? "ok" : errno == EFAULT ? "EFAULT" : "other error");
+}
+
+int main(void)
+{
+   struct timespec* ts = malloc(sizeof(*ts));
+   struct timeval*  tv = malloc(sizeof(*tv));
+   struct timezone* tz = malloc(sizeof(*tz));
+   time_t*          t  = malloc(sizeof(*t));
+   unsigned*        cpu  = malloc(sizeof(*cpu));
+   unsigned*        node = malloc(sizeof(*node));
+   char*            unmapped;
+   int              undef_clk;
+   long             res;
+
+   /* Unaddressable buffers: freed, so mapped but not addressable, and
+      unmapped. */
+   unmapped = mmap(NULL, 4096, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+   munmap(unmapped, 4096);
+   fprintf(stderr, "---- unaddressable buffers\n");
+   free(ts); free(tv); free(tz); free(t); free(cpu); free(node);
+   report("clock_gettime",
+          syscall(SYS_clock_gettime, CLOCK_MONOTONIC, ts));
+   report("gettimeofday", syscall(SYS_gettimeofday, tv, tz));
+   res = syscall(SYS_time, t);
+   report("time", res == -1 ? -1 : 0);
+   report("getcpu", syscall(SYS_getcpu, cpu, node, NULL));
+   report("clock_gettime unmapped",
+          syscall(SYS_clock_gettime, CLOCK_MONOTONIC, unmapped));
+   report("gettimeofday unmapped", syscall(SYS_gettimeofday, unmapped, NULL));
+   res = syscall(SYS_time, unmapped);
+   report("time unmapped", res == -1 ? -1 : 0);
+   report("getcpu unmapped", syscall(SYS_getcpu, unmapped, NULL, NULL));
+
+   /* Undefined buffers are written by the syscalls, so only undefined
+      arguments are errors.  The results are defined afterwards. */
+   fprintf(stderr, "---- undefined buffers and arguments\n");
+   ts = malloc(sizeof(*ts));
+   tv = malloc(sizeof(*tv));
+   tz = malloc(sizeof(*tz));
+   t  = malloc(sizeof(*t));
+   cpu  = malloc(sizeof(*cpu));
+   node = malloc(sizeof(*node));
+   report("clock_gettime", syscall(SYS_clock_gettime, CLOCK_MONOTONIC, ts));
+   if (ts->tv_nsec < 0)
+      fprintf(stderr, "bad tv_nsec\n");
+   report("gettimeofday", syscall(SYS_gettimeofday, tv, tz));
+   if (tv->tv_usec < 0 || tz->tz_dsttime < 0)
+      fprintf(stderr, "bad tv_usec\n");
+   res = syscall(SYS_time, t);
+   report("time", res == -1 ? -1 : 0);
+   if (*t != res)
+      fprintf(stderr, "bad time\n");
+   report("getcpu", syscall(SYS_getcpu, cpu, node, NULL));
+   if (*cpu > 65536 || *node > 65536)
+      fprintf(stderr, "bad cpu\n");
+   VALGRIND_MAKE_MEM_UNDEFINED(&undef_clk, sizeof(undef_clk));
+   undef_clk = undef_clk * 0 + CLOCK_MONOTONIC;
+   VALGRIND_MAKE_MEM_UNDEFINED(&undef_clk, sizeof(undef_clk));
+   report("clock_gettime undefined clock",
+          syscall(SYS_clock_gettime, undef_clk, ts));
+   free(ts); free(tv); free(tz); free(t); free(cpu); free(node);
+
+   /* NULL arguments. */
+   fprintf(stderr, "---- NULL arguments\n");
+   report("clock_gettime", syscall(SYS_clock_gettime, CLOCK_MONOTONIC, NULL));
+   report("gettimeofday", syscall(SYS_gettimeofday, NULL, NULL));
+   res = syscall(SYS_time, NULL);
+   report("time", res == -1 ? -1 : 0);
+   report("getcpu", syscall(SYS_getcpu, NULL, NULL, NULL));
+
+   return 0;
+}
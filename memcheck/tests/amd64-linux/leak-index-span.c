@@ -0,0 +1,53 @@
+/* Check that the leak search still indexes the blocks when they are
+   spread over more than 32GB of address space, as they are when a
+   single block is that large.  The big block is a custom allocation in
+   memory that is marked as not accessible, so the search does not have
+   to scan it. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include "../leak.h"
+#include "../../memcheck.h"
+
+#define BIG_SZB (40UL << 30)
+
+static char*  big;
+static void** reachable;
+
+__attribute__((noinline))
+static void lose_a_block(void)
+{
+   /* The pointer is in a dead stack frame once this returns. */
+   volatile char* p = malloc(16);
+   p[0] = 0;
+}
+
+int main(void)
+{
+   DECLARE_LEAK_COUNTERS;
+
+   GET_INITIAL_LEAK_COUNTS;
+
+   big = mmap(NULL, BIG_SZB, PROT_READ | PROT_WRITE,
+              MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+   if (big == MAP_FAILED) {
+      perror("mmap");
+      return 1;
+   }
+   VALGRIND_MALLOCLIKE_BLOCK(big, BIG_SZB, 0, 0);
+   VALGRIND_MAKE_MEM_NOACCESS(big, BIG_SZB);
+
+   reachable = malloc(32);
+   reachable[0] = malloc(48);
+   reachable[1] = malloc(64);
+   lose_a_block();
+   CLEAR_CALLER_SAVED_REGS;
+
+   GET_FINAL_LEAK_COUNTS;
+   PRINT_LEAK_COUNTS(stderr);
+
+   VALGRIND_FREELIKE_BLOCK(big, 0);
+   munmap(big, BIG_SZB);
+   return 0;
+}
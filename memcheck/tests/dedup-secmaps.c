@@ -0,0 +1,99 @@
+/* Checks that V+A bits stay right when --dedup-secmaps=yes shares the
+   secondary maps of identical blocks, and unshares them on write. */
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "../memcheck.h"
+
+#define N_BLOCKS   100
+#define BLOCK_SZB  (2 * 65536)
+
+/* Padding bytes after c stay undefined, except in the first struct of
+   a block: that way the first V+A bits of the shared secondaries say
+   defined, but the secondaries are not all defined. */
+struct s { char c; int i; };
+
+static char* blocks[N_BLOCKS];
+
+/* Returns 1 if the V bits of block b are those set by fill. */
+static int check_block ( int b, int pad_defined )
+{
+   char v[64];
+   int  j;
+
+   if (VALGRIND_GET_VBITS(blocks[b], v, sizeof(v)) != 1)
+      return 0;
+   for (j = 0; j < sizeof(v); j++) {
+      int is_pad = j >= sizeof(struct s)
+                   && j % sizeof(struct s) >= 1 && j % sizeof(struct s) < 4;
+      char expected = is_pad && !pad_defined ? (char)0xff : 0;
+      if (v[j] != expected)
+         return 0;
+   }
+   return 1;
+}
+
+int main ( void )
+{
+   int i, j, n_ok, fd;
+
+   for (i = 0; i < N_BLOCKS; i++) {
+      struct s* p;
+      if (posix_memalign((void**)&blocks[i], 65536, BLOCK_SZB) != 0)
+         return 1;
+      p = (struct s*)blocks[i];
+      memset(p, 0, sizeof(*p));
+      for (j = 0; j < BLOCK_SZB / sizeof(struct s); j++) {
+         p[j].c = 'x';
+         p[j].i = j;
+      }
+   }
+   /* A system call ends the time slice: the next one starts with a
+      dedup pass. */
+   getpid();
+
+   n_ok = 0;
+   for (i = 0; i < N_BLOCKS; i++)
+      n_ok += check_block(i, 0);
+   fprintf(stderr, "%d blocks ok after sharing\n", n_ok);
+
+   /* Writes go to a private copy. */
+   for (j = 0; j < 64; j += sizeof(struct s))
+      memset(&blocks[3][j + 1], 0, 3);
+   VALGRIND_MAKE_MEM_DEFINED(blocks[4], 64);
+   fprintf(stderr, "block 3 %s, block 4 %s, block 5 %s\n",
+           check_block(3, 1) ? "ok" : "wrong",
+           check_block(4, 1) ? "ok" : "wrong",
+           check_block(5, 0) ? "ok" : "wrong");
+
+   /* Whole shared secondaries going away. */
+   for (i = 10; i < 20; i++)
+      free(blocks[i]);
+   for (i = 20; i < 30; i++)
+      memset(blocks[i], 0, BLOCK_SZB);
+   getpid();
+
+   n_ok = 0;
+   for (i = 0; i < N_BLOCKS; i++)
+      if (i < 10 || i >= 30)
+         n_ok += check_block(i, i == 3 || i == 4);
+   fprintf(stderr, "%d blocks ok after unsharing\n", n_ok);
+
+   /* Undefined values in shared secondaries are still reported, also
+   when checking a whole range at once. */
+   if (blocks[50][9] == 'x')
+      fprintf(stderr, "padding is x\n");
+   fd = open("/dev/null", O_WRONLY);
+   if (fd >= 0) {
+      write(fd, blocks[50], 64);
+      close(fd);
+   }
+
+   for (i = 0; i < N_BLOCKS; i++)
+      if (i < 10 || i >= 20)
+         free(blocks[i]);
+   return 0;
+}
@@ -0,0 +1,66 @@
+/* With --leak-check-incremental=yes, a word pointing to memory that is
+   not mapped when its granule is scanned must still be found by a later
+   leak search, once a block has been allocated at that address, even if
+   the granule holding the word was not modified in between. */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include "../memcheck.h"
+#include "leak.h"
+
+#define ARENA_SIZE 4096
+#define KEY        0x5a5a5a5a
+
+#define GRANULE    65536
+
+/* Holds the pointer, in a secondary map of its own that is not modified
+   after the first leak search. */
+static char** holder;
+/* The address of the arena, hidden from the leak search. */
+static uintptr_t hidden;
+/* A leak search is only done if there are blocks. */
+static char* b10;
+
+static void __attribute__((noinline)) reserve_arena(void)
+{
+   char* h = mmap(NULL, 2 * GRANULE, PROT_READ | PROT_WRITE,
+                  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+   char* p = mmap(NULL, ARENA_SIZE, PROT_READ | PROT_WRITE,
+                  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+   holder = (char**)(((uintptr_t)h + GRANULE - 1) & ~(uintptr_t)(GRANULE - 1));
+   munmap(p, ARENA_SIZE);
+   holder[0] = p;
+   hidden = (uintptr_t)p ^ KEY;
+}
+
+/* A custom allocator maps a new arena where holder[0] points to, and
+   allocates a block at its start. */
+static void __attribute__((noinline)) map_arena(void)
+{
+   char* p = (char*)(hidden ^ KEY);
+   if (mmap(p, ARENA_SIZE, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0) != p)
+      perror("mmap");
+   VALGRIND_MALLOCLIKE_BLOCK(p, 64, 0, 0);
+}
+
+int main(void)
+{
+   b10 = malloc(10);
+   reserve_arena();
+   CLEAR_CALLER_SAVED_REGS;
+   fprintf(stderr, "expecting details 10 bytes reachable\n"); fflush(stderr);
+   VALGRIND_DO_LEAK_CHECK;
+
+   map_arena();
+   CLEAR_CALLER_SAVED_REGS;
+   fprintf(stderr, "expecting details +64 bytes reachable\n"); fflush(stderr);
+   VALGRIND_DO_ADDED_LEAK_CHECK;
+
+   VALGRIND_FREELIKE_BLOCK(holder[0], 0);
+   munmap(holder[0], ARENA_SIZE);
+   free(b10);
+   return 0;
+}
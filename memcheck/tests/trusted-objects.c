@@ -0,0 +1,28 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+extern int trusted_sum ( const int* in, int n, int* out );
+
+int main ( void )
+{
+   int* in  = malloc(10 * sizeof(int));
+   int* out = malloc(sizeof(int));
+   int* undef = malloc(sizeof(int));
+   int  ret;
+
+   in[0] = 1;
+   ret = trusted_sum(in, 10, out);
+
+   // The results of the trusted code are defined.
+   if (ret == *out)
+      fprintf(stderr, "same\n");
+
+   // The rest of the program is still checked.
+   if (*undef)
+      fprintf(stderr, "undef\n");
+
+   free(in);
+   free(out);
+   free(undef);
+   return 0;
+}
@@ -0,0 +1,16 @@
+#include <stdlib.h>
+
+/* With --trusted-objects=trusted-objectsso.so, nothing is reported about
+   the undefined values used here, and *out is defined afterwards.  The
+   invalid read and write are still reported. */
+int trusted_sum ( const int* in, int n, int* out )
+{
+   int i, sum = 0;
+   for (i = 0; i < n; i++) {
+      if (in[i] > 0)
+         sum += in[i];
+   }
+   *out = sum;
+   out[1] = in[n];
+   return sum;
+}
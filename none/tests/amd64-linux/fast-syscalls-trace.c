@@ -0,0 +1,22 @@
+/* --trace-syscalls=yes must still show the syscalls that
+   --fast-syscalls=yes would otherwise run in place. */
+
+#define _GNU_SOURCE
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <sys/time.h>
+
+int main(void)
+{
+   struct timespec ts;
+   struct timeval  tv;
+   unsigned        cpu;
+
+   syscall(SYS_getpid);
+   syscall(SYS_clock_gettime, CLOCK_MONOTONIC, &ts);
+   syscall(SYS_gettimeofday, &tv, NULL);
+   syscall(SYS_time, NULL);
+   syscall(SYS_getcpu, &cpu, NULL, NULL);
+   return 0;
+}
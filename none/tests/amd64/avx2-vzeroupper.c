@@ -0,0 +1,112 @@
+/* Check the code generated for native 256-bit AVX2 operations, and
+   that a vzeroupper is only emitted where it is needed: once before
+   leaving a block that used the %ymm registers, and before helper
+   calls made while the upper halves are dirty.  The SSE code in such
+   blocks must be VEX encoded, so that it does not pay the SSE/AVX
+   transition penalty either.  The kernels are written in assembly so
+   that each is exactly one superblock; the filter counts the
+   vzerouppers and the legacy encoded SSE instructions in their host
+   code. */
+
+#include <stdio.h>
+
+typedef  unsigned int  UInt;
+
+typedef  union { UInt u32[8]; }  YMM __attribute__((aligned(32)));
+
+/* Native ops only. */
+extern void ymm_native ( YMM* a, YMM* b, YMM* out );
+/* Native ops interleaved with ones done on the two 128-bit halves
+   with SSE code. */
+extern void ymm_mixed ( YMM* a, YMM* b, YMM* out );
+/* A helper call (cpuid) with clean upper halves, then ymm ops, then
+   a second helper call with dirty ones. */
+extern void ymm_call ( YMM* a, YMM* b, YMM* out );
+
+asm("\n"
+".text\n"
+".globl ymm_native\n"
+".type ymm_native, @function\n"
+"ymm_native:\n"
+"   vmovdqu (%rdi),%ymm0\n"
+"   vmovdqu (%rsi),%ymm1\n"
+"   vpaddd  %ymm1,%ymm0,%ymm2\n"
+"   vpxor   %ymm0,%ymm2,%ymm3\n"
+"   vpsubq  %ymm3,%ymm1,%ymm4\n"
+"   vpand   %ymm4,%ymm2,%ymm5\n"
+"   vpslld  $3,%ymm5,%ymm5\n"
+"   vpor    %ymm3,%ymm5,%ymm5\n"
+"   vmovdqu %ymm5,(%rdx)\n"
+"   vzeroupper\n"
+"   ret\n"
+".size ymm_native, .-ymm_native\n"
+".globl ymm_mixed\n"
+".type ymm_mixed, @function\n"
+"ymm_mixed:\n"
+"   vmovdqu (%rdi),%ymm0\n"
+"   vmovdqu (%rsi),%ymm1\n"
+"   vpaddd  %ymm1,%ymm0,%ymm2\n"
+"   vphaddd %ymm1,%ymm2,%ymm3\n"
+"   vpxor   %ymm0,%ymm3,%ymm3\n"
+"   vpshufb %ymm2,%ymm3,%ymm4\n"
+"   vpaddd  %ymm4,%ymm3,%ymm4\n"
+"   vphsubd %ymm0,%ymm4,%ymm5\n"
+"   vpxor   %ymm2,%ymm5,%ymm5\n"
+"   vmovdqu %ymm5,(%rdx)\n"
+"   vzeroupper\n"
+"   ret\n"
+".size ymm_mixed, .-ymm_mixed\n"
+".globl ymm_call\n"
+".type ymm_call, @function\n"
+"ymm_call:\n"
+"   pushq   %rbx\n"
+"   movq    %rdx,%r8\n"
+"   xorl    %eax,%eax\n"
+"   xorl    %ecx,%ecx\n"
+"   cpuid\n"
+"   vmovdqu (%rdi),%ymm0\n"
+"   vmovdqu (%rsi),%ymm1\n"
+"   vpaddd  %ymm1,%ymm0,%ymm2\n"
+"   vmovdqu %ymm2,(%r8)\n"
+"   xorl    %eax,%eax\n"
+"   xorl    %ecx,%ecx\n"
+"   cpuid\n"
+"   vmovdqu (%r8),%ymm2\n"
+"   vpxor   %ymm0,%ymm2,%ymm2\n"
+"   vmovdqu %ymm2,(%r8)\n"
+"   popq    %rbx\n"
+"   vzeroupper\n"
+"   ret\n"
+".size ymm_call, .-ymm_call\n"
+".previous\n"
+);
+
+static void show ( const char* who, YMM* v )
+{
+   int i;
+   printf("%-10s", who);
+   for (i = 7; i >= 0; i--)
+      printf(" %08x", v->u32[i]);
+   printf("\n");
+}
+
+int main ( void )
+{
+   YMM a, b, out;
+   int i, j;
+   for (i = 0; i < 8; i++) {
+      a.u32[i] = 0x01234567u * (i + 1);
+      b.u32[i] = 0x89abcdefu ^ (0x11111111u * i);
+   }
+   /* Run each kernel a few times, feeding the result back in. */
+   for (j = 0; j < 3; j++) {
+      ymm_native(&a, &b, &out);
+      show("native", &out);
+      ymm_mixed(&a, &out, &out);
+      show("mixed", &out);
+      ymm_call(&out, &b, &out);
+      show("call", &out);
+      a = out;
+   }
+   return 0;
+}
@@ -0,0 +1,45 @@
+// This artificial program copies words at random within a large heap that
+// is mostly undefined.  With --track-origins=yes, each access looks up the
+// origin tags of its cache line, and the working set is much larger than
+// the first level origin cache, so it is a stress test for Memcheck's
+// origin caches (ocacheL1 and ocacheL2).
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define N_BLOCKS      48
+#define BLOCK_WORDS   (1024 * 1024)
+#define REPS          (5 * 1000 * 1000)
+
+int main(int argc, char* argv[])
+{
+   unsigned int* blocks[N_BLOCKS];
+   unsigned int  seed = 1;
+   unsigned int  n_defined = 0;
+   int i, b;
+
+   // Blocks allocated by different calls get different origins.  Leave
+   // most of each block undefined, but give it a few defined words.
+   for (b = 0; b < N_BLOCKS; b++) {
+      blocks[b] = malloc(BLOCK_WORDS * sizeof(unsigned int));
+      for (i = 0; i < BLOCK_WORDS; i += 64)
+         blocks[b][i] = i;
+   }
+
+   for (i = 0; i < REPS; i++) {
+      unsigned int src, dst;
+      seed = seed * 1103515245 + 12345;
+      src  = seed >> 8;
+      seed = seed * 1103515245 + 12345;
+      dst  = seed >> 8;
+      blocks[dst % N_BLOCKS][dst / N_BLOCKS % BLOCK_WORDS]
+         = blocks[src % N_BLOCKS][src / N_BLOCKS % BLOCK_WORDS];
+      if (src % 64 == 0)
+         n_defined++;
+   }
+
+   printf("%u\n", n_defined > 0);
+   for (b = 0; b < N_BLOCKS; b++)
+      free(blocks[b]);
+   return 0;
+}
@@ -0,0 +1,384 @@
+#include <pthread.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <sched.h>
+#include "helgrind/helgrind.h"
+#include "drd/drd.h"
+
+// syncbench runs one of a set of synchronisation-heavy workloads with a
+// given number of threads, for tracking the performance of helgrind and
+// drd.  The total amount of work does not depend on the number of
+// threads, so running a workload with different thread counts shows how
+// the tools scale with threads rather than with work.
+//
+// Usage: syncbench <workload> [nr_thr [scale]]
+//
+//  prodcons  producers and consumers passing items through a bounded
+//            queue protected by a mutex and two condition variables.
+//  rwlock    threads looking up a shared table under a reader lock, and
+//            now and then updating it under the writer lock.
+//  steal     a work-stealing pool: each thread runs many short tasks
+//            from its own deque and steals from the others when empty.
+//  spin      threads handing a token around through an atomic flag,
+//            spinning while waiting for their turn.
+//  stencil   a 1D stencil computation in phases separated by barriers.
+
+static int nr_thr = 4;  // nr of threads running the workload
+static int scale  = 1;  // multiplies the amount of work
+
+// The threads are detached and waited for with a condition variable
+// rather than joined, like in threadpool.
+static pthread_mutex_t done_mx = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  done_cv = PTHREAD_COND_INITIALIZER;
+static int nr_done;
+
+static void thread_done(void)
+{
+   pthread_mutex_lock(&done_mx);
+   if (++nr_done == nr_thr)
+      pthread_cond_signal(&done_cv);
+   pthread_mutex_unlock(&done_mx);
+}
+
+static void run_threads(void *(*fn)(void *))
+{
+   pthread_t thr;
+   long i;
+
+   for (i = 0; i < nr_thr; i++) {
+      pthread_create(&thr, NULL, fn, (void *)i);
+      pthread_detach(thr);
+   }
+   pthread_mutex_lock(&done_mx);
+   while (nr_done < nr_thr)
+      pthread_cond_wait(&done_cv, &done_mx);
+   pthread_mutex_unlock(&done_mx);
+}
+
+// Gives the share of part k of n work items divided into parts parts.
+static long share(long n, long parts, long k)
+{
+   return n / parts + (k < n % parts);
+}
+
+//------------------------------------------------------------------
+// prodcons
+
+#define Q_SIZE 16
+
+static pthread_mutex_t q_mx = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  q_not_empty = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t  q_not_full  = PTHREAD_COND_INITIALIZER;
+static long q_buf[Q_SIZE];
+static int  q_head, q_count;
+static long pc_items;
+static long pc_sum;
+
+static void *prodcons_fn(void *v)
+{
+   long t = (long)v;
+   // Even threads produce and odd threads consume, except that a single
+   // thread does both.
+   long nr_prod = (nr_thr + 1) / 2;
+   long nr_cons = nr_thr / 2;
+   int producer = t % 2 == 0;
+   int consumer = t % 2 == 1 || nr_thr == 1;
+   long n = producer ? share(pc_items, nr_prod, t / 2)
+                     : share(pc_items, nr_cons, t / 2);
+   long i, sum = 0;
+
+   for (i = 0; i < n; i++) {
+      if (producer) {
+         pthread_mutex_lock(&q_mx);
+         while (q_count == Q_SIZE)
+            pthread_cond_wait(&q_not_full, &q_mx);
+         q_buf[(q_head + q_count++) % Q_SIZE] = i;
+         pthread_cond_signal(&q_not_empty);
+         pthread_mutex_unlock(&q_mx);
+      }
+      if (consumer) {
+         pthread_mutex_lock(&q_mx);
+         while (q_count == 0)
+            pthread_cond_wait(&q_not_empty, &q_mx);
+         sum += q_buf[q_head];
+         q_head = (q_head + 1) % Q_SIZE;
+         q_count--;
+         pthread_cond_signal(&q_not_full);
+         pthread_mutex_unlock(&q_mx);
+      }
+   }
+   pthread_mutex_lock(&q_mx);
+   pc_sum += sum;
+   pthread_mutex_unlock(&q_mx);
+   thread_done();
+   return NULL;
+}
+
+static long prodcons(void)
+{
+   pc_items = 50000L * scale;
+   run_threads(prodcons_fn);
+   return pc_sum;
+}
+
+//------------------------------------------------------------------
+// rwlock
+
+#define RW_ENTRIES 1024
+
+static pthread_rwlock_t rw_lock = PTHREAD_RWLOCK_INITIALIZER;
+static long rw_table[RW_ENTRIES];
+static long rw_ops;
+static long rw_sum;
+
+static void *rwlock_fn(void *v)
+{
+   long t = (long)v;
+   long n = share(rw_ops, nr_thr, t);
+   long i, sum = 0;
+   unsigned r = t + 1;
+
+   for (i = 0; i < n; i++) {
+      int e;
+
+      r = r * 1103515245 + 12345;
+      e = (r >> 8) % RW_ENTRIES;
+      if (i % 16 == 0) {
+         pthread_rwlock_wrlock(&rw_lock);
+         rw_table[e] += i;
+         pthread_rwlock_unlock(&rw_lock);
+      } else {
+         pthread_rwlock_rdlock(&rw_lock);
+         sum += rw_table[e] + rw_table[(e + 1) % RW_ENTRIES];
+         pthread_rwlock_unlock(&rw_lock);
+      }
+   }
+   pthread_rwlock_wrlock(&rw_lock);
+   rw_sum += sum;
+   pthread_rwlock_unlock(&rw_lock);
+   thread_done();
+   return NULL;
+}
+
+static long rwlock(void)
+{
+   rw_ops = 100000L * scale;
+   run_threads(rwlock_fn);
+   return rw_sum;
+}
+
+//------------------------------------------------------------------
+// steal
+
+typedef struct {
+   pthread_mutex_t mx;
+   long *task;   // task i computes a small sum depending on task[i]
+   long head;    // next task to steal
+   long tail;    // one past the next task to run by the owner
+} Deque;
+
+static Deque *deques;
+static long steal_tasks;
+static long *steal_results;  // per-thread results
+
+static long run_task(long arg)
+{
+   long i, s = 0;
+
+   for (i = 0; i < 20 + arg % 20; i++)
+      s += i * arg;
+   return s;
+}
+
+// Takes a task from the tail of deque d if own, else from its head.
+static int take_task(Deque *d, int own, long *arg)
+{
+   int found = 0;
+
+   pthread_mutex_lock(&d->mx);
+   if (d->head < d->tail) {
+      *arg = own ? d->task[--d->tail] : d->task[d->head++];
+      found = 1;
+   }
+   pthread_mutex_unlock(&d->mx);
+   return found;
+}
+
+static void *steal_fn(void *v)
+{
+   long t = (long)v;
+   long arg, result = 0;
+   int victim;
+
+   for (;;) {
+      while (take_task(&deques[t], 1, &arg))
+         result += run_task(arg);
+      for (victim = 0; victim < nr_thr; victim++) {
+         if (victim != t && take_task(&deques[victim], 0, &arg)) {
+            result += run_task(arg);
+            break;
+         }
+      }
+      if (victim == nr_thr)
+         break;
+   }
+   steal_results[t] = result;
+   thread_done();
+   return NULL;
+}
+
+static long steal(void)
+{
+   long t, i, sum = 0;
+
+   steal_tasks = 100000L * scale;
+   deques = calloc(nr_thr, sizeof(*deques));
+   steal_results = calloc(nr_thr, sizeof(*steal_results));
+   // Deal out the tasks unevenly: thread t gets a share proportional to
+   // t + 1, so that the threads with few tasks have to steal.
+   for (t = 0; t < nr_thr; t++) {
+      long n = steal_tasks * 2 * (t + 1) / ((long)nr_thr * (nr_thr + 1));
+
+      pthread_mutex_init(&deques[t].mx, NULL);
+      deques[t].task = malloc((n + 1) * sizeof(long));
+      for (i = 0; i < n; i++)
+         deques[t].task[i] = i;
+      deques[t].tail = n;
+   }
+   run_threads(steal_fn);
+   for (t = 0; t < nr_thr; t++)
+      sum += steal_results[t];
+   return sum;
+}
+
+//------------------------------------------------------------------
+// spin
+
+static int  spin_turn;      // thread whose turn it is, accessed atomically
+static long spin_rounds;
+static long spin_counter;   // only updated by the thread whose turn it is
+
+// Neither tool understands the acquire/release pair on spin_turn, so the
+// handoff is annotated for both of them: helgrind.h defines the
+// ANNOTATE_HAPPENS_* macros, and DRD gets its own client requests.
+#define SPIN_HAPPENS_BEFORE(obj)                                          \
+   do {                                                                  \
+      ANNOTATE_HAPPENS_BEFORE(obj);                                      \
+      VALGRIND_DO_CLIENT_REQUEST_STMT(                                   \
+         VG_USERREQ__DRD_ANNOTATE_HAPPENS_BEFORE, obj, 0, 0, 0, 0);      \
+   } while (0)
+#define SPIN_HAPPENS_AFTER(obj)                                           \
+   do {                                                                  \
+      ANNOTATE_HAPPENS_AFTER(obj);                                       \
+      VALGRIND_DO_CLIENT_REQUEST_STMT(                                   \
+         VG_USERREQ__DRD_ANNOTATE_HAPPENS_AFTER, obj, 0, 0, 0, 0);       \
+   } while (0)
+
+static void *spin_fn(void *v)
+{
+   int t = (long)v;
+   long i;
+
+   for (i = 0; i < spin_rounds; i++) {
+      while (__atomic_load_n(&spin_turn, __ATOMIC_ACQUIRE) != t)
+         sched_yield();
+      SPIN_HAPPENS_AFTER(&spin_turn);
+      spin_counter++;
+      SPIN_HAPPENS_BEFORE(&spin_turn);
+      __atomic_store_n(&spin_turn, (t + 1) % nr_thr, __ATOMIC_RELEASE);
+   }
+   thread_done();
+   return NULL;
+}
+
+static long spin(void)
+{
+   // The accesses to spin_turn itself are atomic and race by design.
+   VALGRIND_HG_DISABLE_CHECKING(&spin_turn, sizeof(spin_turn));
+   DRD_IGNORE_VAR(spin_turn);
+   SPIN_HAPPENS_BEFORE(&spin_turn);
+   spin_rounds = 20000L * scale / nr_thr;
+   run_threads(spin_fn);
+   return spin_counter;
+}
+
+//------------------------------------------------------------------
+// stencil
+
+#define ST_SIZE 65536
+
+static pthread_barrier_t st_barrier;
+static double *st_old, *st_new;
+static int st_steps;
+
+static void *stencil_fn(void *v)
+{
+   long t = (long)v;
+   long lo = 1 + t * (ST_SIZE - 2) / nr_thr;
+   long hi = 1 + (t + 1) * (ST_SIZE - 2) / nr_thr;
+   double *a = st_old, *b = st_new, *tmp;
+   long i;
+   int s;
+
+   for (s = 0; s < st_steps; s++) {
+      for (i = lo; i < hi; i++)
+         b[i] = (a[i - 1] + a[i] + a[i + 1]) / 3;
+      pthread_barrier_wait(&st_barrier);
+      tmp = a; a = b; b = tmp;
+   }
+   thread_done();
+   return NULL;
+}
+
+static long stencil(void)
+{
+   long i;
+   double sum = 0;
+
+   st_steps = 40 * scale;
+   st_old = calloc(ST_SIZE, sizeof(double));
+   st_new = calloc(ST_SIZE, sizeof(double));
+   for (i = 0; i < ST_SIZE; i++)
+      st_old[i] = i % 100;
+   pthread_barrier_init(&st_barrier, NULL, nr_thr);
+   run_threads(stencil_fn);
+   for (i = 0; i < ST_SIZE; i++)
+      sum += (st_steps % 2 ? st_new : st_old)[i];
+   return (long)sum;
+}
+
+//------------------------------------------------------------------
+
+static const struct {
+   const char *name;
+   long (*fn)(void);
+} workloads[] = {
+   { "prodcons", prodcons },
+   { "rwlock",   rwlock },
+   { "steal",    steal },
+   { "spin",     spin },
+   { "stencil",  stencil },
+};
+
+int main(int argc, char *argv[])
+{
+   unsigned w;
+
+   if (argc > 2)
+      nr_thr = atoi(argv[2]);
+   if (argc > 3)
+      scale = atoi(argv[3]);
+   if (nr_thr < 1 || scale < 1)
+      argc = 0;
+
+   for (w = 0; argc > 1 && w < sizeof(workloads) / sizeof(workloads[0]); w++)
+      if (strcmp(argv[1], workloads[w].name) == 0) {
+         printf("%s %d: %ld\n", workloads[w].name, nr_thr, workloads[w].fn());
+         return 0;
+      }
+
+   fprintf(stderr, "usage: syncbench prodcons|rwlock|steal|spin|stencil"
+           " [nr_thr [scale]]\n");
+   return 1;
+}
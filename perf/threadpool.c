@@ -0,0 +1,75 @@
+#include <pthread.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+// threadpool simulates a pool of worker threads taking tasks from a
+// shared queue.  Each task takes a few of a set of locks, updates the
+// counters they protect, and the result is handed back to the main
+// thread.  With many threads, the vector timestamps of the threads and
+// locks get long, so this is a stress test of the vector timestamp
+// operations of helgrind and drd rather than of memory access checking.
+
+static int nr_thr   = 200;   // nr of worker threads
+static int nr_tasks = 20000; // total nr of tasks handed out
+static int nr_locks = 64;    // nr of locks taken by the tasks
+
+static pthread_mutex_t q_mx = PTHREAD_MUTEX_INITIALIZER;
+static int q_next;           // next task to be taken
+static int q_done;           // nr of tasks finished
+
+static pthread_mutex_t *locks;
+static long *counters;
+
+static void *worker(void *v)
+{
+   for (;;) {
+      int task, i;
+
+      pthread_mutex_lock(&q_mx);
+      if (q_next == nr_tasks) {
+         pthread_mutex_unlock(&q_mx);
+         return NULL;
+      }
+      task = q_next++;
+      pthread_mutex_unlock(&q_mx);
+
+      for (i = 0; i < 3; i++) {
+         int l = (task * 7 + i * 13) % nr_locks;
+         pthread_mutex_lock(&locks[l]);
+         counters[l] += task;
+         pthread_mutex_unlock(&locks[l]);
+      }
+
+      pthread_mutex_lock(&q_mx);
+      q_done++;
+      pthread_mutex_unlock(&q_mx);
+   }
+}
+
+int main(int argc, char *argv[])
+{
+   pthread_t *thr;
+   long sum = 0;
+   int i;
+
+   if (argc > 1)
+      nr_thr = atoi(argv[1]);
+   if (argc > 2)
+      nr_tasks = atoi(argv[2]);
+
+   locks = malloc(nr_locks * sizeof(*locks));
+   counters = calloc(nr_locks, sizeof(*counters));
+   for (i = 0; i < nr_locks; i++)
+      pthread_mutex_init(&locks[i], NULL);
+
+   thr = malloc(nr_thr * sizeof(*thr));
+   for (i = 0; i < nr_thr; i++)
+      pthread_create(&thr[i], NULL, worker, NULL);
+   for (i = 0; i < nr_thr; i++)
+      pthread_join(thr[i], NULL);
+
+   for (i = 0; i < nr_locks; i++)
+      sum += counters[i];
+   printf("%ld %d\n", sum, q_done);
+   return 0;
+}
@@ -140,6 +140,10 @@ static Bool go(char* cpu)
    } else if (strcmp (cpu,  "amd64-rdseed" ) == 0) {
       level = 7;
       bmask = 1 << 18;
+   } else if (strcmp (cpu,  "amd64-avx2" ) == 0) {
+      level = 7;
+      bmask = 1 << 5;
+      require_xgetbv = True;
 #endif
    } else {
      return UNRECOGNISED_FEATURE;
@@ -160,8 +164,12 @@ static Bool go(char* cpu)
       if (amask > 0 && (a & amask) == amask)
          return FEATURE_PRESENT;
 
-      if (bmask > 0 && (b & bmask) == bmask)
-         return FEATURE_PRESENT;
+      if (bmask > 0 && (b & bmask) == bmask) {
+         if (require_xgetbv && !have_xgetbv())
+            return FEATURE_NOT_PRESENT;
+         else
+            return FEATURE_PRESENT;
+      }
 
       if (dmask > 0 && (d & dmask) == dmask) {
          if (require_xgetbv && !have_xgetbv())